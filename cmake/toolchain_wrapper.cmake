@@ -36,7 +36,8 @@ elseif(EVB MATCHES "eval_ade9178")
     set(CMAKE_LINK_FLAGS "${CMAKE_LINK_FLAGS} --cpu=Cortex-M4.fp.sp --library_type=microlib")
     set(CMAKE_ASM_FLAGS "${CMAKE_ASM_FLAGS} --pd=\"__MICROLIB SETA 1\"")
   elseif(TOOLCHAIN MATCHES "gcc-arm-none-eabi")
-    set(LD_FILE "${CMAKE_CURRENT_LIST_DIR}/../max/${EVB}/max32670.ld" CACHE FILEPATH "Linker script")
+    # eval_ade9178_slave shares the linker script of eval_ade9178
+    set(LD_FILE "${CMAKE_CURRENT_LIST_DIR}/../max/eval_ade9178/max32670.ld" CACHE FILEPATH "Linker script")
   endif()
 elseif(EVB MATCHES "app_mcu_h7")
   include(${CMAKE_CURRENT_LIST_DIR}/st_tools.cmake)
@@ -11,6 +11,7 @@
 /*=============  I N C L U D E S   =============*/
 #include "adi_evb.h"
 #include <stdint.h>
+#include <string.h>
 
 /*=============  C O D E  =============*/
 
@@ -22,7 +23,8 @@ int32_t EvbInit(void **phEvb, ADI_EVB_CONFIG *pConfig)
 
         Initialize GPIO connected to DREADY pin of ADC as input
         Enable interrupt for GPIO on falling edge
-        Call pConfig->gpioConfig.pfGpioCallback from the ISR
+        Call EvbGpioDispatchPin from the ISR, then pConfig->gpioConfig.pfGpioCallback
+        for a pin without a callback
     */
     (void)phEvb;   /* Dummy use of argument */
     (void)pConfig; /* Dummy use of argument */
@@ -72,6 +74,27 @@ int32_t EvbAdeSpiTransceive(void *hEvb, uint8_t *pTxData, uint8_t *pRxData, uint
     return 0;
 }
 
+uint32_t EvbEnterCritical(void)
+{
+    /* Mask interrupts and return the previous mask */
+    return 0;
+}
+
+void EvbExitCritical(uint32_t state)
+{
+    (void)state; /* Dummy use of argument */
+}
+
+int32_t EvbInitCycleCounter(void)
+{
+    return -1;
+}
+
+uint32_t EvbGetCycleCount(void)
+{
+    return 0;
+}
+
 int32_t EvbLedOn(uint32_t idx)
 {
     (void)idx; /* Dummy use of argument */
@@ -80,6 +103,22 @@ int32_t EvbLedOn(uint32_t idx)
     return 0;
 }
 
+int32_t EvbLedOff(uint32_t idx)
+{
+    (void)idx; /* Dummy use of argument */
+
+    return 0;
+}
+
+int32_t EvbSetResetPin(uint32_t idx, uint8_t level)
+{
+    (void)idx;   /* Dummy use of argument */
+    (void)level; /* Dummy use of argument */
+
+    /* Drive the reset pin of ADC or ADE9178 */
+    return 0;
+}
+
 int32_t EvbDelayMs(uint32_t delayMs)
 {
     (void)delayMs; /* Dummy use of argument */
@@ -110,6 +149,105 @@ uint32_t EvbGetTime()
     return 0;
 }
 
+uint64_t EvbGetTime64(void)
+{
+    return 0;
+}
+
+uint32_t EvbGetTimerFrequency(void)
+{
+    return 1000000;
+}
+
+void EvbStartTickTimer(void)
+{
+    /* Setup a 1 ms interrupt calling EvbSwTimerTick */
+}
+
+void EvbStopTickTimer(void)
+{
+}
+
+int32_t EvbStartCfBurst(ADI_EVB_CF_PERIOD *pPeriods, uint32_t numPeriods,
+                        ADI_EVB_CF_BURST_CALLBACK pfCallback)
+{
+    (void)pPeriods;   /* Dummy use of argument */
+    (void)numPeriods; /* Dummy use of argument */
+    (void)pfCallback; /* Dummy use of argument */
+
+    /* Stream the CF periods into the CF timer by DMA burst */
+    return -1;
+}
+
+void EvbStopCfBurst(void)
+{
+}
+
+int32_t EvbStartDreadyCapture(uint32_t *pRing, uint32_t numEntries)
+{
+    (void)pRing;      /* Dummy use of argument */
+    (void)numEntries; /* Dummy use of argument */
+
+    /* Capture the system timer at each DREADY edge and DMA the counts to the ring */
+    return -1;
+}
+
+void EvbStopDreadyCapture(void)
+{
+}
+
+uint32_t EvbGetDreadyCaptureCount(void)
+{
+    return 0;
+}
+
+uint64_t EvbCaptureToTime64(uint32_t count)
+{
+    (void)count; /* Dummy use of argument */
+
+    return 0;
+}
+
+int32_t EvbStartPulseCount(uint32_t idx, uint32_t threshold, ADI_EVB_PULSE_CALLBACK pfCallback)
+{
+    (void)idx;        /* Dummy use of argument */
+    (void)threshold;  /* Dummy use of argument */
+    (void)pfCallback; /* Dummy use of argument */
+
+    /* Count the CF input pulses in a timer, interrupt every threshold pulses */
+    return -1;
+}
+
+void EvbStopPulseCount(uint32_t idx)
+{
+    (void)idx; /* Dummy use of argument */
+}
+
+uint32_t EvbGetPulseCount(uint32_t idx)
+{
+    (void)idx; /* Dummy use of argument */
+
+    return 0;
+}
+
+int32_t EvbEnterLowPower(ADI_EVB_POWER_MODE mode, uint32_t sleepUs)
+{
+    (void)mode;    /* Dummy use of argument */
+    (void)sleepUs; /* Dummy use of argument */
+
+    /* Enter the low power mode with interrupts masked, return 1 on a wake timer wake */
+    return -1;
+}
+
+int32_t EvbGpioWriteMask(uint32_t port, uint32_t setMask, uint32_t clearMask)
+{
+    (void)port;      /* Dummy use of argument */
+    (void)setMask;   /* Dummy use of argument */
+    (void)clearMask; /* Dummy use of argument */
+
+    return 0;
+}
+
 int32_t EvbGetPinState(uint32_t port, uint32_t flag)
 {
     (void)port; /* Dummy use of argument */
@@ -142,26 +280,34 @@ int32_t EvbAdeSpiTransceiveAsync(void *hEvb, uint8_t *pTxData, uint8_t *pRxData,
     return 0;
 }
 
-int32_t EvbEnableDreadyIrq(uint8_t enable)
+int32_t EvbAdeSpiTransceiveBurst(void *hEvb, ADI_EVB_SPI_SEGMENT *pSegments, uint32_t numSegments)
 {
-    (void)enable; /* Dummy use of argument */
+    (void)hEvb;        /* Dummy use of argument */
+    (void)pSegments;   /* Dummy use of argument */
+    (void)numSegments; /* Dummy use of argument */
 
     return 0;
 }
 
-int32_t EvbCrcCalculate(void *hEvb, uint8_t *pData, uint32_t numBytes)
+int32_t EvbAdeSpiGetXferStatus(void *hEvb)
 {
-    (void)hEvb;     /* Dummy use of argument */
-    (void)pData;    /* Dummy use of argument */
-    (void)numBytes; /* Dummy use of argument */
+    (void)hEvb; /* Dummy use of argument */
+
+    return 0;
+}
+
+int32_t EvbAdeSpiSetDataSize(void *hEvb, uint32_t dataSize, uint32_t burstLength)
+{
+    (void)hEvb;        /* Dummy use of argument */
+    (void)dataSize;    /* Dummy use of argument */
+    (void)burstLength; /* Dummy use of argument */
 
     return 0;
 }
 
-int32_t EvbCrcGetValue(void *hEvb, uint32_t *pData)
+int32_t EvbEnableDreadyIrq(uint8_t enable)
 {
-    (void)hEvb;  /* Dummy use of argument */
-    (void)pData; /* Dummy use of argument */
+    (void)enable; /* Dummy use of argument */
 
     return 0;
 }
@@ -170,6 +316,45 @@ int32_t EvbGetTxStatus(void)
 {
     return 1;
 }
+
+int32_t EvbInitMem(void)
+{
+    return 0;
+}
+
+int32_t EvbMemcpyAsync(void *hEvb, void *pDst, const void *pSrc, uint32_t numBytes,
+                       ADI_EVB_MEM_CALLBACK pfCallback)
+{
+    /* No DMA on the host, copy with the CPU and complete immediately */
+    (void)hEvb; /* Dummy use of argument */
+    memcpy(pDst, pSrc, numBytes);
+    if (pfCallback != NULL)
+    {
+        pfCallback(0);
+    }
+
+    return 0;
+}
+
+int32_t EvbMemsetAsync(void *hEvb, void *pDst, uint8_t value, uint32_t numBytes,
+                       ADI_EVB_MEM_CALLBACK pfCallback)
+{
+    (void)hEvb; /* Dummy use of argument */
+    memset(pDst, value, numBytes);
+    if (pfCallback != NULL)
+    {
+        pfCallback(0);
+    }
+
+    return 0;
+}
+
+int32_t EvbMemGetStatus(void *hEvb)
+{
+    (void)hEvb; /* Dummy use of argument */
+
+    return 0;
+}
 /**
  * @}
  */
@@ -13,10 +13,15 @@
 
 /*============= I N C L U D E S =============*/
 
+#include "adi_evb_bench.h"
 #include "adi_evb_crc.h"
 #include "adi_evb_gpio.h"
 #include "adi_evb_i2c.h"
+#include "adi_evb_idle.h"
+#include "adi_evb_mem.h"
+#include "adi_evb_prof.h"
 #include "adi_evb_spi.h"
+#include "adi_evb_swtimer.h"
 #include "adi_evb_timer.h"
 #include "adi_evb_uart.h"
 #include "board_cfg.h"
@@ -47,6 +52,8 @@ extern "C" {
 #define ADI_EVB_STATUS_INVALID_INDEX 7
 /** General  falure */
 #define ADI_EVB_STATUS_INIT_FAILURE 8
+/** CRC mismatch detected by the peripheral */
+#define ADI_EVB_STATUS_CRC_ERROR 9
 
 /** Typedef for callbacks from EVB */
 typedef void (*ADI_EVB_CALLBACK)(void);
@@ -97,6 +104,8 @@ typedef struct
     ADI_EVB_CALLBACK pfFramSpiRxCallback;
     /** Spi tx callback */
     ADI_EVB_CALLBACK pfFramSpiTxCallback;
+    /** Ade spi link test, enables the spi clock tuning at init if not NULL */
+    ADI_EVB_SPI_LINK_TEST pfAdeSpiLinkTest;
 } ADI_EVB_SPI_CONFIG;
 
 /**
@@ -156,6 +165,30 @@ typedef struct
  */
 ADI_EVB_STATUS EvbDelayMs(uint32_t delayMs);
 
+/**
+ * @brief       Masks interrupts, for short sections shared with interrupt handlers.
+ * @return      Previous interrupt mask, to be passed to #EvbExitCritical.
+ */
+uint32_t EvbEnterCritical(void);
+
+/**
+ * @brief       Restores the interrupt mask saved by #EvbEnterCritical.
+ * @param[in]   state     Value returned by the matching #EvbEnterCritical.
+ */
+void EvbExitCritical(uint32_t state);
+
+/**
+ * @brief       Enables the CPU cycle counter used by the profiling API.
+ * @return      0 on success, -1 when the core has no cycle counter.
+ */
+int32_t EvbInitCycleCounter(void);
+
+/**
+ * @brief       Reads the free running CPU cycle counter, which wraps at 32 bits.
+ * @return      Current cycle count.
+ */
+uint32_t EvbGetCycleCount(void);
+
 /**
  * @brief Initialzes peripherals. Refer to board_cfg.h for
  * static board configurations. USe app_cfg.h for application
@@ -239,7 +272,7 @@ int32_t EvbInitNvm(void *hEvb);
 
 /**
  * @brief Writes data to the NVM in blocking mode. This function will block until the transfer is
- * complete.
+ * complete. The area of the ADE SPI clock record, see #EvbAdeSpiAutoTune, is reserved.
  * @param[in]  hEvb - Evb handle obtained from EvbInit
  * @param[in]  pSrc  - pointer to the data to be sent
  * @param[in]  numBytes  - num of bytes to send
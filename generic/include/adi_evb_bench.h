@@ -0,0 +1,116 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file  adi_evb_bench.h
+ * @brief Benchmark API header file. The benchmarks measure the board drivers with the
+ * profiling probes of adi_evb_prof.h.
+ * @addtogroup    BENCH drivers
+ * @{
+ */
+
+#ifndef __ADI_EVB_BENCH_H__
+#define __ADI_EVB_BENCH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============= I N C L U D E S =============*/
+
+#include "adi_evb_crc.h"
+#include "adi_evb_spi.h"
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Num of probes used by #EvbBenchMemcpy */
+#define ADI_EVB_BENCH_MEMCPY_PROBES 3
+/** Num of probes used by #EvbBenchCrc */
+#define ADI_EVB_BENCH_CRC_PROBES 2
+/** Num of probes used by #EvbBenchAdeSpi */
+#define ADI_EVB_BENCH_SPI_PROBES 2
+
+/*======= P U B L I C   P R O T O T Y P E S ========*/
+
+/**
+ * @brief Compares a CPU copy with a DMA copy of the same buffer. #EvbProfInit must have
+ * been called. The probes from probeId are named and measure:
+ * - probeId: memcpy by the CPU
+ * - probeId + 1: CPU time to start the DMA copy
+ * - probeId + 2: DMA copy from the start to the completion callback
+ *
+ * The CPU cycles freed per copy are the average of probeId less the average of
+ * probeId + 1. Requires APP_CFG_ENABLE_MEM_DMA.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[out] pDst  - pointer to the destination
+ * @param[in]  pSrc  - pointer to the source
+ * @param[in]  numBytes  - num of bytes to copy
+ * @param[in]  numRuns  - num of copies measured with each method
+ * @param[in]  probeId  - first of the #ADI_EVB_BENCH_MEMCPY_PROBES probes to use
+ * @return  success or error
+ */
+int32_t EvbBenchMemcpy(void *hEvb, void *pDst, const void *pSrc, uint32_t numBytes,
+                       uint32_t numRuns, uint32_t probeId);
+
+/**
+ * @brief Compares the CRC API with a bit at a time CRC of the same data. #EvbProfInit must
+ * have been called. The probes from probeId are named and measure:
+ * - probeId: a job through #EvbCrcSubmit, from the submit to the job callback
+ * - probeId + 1: the bitwise CRC
+ *
+ * The CRC API is the DMA fed CRC unit on boards built with USE_HW_CRC and the table
+ * driven sw_crc.c otherwise, so running the benchmark on both builds compares the DMA,
+ * table and bitwise CRCs. Requires APP_CFG_ENABLE_HW_CRC and no pending CRC jobs.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  pParams  - CRC parameters
+ * @param[in]  pData  - pointer to the data
+ * @param[in]  numBytes  - num of bytes of data
+ * @param[in]  numRuns  - num of CRCs measured with each method
+ * @param[in]  probeId  - first of the #ADI_EVB_BENCH_CRC_PROBES probes to use
+ * @return  success or error, ADI_EVB_STATUS_CRC_ERROR if the two CRCs differ
+ */
+int32_t EvbBenchCrc(void *hEvb, ADI_EVB_CRC_PARAMS *pParams, uint8_t *pData, uint32_t numBytes,
+                    uint32_t numRuns, uint32_t probeId);
+
+/**
+ * @brief Compares ADE SPI transfers of 8 bit frames, one per DMA request, with the frame size
+ * and burst length given. #EvbProfInit must have been called. The probes from probeId are
+ * named and measure a transfer from the start to #EvbBenchAdeSpiRxDone:
+ * - probeId: 8 bit frames, burst length 1
+ * - probeId + 1: dataSize frames, burstLength frames per DMA request
+ *
+ * The throughput is numBytes divided by the average time of each probe. The application
+ * must call #EvbBenchAdeSpiRxDone from its ADE SPI Rx callback while the benchmark runs.
+ * The ADE SPI is left with 8 bit frames and a burst length of 1. Requires APP_CFG_ENABLE_SPI.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  pTxData  - pointer to the data to transmit
+ * @param[out] pRxData  - pointer to the receive buffer
+ * @param[in]  numBytes  - num of bytes per transfer, a multiple of the packet size
+ * @param[in]  dataSize  - frame size in bits, see #EvbAdeSpiSetDataSize
+ * @param[in]  burstLength  - frames per DMA request, see #EvbAdeSpiSetDataSize
+ * @param[in]  numRuns  - num of transfers measured with each configuration
+ * @param[in]  timeOutCount  - timeout count to wait for each transfer
+ * @param[in]  probeId  - first of the #ADI_EVB_BENCH_SPI_PROBES probes to use
+ * @return  success or error, error if a transfer times out
+ */
+int32_t EvbBenchAdeSpi(void *hEvb, uint8_t *pTxData, uint8_t *pRxData, uint32_t numBytes,
+                       uint32_t dataSize, uint32_t burstLength, uint32_t numRuns,
+                       uint32_t timeOutCount, uint32_t probeId);
+
+/**
+ * @brief End of a transfer of #EvbBenchAdeSpi, to be called from the ADE SPI Rx callback.
+ * Does nothing when no benchmarked transfer is pending.
+ */
+void EvbBenchAdeSpiRxDone(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADI_EVB_BENCH_H__ */
+
+/**
+ * @}
+ */
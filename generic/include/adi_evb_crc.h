@@ -20,18 +20,190 @@ extern "C" {
 
 #include <stdint.h>
 
+/*=============  D E F I N I T I O N S  =============*/
+
+/**
+ * Enums of CRC width.
+ */
+typedef enum
+{
+    /** CRC-8. */
+    ADI_EVB_CRC_TYPE_CRC8 = 0u,
+    /** CRC-16. */
+    ADI_EVB_CRC_TYPE_CRC16,
+    /** CRC-32. */
+    ADI_EVB_CRC_TYPE_CRC32,
+
+} ADI_EVB_CRC_TYPE;
+
+/**
+ * @brief CRC algorithm parameters, in the usual catalogue form
+ * e.g. CRC-32: {ADI_EVB_CRC_TYPE_CRC32, 0x04C11DB7, 0xFFFFFFFF, 1, 1, 0xFFFFFFFF}
+ * CRC-16/CCITT-FALSE: {ADI_EVB_CRC_TYPE_CRC16, 0x1021, 0xFFFF, 0, 0, 0}
+ * CRC-8: {ADI_EVB_CRC_TYPE_CRC8, 0x07, 0, 0, 0, 0}
+ */
+typedef struct
+{
+    /** CRC width */
+    ADI_EVB_CRC_TYPE crcType;
+    /** Polynomial in normal (MSB first) form without the top bit */
+    uint32_t polynomial;
+    /** Initial value of the CRC register */
+    uint32_t seed;
+    /** 1 to reflect each input byte */
+    uint8_t reflectIn;
+    /** 1 to reflect the CRC before the final XOR */
+    uint8_t reflectOut;
+    /** Value XORed with the CRC at the end */
+    uint32_t finalXor;
+} ADI_EVB_CRC_PARAMS;
+
+/**
+ * @brief CRC context of one logical stream. Several contexts can interleave on the
+ * CRC unit through the job queue, the running CRC is saved after each job and
+ * restored before the next job of the same stream.
+ */
+typedef struct
+{
+    /** CRC parameters of the stream */
+    ADI_EVB_CRC_PARAMS params;
+    /** Saved CRC register, in the driver's internal format */
+    uint32_t state;
+    /** CRC of the data of all completed jobs, after reflection and final XOR */
+    uint32_t value;
+    /** Set until the first job of the stream has loaded the seed */
+    uint8_t isNew;
+} ADI_EVB_CRC_CONTEXT;
+
+/** CRC job */
+typedef struct ADI_EVB_CRC_JOB ADI_EVB_CRC_JOB;
+
+/** Callback at the end of a CRC job, status is 0 on success */
+typedef void (*ADI_EVB_CRC_JOB_CALLBACK)(ADI_EVB_CRC_JOB *pJob, int32_t status);
+
+/** CRC job, owned by the queue from #EvbCrcSubmit until its callback */
+struct ADI_EVB_CRC_JOB
+{
+    /** Stream the data belongs to */
+    ADI_EVB_CRC_CONTEXT *pContext;
+    /** Data to add to the stream */
+    uint8_t *pData;
+    /** Num of bytes of data */
+    uint32_t numBytes;
+    /** Called when the job is complete, may be NULL */
+    ADI_EVB_CRC_JOB_CALLBACK pfCallback;
+    /** Next job in the queue, used by the queue */
+    ADI_EVB_CRC_JOB *pNext;
+};
+
+/*======= P U B L I C   P R O T O T Y P E S ========*/
+
 /**
- * @brief Calculates CRC for the given data
+ * @brief Configures the CRC algorithm used by the following calculations.
+ * EvbInitCrc selects CRC-16/CCITT-FALSE until this is called.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  pParams  - pointer to the CRC parameters
+ *
+ * @return  0 on success, error if the parameters are not supported or a calculation is in progress
+ */
+int32_t EvbCrcConfigure(void *hEvb, ADI_EVB_CRC_PARAMS *pParams);
+
+/**
+ * @brief Calculates CRC for the given data, same as #EvbCrcStart followed by
+ * #EvbCrcAccumulate. The CRC callback is called at the end, read the result with
+ * #EvbCrcGetValue.
  * @param[in]  hEvb - Evb handle obtained from EvbInit
  * @param[in]  pData  - pointer to the data for which CRC needs to be calculated
  * @param[in]  numBytes  - number of bytes to be considered for CRC calculation
  *
- * @return  CRC value
+ * @return  0 on success, error code otherwise
  */
 int32_t EvbCrcCalculate(void *hEvb, uint8_t *pData, uint32_t numBytes);
 
 /**
- * @brief Gets the CRC value
+ * @brief Starts an incremental CRC, the CRC register is loaded with the seed
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ *
+ * @return  0 on success, error if a chunk is in progress
+ */
+int32_t EvbCrcStart(void *hEvb);
+
+/**
+ * @brief Adds a chunk of data to the CRC started with #EvbCrcStart. The data is fed to
+ * the CRC unit by DMA and the CRC callback is called once the chunk is consumed, the
+ * next chunk may be added from the callback. The buffer must not change until then.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  pData  - pointer to the chunk
+ * @param[in]  numBytes  - number of bytes in the chunk
+ *
+ * @return  0 on success, error if a chunk is in progress
+ */
+int32_t EvbCrcAccumulate(void *hEvb, uint8_t *pData, uint32_t numBytes);
+
+/**
+ * @brief Gets the CRC of all chunks added since #EvbCrcStart, after the output
+ * reflection and final XOR
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[out]  pData - pointer to the CRC
+ *
+ * @return  0 on success, error if a chunk is in progress or a DMA error occurred
+ */
+int32_t EvbCrcFinalise(void *hEvb, uint32_t *pData);
+
+/**
+ * @brief Gets the CRC register so that the calculation can be resumed later with
+ * #EvbCrcRestoreState, possibly after other calculations.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[out]  pState - pointer to the saved state
+ *
+ * @return  0 on success, error if a chunk is in progress
+ */
+int32_t EvbCrcSaveState(void *hEvb, uint32_t *pState);
+
+/**
+ * @brief Loads a CRC register saved by #EvbCrcSaveState, in place of #EvbCrcStart.
+ * The CRC must be configured with the parameters in use when the state was saved.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  state - saved state
+ *
+ * @return  0 on success, error if a chunk is in progress
+ */
+int32_t EvbCrcRestoreState(void *hEvb, uint32_t state);
+
+/**
+ * @brief Initialises a CRC context for a new stream
+ * @param[out]  pContext - pointer to the context
+ * @param[in]  pParams  - pointer to the CRC parameters of the stream
+ *
+ * @return  0 on success, error otherwise
+ */
+int32_t EvbCrcContextInit(ADI_EVB_CRC_CONTEXT *pContext, ADI_EVB_CRC_PARAMS *pParams);
+
+/**
+ * @brief Queues a job that adds data to the stream of its context. Jobs run back to back
+ * in submission order, the CRC unit is reconfigured and the context restored as needed.
+ * On completion pContext->value holds the CRC of the stream so far and the job callback
+ * is called, the job and its data must remain valid until then. The CRC callback of
+ * #EvbInitCrc is not called for queued jobs. Direct calculations must not be started
+ * while jobs are pending.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  pJob  - pointer to the job
+ *
+ * @return  0 on success, error if the job is invalid
+ */
+int32_t EvbCrcSubmit(void *hEvb, ADI_EVB_CRC_JOB *pJob);
+
+/**
+ * @brief Called by the CRC driver when a chunk has been consumed. Completes the active
+ * queued job and starts the next one.
+ * @param[in]  error - 1 if the chunk failed
+ *
+ * @return  1 if the chunk belonged to a queued job, 0 otherwise
+ */
+uint8_t EvbCrcJobIrqCallback(uint8_t error);
+
+/**
+ * @brief Gets the CRC value, same as #EvbCrcFinalise
  * @param[in] hEvb - pointer to Evb handle
  * @param[out]  pData - pointer to destination data buffer
  *
@@ -23,6 +23,38 @@ extern "C" {
 
 /*=============  D E F I N I T I O N S  =============*/
 
+/** Index of the ADC reset pin given to #EvbSetResetPin */
+#define ADI_EVB_RESET_PIN_ADC 0
+/** Index of the ADE9178 reset pin given to #EvbSetResetPin */
+#define ADI_EVB_RESET_PIN_ADE 1
+
+/** Num of LEDs that can play a pattern at the same time */
+#define ADI_EVB_LED_MAX_PATTERNS 4
+
+/**
+ * Callback at the end of an asynchronous reset, called from the tick interrupt
+ * with the status of the sequence.
+ */
+typedef void (*ADI_EVB_RESET_CALLBACK)(int32_t status);
+
+/** Num of pin numbers that can have a callback, each pin number on one port only */
+#define ADI_EVB_GPIO_MAX_PINS 32
+
+/** Dispatch groups of the pins sharing a GPIO interrupt */
+typedef enum
+{
+    /** dispatched first */
+    ADI_EVB_GPIO_GROUP_FAST,
+    /** dispatched after the fast group */
+    ADI_EVB_GPIO_GROUP_NORMAL
+} ADI_EVB_GPIO_GROUP;
+
+/**
+ * Per pin callback, called from the GPIO interrupt with the port, the pin mask and the
+ * argument given at registration.
+ */
+typedef void (*ADI_EVB_PIN_CALLBACK)(uint32_t port, uint32_t pin, void *pArg);
+
 /*======= P U B L I C   P R O T O T Y P E S ========*/
 
 /**
@@ -74,6 +106,128 @@ int32_t EvbSetStandby(uint8_t mode);
  */
 int32_t EvbLedOff(uint32_t idx);
 
+/**
+ *  @brief      Plays an on/off pattern on an LED without blocking.
+ *  @param[in]  idx         Index of the LED.
+ *  @param[in]  pStepsMs    Durations in ms of the steps, starting with the LED on and
+ *                          alternating. Must remain valid while the pattern plays.
+ *  @param[in]  numSteps    Number of steps in the pattern.
+ *  @param[in]  numRepeats  Number of times to play the pattern, 0 to repeat until stopped.
+ *  @details    Steps are timed with the software timers, the system timer must be
+ *              initialised. A pattern already playing on the LED is replaced. The LED is
+ *              left off at the end of the pattern.
+ *  @return     int32_t_SUCCESS on success.
+ */
+int32_t EvbLedPlayPattern(uint32_t idx, const uint16_t *pStepsMs, uint32_t numSteps,
+                          uint32_t numRepeats);
+
+/**
+ *  @brief      Flashes an LED without blocking, see #EvbLedFlash.
+ *  @param[in]  idx         Index of the LED to flash.
+ *  @param[in]  numFlashes  Number of times to flash the LED.
+ *  @param[in]  flashMs     Duration in ms for which the LED will be on.
+ *  @return     int32_t_SUCCESS on success.
+ */
+int32_t EvbLedFlashAsync(uint32_t idx, uint32_t numFlashes, uint32_t flashMs);
+
+/**
+ *  @brief      Stops the pattern playing on an LED and turns the LED off.
+ *  @param[in]  idx         Index of the LED.
+ *  @return     int32_t_SUCCESS on success.
+ */
+int32_t EvbLedStopPattern(uint32_t idx);
+
+/**
+ *  @brief      Gets the state of the pattern of an LED.
+ *  @param[in]  idx         Index of the LED.
+ *  @return     1 while a pattern plays, 0 otherwise.
+ */
+uint8_t EvbLedIsPatternActive(uint32_t idx);
+
+/**
+ * @brief       Resets the ADE without blocking, see #EvbResetAde.
+ * @param[in]   pfCallback  Called once the ADE is out of reset, can be NULL.
+ * @details     Steps are timed with the software timers, the system timer must be
+ *              initialised. Other init work can run during the wait after the pulse.
+ * @return      int32_t_SUCCESS on success, error if a reset is already in progress.
+ */
+int32_t EvbResetAdeAsync(ADI_EVB_RESET_CALLBACK pfCallback);
+
+/**
+ * @brief       Resets the ADCs without blocking, see #EvbResetAdeAsync.
+ * @param[in]   pfCallback  Called once the ADCs are out of reset, can be NULL.
+ * @return      int32_t_SUCCESS on success, error if a reset is already in progress.
+ */
+int32_t EvbResetAdcsAsync(ADI_EVB_RESET_CALLBACK pfCallback);
+
+/**
+ * @brief       Resets all devices without blocking, see #EvbResetAdeAsync.
+ * @details     ADCs are reset before ADE9178.
+ * @param[in]   pfCallback  Called once all devices are out of reset, can be NULL.
+ * @return      int32_t_SUCCESS on success, error if a reset is already in progress.
+ */
+int32_t EvbResetAllAsync(ADI_EVB_RESET_CALLBACK pfCallback);
+
+/**
+ * @brief       Gets the state of the asynchronous reset.
+ * @return      1 while a reset is in progress, 0 otherwise.
+ */
+uint8_t EvbIsResetBusy(void);
+
+/**
+ * @brief       Drives an active-low reset pin. Implemented by the board.
+ * @param[in]   idx     #ADI_EVB_RESET_PIN_ADC or #ADI_EVB_RESET_PIN_ADE.
+ * @param[in]   level   0 to hold the device in reset, 1 to release it.
+ * @return      int32_t_SUCCESS on success, error if the board has no such pin.
+ */
+int32_t EvbSetResetPin(uint32_t idx, uint8_t level);
+
+/**
+ * @brief       Registers the callback of an interrupt pin.
+ * @param[in]   port        Port of the pin.
+ * @param[in]   pin         Mask of the pin, one bit set.
+ * @param[in]   group       Dispatch group, the fast group is handled first when several
+ *                          pins of a shared interrupt are pending.
+ * @param[in]   pfCallback  Callback, NULL to remove the callback of the pin.
+ * @param[in]   pArg        Argument given to the callback.
+ * @details     Pins without a callback are reported to the pfGpioCallback of
+ *              #ADI_EVB_GPIO_CONFIG. A pin with its own interrupt, such as DREADY, calls
+ *              its callback directly. The callbacks are kept per pin number, so a pin
+ *              number can have a callback on one port only. The callback of a pin must be
+ *              removed before the same pin number is registered on another port.
+ * @return      int32_t_SUCCESS on success, ADI_EVB_STATUS_INVALID_INDEX if the pin mask
+ *              is not a single bit or the pin number has a callback on another port.
+ */
+int32_t EvbRegisterPinCallback(uint32_t port, uint32_t pin, ADI_EVB_GPIO_GROUP group,
+                               ADI_EVB_PIN_CALLBACK pfCallback, void *pArg);
+
+/**
+ * @brief       Calls the callbacks of the pending pins of a port, fast group first.
+ *              Called by the board from the GPIO interrupt.
+ * @param[in]   port        Port of the pins.
+ * @param[in]   pending     Mask of the pending pins.
+ * @return      Mask of the pending pins without a callback.
+ */
+uint32_t EvbGpioDispatch(uint32_t port, uint32_t pending);
+
+/**
+ * @brief       Calls the callback of one pin, for the interrupt dedicated to a pin.
+ * @param[in]   port        Port of the pin.
+ * @param[in]   pin         Mask of the pin, one bit set.
+ * @return      0 if the callback was called, the pin if it has no callback.
+ */
+uint32_t EvbGpioDispatchPin(uint32_t port, uint32_t pin);
+
+/**
+ * @brief       Drives several output pins of a port with one register write, so that
+ *              their edges are not skewed by call overhead. Safe to call from interrupts.
+ * @param[in]   port        Port of the pins.
+ * @param[in]   setMask     Mask of the pins driven high.
+ * @param[in]   clearMask   Mask of the pins driven low, must not overlap setMask.
+ * @return      int32_t_SUCCESS on success.
+ */
+int32_t EvbGpioWriteMask(uint32_t port, uint32_t setMask, uint32_t clearMask);
+
 /**
  * Enable GPIO Irq
  * @param port - Port of the GPIO
@@ -0,0 +1,141 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file  adi_evb_idle.h
+ * @brief Low power idle API header file
+ * @addtogroup    IDLE drivers
+ * @{
+ */
+
+#ifndef __ADI_EVB_IDLE_H__
+#define __ADI_EVB_IDLE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============= I N C L U D E S =============*/
+
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Longest time in us spent in one call to #EvbIdle */
+#define ADI_EVB_IDLE_MAX_SLEEP_US 2000000u
+
+/** Low power modes */
+typedef enum
+{
+    /** CPU clock stopped, peripherals and DMA keep running */
+    ADI_EVB_POWER_MODE_SLEEP,
+    /** System clocks stopped, only the wake timer and EXTI lines can wake */
+    ADI_EVB_POWER_MODE_STOP
+} ADI_EVB_POWER_MODE;
+
+/** Restores the system clocks after a wake from STOP, called with interrupts masked */
+typedef void (*ADI_EVB_IDLE_CLOCK_CALLBACK)(void);
+
+/** Low power idle configuration */
+typedef struct
+{
+    /** restores the clocks after STOP, NULL to use SLEEP only */
+    ADI_EVB_IDLE_CLOCK_CALLBACK pfRestoreClocks;
+    /** shortest idle time in us for which the tick is suspended */
+    uint32_t minTicklessUs;
+    /** shortest idle time in us for which STOP is used */
+    uint32_t minStopUs;
+    /** time in us to wake from STOP and restore the clocks, the wake timer is set this much
+     * before the deadline so that the next DREADY finds the clocks running */
+    uint32_t stopExitUs;
+    /** DREADY period in us, 0 when the ADC is not running */
+    uint32_t dreadyPeriodUs;
+} ADI_EVB_IDLE_CONFIG;
+
+/** Low power idle statistics */
+typedef struct
+{
+    /** num of times SLEEP was entered */
+    uint32_t numSleep;
+    /** num of times STOP was entered */
+    uint32_t numStop;
+    /** num of wakes by the wake timer, the wakes for which latency is measured */
+    uint32_t numTimerWakes;
+    /** latency in ns from the wake timer deadline to the return of #EvbIdle, last wake */
+    uint32_t lastWakeLatencyNs;
+    /** longest wake latency in ns */
+    uint32_t maxWakeLatencyNs;
+    /** time in us spent in low power modes */
+    uint64_t asleepUs;
+    /** time in us since the statistics were cleared */
+    uint64_t totalUs;
+} ADI_EVB_IDLE_STATS;
+
+/*======= P U B L I C   P R O T O T Y P E S ========*/
+
+/**
+ * @brief Configures the low power idle and clears the statistics.
+ * Requires the system timer to be initialised and started.
+ * @param[in]  pConfig - idle configuration, copied
+ * @return  success or error
+ */
+int32_t EvbIdleInit(ADI_EVB_IDLE_CONFIG *pConfig);
+
+/**
+ * @brief Enters the deepest low power mode that ends before the next software timer
+ * expiry and the expected DREADY, and returns after the wake. Call from the main loop when
+ * there is no work left. Interrupt handlers run after the clocks are restored.
+ * @return  mode entered, negative if not initialised or not supported by the board
+ */
+int32_t EvbIdle(void);
+
+/**
+ * @brief Records a DREADY edge, from which the next one is expected.
+ * Call from the DREADY callback.
+ */
+void EvbIdleNotifyDready(void);
+
+/**
+ * @brief Sets the expected DREADY period, when the ADC is started or stopped
+ * @param[in]  periodUs - DREADY period in us, 0 when the ADC is not running
+ */
+void EvbIdleSetDreadyPeriod(uint32_t periodUs);
+
+/**
+ * @brief Gets a copy of the idle statistics
+ * @param[out] pStats  - statistics
+ * @return  success or error
+ */
+int32_t EvbIdleGetStats(ADI_EVB_IDLE_STATS *pStats);
+
+/**
+ * @brief Gets the fraction of time spent in low power modes
+ * @return  time asleep in 1/1000 of the time since the statistics were cleared
+ */
+uint32_t EvbIdleGetAsleepPermille(void);
+
+/**
+ * @brief Clears the idle statistics
+ */
+void EvbIdleResetStats(void);
+
+/**
+ * @brief Enters a low power mode with interrupts masked. Implemented by the board.
+ * @param[in]  mode - low power mode
+ * @param[in]  sleepUs - time to the wake timer deadline, 0 to keep the tick running and
+ * wake on the next interrupt
+ * @return  1 if woken by the wake timer, 0 if woken by another interrupt, negative if
+ * the mode is not supported
+ */
+int32_t EvbEnterLowPower(ADI_EVB_POWER_MODE mode, uint32_t sleepUs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADI_EVB_IDLE_H__ */
+
+/**
+ * @}
+ */
@@ -0,0 +1,77 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file  adi_evb_mem.h
+ * @brief DMA memory copy API header file
+ * @addtogroup    MEM drivers
+ * @{
+ */
+
+#ifndef __ADI_EVB_MEM_H__
+#define __ADI_EVB_MEM_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============= I N C L U D E S =============*/
+
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Callback for the end of a memory transfer, status is 0 on success */
+typedef void (*ADI_EVB_MEM_CALLBACK)(int32_t status);
+
+/*======= P U B L I C   P R O T O T Y P E S ========*/
+
+/**
+ * @brief Initialises the memory to memory DMA channel
+ * @return  success or error
+ */
+int32_t EvbInitMem(void);
+
+/**
+ * @brief Copies a buffer with DMA. Only one transfer is in progress at a time.
+ * Word transfers are used when both addresses and the length are multiples of 4.
+ * The buffers must not be accessed until the callback is called.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[out] pDst  - pointer to the destination
+ * @param[in]  pSrc  - pointer to the source
+ * @param[in]  numBytes  - num of bytes to copy
+ * @param[in]  pfCallback  - called from the DMA interrupt at the end, may be NULL
+ * @return  success or error, error if a transfer is in progress
+ */
+int32_t EvbMemcpyAsync(void *hEvb, void *pDst, const void *pSrc, uint32_t numBytes,
+                       ADI_EVB_MEM_CALLBACK pfCallback);
+
+/**
+ * @brief Fills a buffer with a byte value using DMA. Only one transfer is in progress at a time.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[out] pDst  - pointer to the destination
+ * @param[in]  value  - byte value to fill
+ * @param[in]  numBytes  - num of bytes to fill
+ * @param[in]  pfCallback  - called from the DMA interrupt at the end, may be NULL
+ * @return  success or error, error if a transfer is in progress
+ */
+int32_t EvbMemsetAsync(void *hEvb, void *pDst, uint8_t value, uint32_t numBytes,
+                       ADI_EVB_MEM_CALLBACK pfCallback);
+
+/**
+ * @brief Gets the state of the last memory transfer
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @return  0 when complete, 1 while in progress, -1 on error
+ */
+int32_t EvbMemGetStatus(void *hEvb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADI_EVB_MEM_H__ */
+
+/**
+ * @}
+ */
@@ -0,0 +1,101 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file  adi_evb_prof.h
+ * @brief Cycle count profiling API header file
+ * @addtogroup    PROF drivers
+ * @{
+ */
+
+#ifndef __ADI_EVB_PROF_H__
+#define __ADI_EVB_PROF_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============= I N C L U D E S =============*/
+
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Number of entries in the probe table */
+#define ADI_EVB_PROF_MAX_PROBES 16
+
+/** Statistics of a probe, in CPU cycles */
+typedef struct
+{
+    /** name given to #EvbProfRegister, NULL when the probe is not registered */
+    const char *pName;
+    /** num of measurements */
+    uint32_t count;
+    /** shortest measurement */
+    uint32_t minCycles;
+    /** longest measurement */
+    uint32_t maxCycles;
+    /** sum of all measurements */
+    uint64_t totalCycles;
+} ADI_EVB_PROF_STATS;
+
+/*======= P U B L I C   P R O T O T Y P E S ========*/
+
+/**
+ * @brief Enables the cycle counter and clears the probe table
+ * @return  success or error, error when the core has no cycle counter
+ */
+int32_t EvbProfInit(void);
+
+/**
+ * @brief Names a probe. Probe ids are chosen by the application.
+ * @param[in]  probeId - index in the probe table
+ * @param[in]  pName  - name printed by #EvbProfDump, must remain valid
+ * @return  success or error
+ */
+int32_t EvbProfRegister(uint32_t probeId, const char *pName);
+
+/**
+ * @brief Starts a measurement. A probe measures one section at a time, use separate
+ * probes for code that can preempt itself. Cheap enough to be left in interrupts.
+ * @param[in]  probeId - index in the probe table
+ */
+void EvbProfStart(uint32_t probeId);
+
+/**
+ * @brief Ends the measurement started with #EvbProfStart and adds it to the statistics.
+ * Sections longer than 2^32 cycles are not measured correctly.
+ * @param[in]  probeId - index in the probe table
+ */
+void EvbProfStop(uint32_t probeId);
+
+/**
+ * @brief Gets a consistent copy of the statistics of a probe
+ * @param[in]  probeId - index in the probe table
+ * @param[out] pStats  - statistics of the probe
+ * @return  success or error
+ */
+int32_t EvbProfGetStats(uint32_t probeId, ADI_EVB_PROF_STATS *pStats);
+
+/**
+ * @brief Clears the statistics of all probes, names are kept
+ */
+void EvbProfReset(void);
+
+/**
+ * @brief Prints count, min, max and average cycles of the registered probes through
+ * the message buffer. Call #EvbFlushMessages to send them.
+ * @return  success or error, error if the message buffer is full
+ */
+int32_t EvbProfDump(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADI_EVB_PROF_H__ */
+
+/**
+ * @}
+ */
@@ -24,6 +24,26 @@ extern "C" {
 
 /*=============  D E F I N I T I O N S  =============*/
 
+/** Typedef for the ADE SPI link test used to tune the SPI clock, returns 0 if all reads match */
+typedef int32_t (*ADI_EVB_SPI_LINK_TEST)(void *hEvb, uint32_t numReads);
+
+/**
+ * @brief One access of a burst transfer, typically a single register read.
+ */
+typedef struct
+{
+    /** pointer to the command bytes of the access */
+    uint8_t *pTxData;
+    /** pointer to the destination of the response */
+    uint8_t *pRxData;
+    /** num of bytes in the access */
+    uint32_t numBytes;
+
+} ADI_EVB_SPI_SEGMENT;
+
+/** Callback of a reception checked with #EvbAdeSpiSetRxCrc, status is 0 on success */
+typedef void (*ADI_EVB_SPI_CRC_CALLBACK)(int32_t status, uint32_t crc);
+
 /*======= P U B L I C   P R O T O T Y P E S ========*/
 
 /**
@@ -69,6 +89,59 @@ int32_t EvbAdeSpiTransceiveAsync(void *hEvb, uint8_t *pTxData, uint8_t *pRxData,
 int32_t EvbAdeSpiTransceive(void *hEvb, uint8_t *pTxData, uint8_t *pRxData, uint32_t numBytes,
                             uint32_t timeOutCount);
 
+/**
+ * @brief Deinterleaves ADC frames while they are received. Word j of a received
+ * transfer is written to pRxData + j * rxStride instead of pRxData + j * wordBytes,
+ * where wordBytes is the memory size of a SPI data frame (#EvbAdeSpiSetDataSize).
+ * Receiving frame k of a block to pBase + k * wordBytes then leaves the status, each
+ * channel and the CRC in separate contiguous rows of rxStride bytes. Transmit data is
+ * not affected.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  rxStride - row size in bytes, a multiple of wordBytes, 0 for contiguous reception
+ * @return  success or error, error if unsupported, a transfer is in progress or the stride
+ * is too large for the DMA
+ */
+int32_t EvbAdeSpiSetRxStride(void *hEvb, uint32_t rxStride);
+
+/**
+ * @brief Transfers a list of segments within a single chip select window.
+ * Each segment is started from the DMA completion of the previous one and its response
+ * is written to the segment's own Rx buffer, so non-contiguous registers can be read
+ * without a chip select toggle or a wait per register. The ADE SPI callbacks are called
+ * once, after the last segment. The segment list must remain valid until then.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  pSegments  - pointer to the list of segments
+ * @param[in]  numSegments  - num of segments in the list
+ * @return  success or error
+ */
+int32_t EvbAdeSpiTransceiveBurst(void *hEvb, ADI_EVB_SPI_SEGMENT *pSegments, uint32_t numSegments);
+
+/**
+ * @brief Chains a CRC calculation to the end of each ADE SPI reception. The CRC is
+ * started from the Rx DMA interrupt and pfCallback replaces the Rx callback, so the
+ * received data and its CRC are reported together. A reception error is reported
+ * without a CRC calculation. The CRC runs through #EvbCrcSubmit.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  pContext  - CRC context used for the received data
+ * @param[in]  pData  - first byte to check, usually inside the Rx buffer
+ * @param[in]  numBytes  - num of bytes to check
+ * @param[in]  pfCallback  - called with the CRC of each reception, NULL to disable
+ * @return  success or error, error while the CRC of a reception is in progress
+ */
+int32_t EvbAdeSpiSetRxCrc(void *hEvb, ADI_EVB_CRC_CONTEXT *pContext, uint8_t *pData,
+                          uint32_t numBytes, ADI_EVB_SPI_CRC_CALLBACK pfCallback);
+
+/**
+ * @brief Gets the status of the last completed ADE SPI transfer.
+ * Call from the ADE SPI callbacks to check the transfer. When hardware CRC is enabled
+ * with APP_CFG_ENABLE_ADC_SPI_CRC, the received CRC is checked by the peripheral during
+ * the transfer and a mismatch is reported as #ADI_EVB_STATUS_CRC_ERROR. The blocking
+ * transfer API returns the same status.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @return  #ADI_EVB_STATUS_SUCCESS, #ADI_EVB_STATUS_CRC_ERROR or -1 on other errors
+ */
+int32_t EvbAdeSpiGetXferStatus(void *hEvb);
+
 /**
  * @brief Sets SPI frequency
  * @param[in]  hEvb - Evb handle obtained from EvbInit
@@ -77,8 +150,157 @@ int32_t EvbAdeSpiTransceive(void *hEvb, uint8_t *pTxData, uint8_t *pRxData, uint
  */
 int32_t EvbAdeSpiSetFrequency(void *hEvb, uint32_t spiFrequency);
 
+/**
+ * @brief Computes the SPI clock configuration for a frequency without applying it.
+ * The value can be stored and later applied with #EvbAdeSpiSetClockConfig, which avoids
+ * recomputing the divider on every frequency switch.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  spiFrequency  - frequency in Hz
+ * @param[out] pClkConfig  - pointer to store the clock configuration
+ * @return  success or error
+ */
+int32_t EvbAdeSpiGetClockConfig(void *hEvb, uint32_t spiFrequency, uint32_t *pClkConfig);
+
+/**
+ * @brief Applies a clock configuration obtained from #EvbAdeSpiGetClockConfig.
+ * Only the clock divider is updated, the peripheral is not reinitialised.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  clkConfig  - clock configuration
+ * @return  success or error
+ */
+int32_t EvbAdeSpiSetClockConfig(void *hEvb, uint32_t clkConfig);
+
+/**
+ * @brief Sets the ADE SPI frame size and the number of frames moved per DMA request.
+ * Wider frames and longer bursts reduce the DMA requests needed for multi-byte samples.
+ * Frames wider than 8 bits are stored in native byte order, 24 bit frames occupy 4 bytes.
+ * Buffer lengths passed to the transfer APIs remain in bytes. Transfers that are not a
+ * multiple of the packet, burstLength frames, are rejected where the DMA moves whole packets.
+ * Supported frame sizes depend on the MCU, 8 and 16 are always available. MCUs whose SPI DMA
+ * only moves single frames reject a burstLength other than 1.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  dataSize  - frame size in bits (8, 16, 24 or 32)
+ * @param[in]  burstLength  - frames per DMA request
+ * @return  success or error
+ */
+int32_t EvbAdeSpiSetDataSize(void *hEvb, uint32_t dataSize, uint32_t burstLength);
+
+/**
+ * @brief Prepares an ADE SPI transmit and receive transaction for repeated use.
+ * DMA descriptors and SPI length registers are computed once and stored in a slot, so
+ * that #EvbAdeSpiStartPrepared only has to write them. The buffers must remain valid
+ * while the slot is in use. Slots must be prepared again after #EvbAdeSpiSetDataSize and
+ * #EvbAdeSpiSetFrequency.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  pTxData  - pointer to Tx data
+ * @param[in]  pRxData  - pointer to Rx data
+ * @param[in]  numBytes  - num of bytes to transfer
+ * @param[in]  xferIndex  - slot to store the transaction in
+ * @return  success or error
+ */
+int32_t EvbAdeSpiPrepareTransceive(void *hEvb, uint8_t *pTxData, uint8_t *pRxData,
+                                   uint32_t numBytes, uint32_t xferIndex);
+
+/**
+ * @brief Starts a transaction prepared with #EvbAdeSpiPrepareTransceive.
+ * Completion is reported through the ADE SPI callbacks.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  xferIndex  - slot of the prepared transaction
+ * @return  success or error, error if a transaction is in progress or the slot was
+ * invalidated by a configuration change
+ */
+int32_t EvbAdeSpiStartPrepared(void *hEvb, uint32_t xferIndex);
+
+/**
+ * @brief Finds the fastest reliable ADE SPI clock.
+ * The clock settings are stepped from the fastest towards the board default and the link
+ * test is run at each step. The fastest setting without errors, made slower by the board
+ * margin, is applied. The board default is used if no faster setting passes. The link test
+ * is run again at the applied setting.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  pfLinkTest  - link test, reads a known register or pattern numReads times
+ * @param[in]  numReads  - num of reads per step
+ * @param[out] pClkConfig  - pointer to store the selected clock configuration
+ * @return  success or error, error if the link test fails at the applied setting
+ */
+int32_t EvbAdeSpiTuneFrequency(void *hEvb, ADI_EVB_SPI_LINK_TEST pfLinkTest, uint32_t numReads,
+                               uint32_t *pClkConfig);
+
+/**
+ * @brief Applies the ADE SPI clock cached in NVM or tunes it if there is no valid entry.
+ * A cached clock is checked with a short link test before it is used. A newly tuned
+ * clock is written to NVM for later boots. Called from EvbInit after the GPIO init, the
+ * ADC reset and the ADC start-up time when APP_CFG_ENABLE_ADC_SPI_AUTOTUNE is 1 and a link
+ * test is configured. EvbInit falls back to the board default clock if the tuning fails.
+ * The NVM record is kept at BOARD_CFG_FRAM_SPI_TUNE_ADDR, the last 16 bytes of the FRAM on
+ * app_mcu_h5. That area is reserved and must not be written by the application. The FRAM
+ * SPI callbacks are not called for the accesses to the record.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  pfLinkTest  - link test, reads a known register or pattern numReads times
+ * @return  success or error
+ */
+int32_t EvbAdeSpiAutoTune(void *hEvb, ADI_EVB_SPI_LINK_TEST pfLinkTest);
+
+/**
+ * @brief Sets FRAM SPI frequency
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  spiFrequency  - frequency in Hz
+ * @return  success or error
+ */
+int32_t EvbFramSpiSetFrequency(void *hEvb, uint32_t spiFrequency);
+
+/**
+ * @brief Computes the FRAM SPI clock configuration for a frequency without applying it.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  spiFrequency  - frequency in Hz
+ * @param[out] pClkConfig  - pointer to store the clock configuration
+ * @return  success or error
+ */
+int32_t EvbFramSpiGetClockConfig(void *hEvb, uint32_t spiFrequency, uint32_t *pClkConfig);
+
+/**
+ * @brief Applies a clock configuration obtained from #EvbFramSpiGetClockConfig.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  clkConfig  - clock configuration
+ * @return  success or error
+ */
+int32_t EvbFramSpiSetClockConfig(void *hEvb, uint32_t clkConfig);
+
+/**
+ * @brief Prepares a host SPI transaction in a slot for repeated use. Only for boards where
+ * the MCU is the SPI slave of the host. The buffers must remain valid while the slot is in use.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  pTxData  - pointer to the data sent to the host
+ * @param[in]  pRxData  - pointer to the buffer for the data from the host
+ * @param[in]  numBytes  - num of bytes the host clocks in the transaction
+ * @param[in]  xferIndex  - slot index, less than BOARD_CFG_HOST_SPI_NUM_XFERS
+ * @return  success or error
+ */
+int32_t EvbHostSpiPrepare(void *hEvb, uint8_t *pTxData, uint8_t *pRxData, uint32_t numBytes,
+                          uint32_t xferIndex);
+
+/**
+ * @brief Loads a prepared slot into the DMA and asserts HOST_RDY. HOST_ERR is cleared.
+ * HOST_RDY is released when the host deasserts slave select, then #EvbHostSpiIrqCallback
+ * is called. A transaction that is cut short is aborted and HOST_ERR is asserted.
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  xferIndex  - slot prepared with #EvbHostSpiPrepare
+ * @return  success or error, error if a transaction is already armed
+ */
+int32_t EvbHostSpiArm(void *hEvb, uint32_t xferIndex);
+
+/**
+ * @brief Drives HOST_ERR to report an error to the host
+ * @param[in]  hEvb - Evb handle obtained from EvbInit
+ * @param[in]  error  - 1 to assert HOST_ERR, 0 to release it
+ * @return  success or error
+ */
+int32_t EvbHostSpiSetError(void *hEvb, uint8_t error);
+
 /**
  * @brief Abort spi
+ * Releases HOST_RDY and stops the armed host transaction. #EvbHostSpiIrqCallback is
+ * called with aborted set if a transaction was armed.
  * @return status
  */
 int32_t EvbAbortHostSpi(void);
@@ -0,0 +1,112 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file  adi_evb_swtimer.h
+ * @brief Software timer API header file
+ * @addtogroup    SWTIMER drivers
+ * @{
+ */
+
+#ifndef __ADI_EVB_SWTIMER_H__
+#define __ADI_EVB_SWTIMER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============= I N C L U D E S =============*/
+
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Software timer, the memory is owned by the application */
+typedef struct ADI_EVB_SWTIMER ADI_EVB_SWTIMER;
+
+/** Callback of a software timer, called from the tick interrupt */
+typedef void (*ADI_EVB_SWTIMER_CALLBACK)(ADI_EVB_SWTIMER *pTimer, void *pArg);
+
+/** Software timer, fields are private to the timer wheel */
+struct ADI_EVB_SWTIMER
+{
+    /** callback at expiry */
+    ADI_EVB_SWTIMER_CALLBACK pfCallback;
+    /** argument of the callback */
+    void *pArg;
+    /** tick at which the timer expires */
+    uint32_t expiry;
+    /** reload period in ms, 0 for a one shot timer */
+    uint32_t periodMs;
+    /** next timer in the same slot */
+    ADI_EVB_SWTIMER *pNext;
+    /** link pointing to this timer, NULL when the timer is not running */
+    ADI_EVB_SWTIMER **ppLink;
+};
+
+/*======= P U B L I C   P R O T O T Y P E S ========*/
+
+/**
+ * @brief Starts or restarts a software timer. Timers are kept in a hierarchical wheel
+ * with a 1 ms tick, insertion and expiry are O(1). The tick timer runs only while
+ * timers are active. Requires the system timer to be initialised and started.
+ * @param[in]  pTimer - timer to start
+ * @param[in]  delayMs  - time to the first expiry, at least 1 ms and below 2^31 ms
+ * @param[in]  periodMs  - reload period for periodic timers, 0 for a one shot timer
+ * @param[in]  pfCallback  - called from the tick interrupt at each expiry
+ * @param[in]  pArg  - argument of the callback
+ * @return  success or error
+ */
+int32_t EvbSwTimerStart(ADI_EVB_SWTIMER *pTimer, uint32_t delayMs, uint32_t periodMs,
+                        ADI_EVB_SWTIMER_CALLBACK pfCallback, void *pArg);
+
+/**
+ * @brief Stops a software timer. Its callback is not called after this returns, unless
+ * the call is made from another interrupt that preempted the callback.
+ * @param[in]  pTimer - timer to stop
+ * @return  success or error
+ */
+int32_t EvbSwTimerStop(ADI_EVB_SWTIMER *pTimer);
+
+/**
+ * @brief Gets the state of a software timer
+ * @param[in]  pTimer - timer
+ * @return  1 while the timer is running, 0 otherwise
+ */
+uint8_t EvbSwTimerIsActive(ADI_EVB_SWTIMER *pTimer);
+
+/**
+ * @brief Gets the ticks left until the next timer expiry, for tickless idle. Timers in
+ * the upper levels of the wheel are counted from the tick at which they move down, so
+ * the result can be earlier than the expiry but never later.
+ * @return  ticks of 1 ms until the next expiry, 0xFFFFFFFF when no timer runs
+ */
+uint32_t EvbSwTimerGetIdleTicks(void);
+
+/**
+ * @brief Starts the 1 ms tick interrupt that calls #EvbSwTimerTick.
+ * Implemented by the board.
+ */
+void EvbStartTickTimer(void);
+
+/**
+ * @brief Stops the tick interrupt. Implemented by the board.
+ */
+void EvbStopTickTimer(void);
+
+/* Following is called by the board tick interrupt */
+/**
+ * @brief Advances the timer wheel by one tick and calls the expired callbacks
+ */
+void EvbSwTimerTick(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ADI_EVB_SWTIMER_H__ */
+
+/**
+ * @}
+ */
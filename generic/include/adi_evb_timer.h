@@ -23,20 +23,86 @@ extern "C" {
 
 /*=============  D E F I N I T I O N S  =============*/
 
+/** Num of 32 bit words in #ADI_EVB_CF_PERIOD */
+#define ADI_EVB_CF_BURST_WORDS 6
+
+/**
+ * Timer values of one CF period. The layout follows the timer registers from the
+ * auto-reload register, so that a period is written by one DMA burst.
+ */
+typedef struct
+{
+    /** timer count when the period ends */
+    uint32_t endCount;
+    /** unused, keeps the register layout */
+    uint32_t reserved;
+    /** timer count when the pulse is triggered, for each timer channel. The CF outputs are
+     * at BOARD_CFG_CF1_PERIOD_IDX, BOARD_CFG_CF2_PERIOD_IDX and BOARD_CFG_CF3_PERIOD_IDX */
+    uint32_t startCount[4];
+} ADI_EVB_CF_PERIOD;
+
+/**
+ * Called from the DMA interrupt when the last period of a buffer is loaded.
+ * Returns the next buffer and writes its num of periods, NULL to repeat the last period.
+ */
+typedef ADI_EVB_CF_PERIOD *(*ADI_EVB_CF_BURST_CALLBACK)(uint32_t *pNumPeriods);
+
+/** Pulse input index of CF1 */
+#define ADI_EVB_PULSE_INPUT_CF1 0
+/** Pulse input index of CF2 */
+#define ADI_EVB_PULSE_INPUT_CF2 1
+/** Num of pulse inputs */
+#define ADI_EVB_NUM_PULSE_INPUTS 2
+
+/**
+ * Called from the timer interrupt each time a pulse input has counted the threshold.
+ * Gets the input index and the num of pulses counted since the start.
+ */
+typedef void (*ADI_EVB_PULSE_CALLBACK)(uint32_t idx, uint32_t numPulses);
+
 /*======= P U B L I C   P R O T O T Y P E S ========*/
 
 /**
- * @brief get timer value
- * @return 0 -  success
+ * @brief Gets the system time in microseconds. The value wraps after #EvbGetMaxTime.
+ * @return time in us
  */
 uint32_t EvbGetTime(void);
 
 /**
- * @brief get maximum timer value
- * @return 0 -  success
+ * @brief Gets the largest value returned by #EvbGetTime before it wraps
+ * @return time in us
  */
 uint32_t EvbGetMaxTime(void);
 
+/**
+ * @brief Gets the system time in timer ticks, extended to 64 bits so that it does not
+ * wrap. Overflows of the hardware counter are counted in the timer interrupt, or by
+ * this call when the interrupt is not used; it must then be called at least once per
+ * counter period. Safe to call from interrupts.
+ * @return ticks since #EvbStartTimer
+ */
+uint64_t EvbGetTime64(void);
+
+/**
+ * @brief Gets the tick rate of #EvbGetTime64
+ * @return frequency in Hz
+ */
+uint32_t EvbGetTimerFrequency(void);
+
+/**
+ * @brief Converts system timer ticks to nanoseconds with a fixed point reciprocal
+ * @param[in] ticks - ticks from #EvbGetTime64
+ * @return time in ns
+ */
+uint64_t EvbTicksToNs(uint64_t ticks);
+
+/**
+ * @brief Converts system timer ticks to microseconds with a fixed point reciprocal
+ * @param[in] ticks - ticks from #EvbGetTime64
+ * @return time in us
+ */
+uint64_t EvbTicksToUs(uint64_t ticks);
+
 /**
  * @brief  start timer
  */
@@ -88,6 +154,81 @@ void EvbStartCf1Timer(uint32_t startCount, uint32_t endCount);
  */
 void EvbStopCf1Timer(void);
 
+/**
+ * @brief Starts the CF outputs from a buffer of precomputed periods. Each period is
+ * loaded by DMA at the update event of the previous one, so there is no interrupt per
+ * pulse. The CF timer interrupt is disabled until #EvbStopCfBurst.
+ * @param[in] pPeriods    - periods to play, must remain valid until the callback
+ * @param[in] numPeriods  - num of periods in the buffer
+ * @param[in] pfCallback  - called for the next buffer, NULL to repeat the last period.
+ *                          Needs at least two periods on the STM32H5.
+ * @return 0 -  success
+ */
+int32_t EvbStartCfBurst(ADI_EVB_CF_PERIOD *pPeriods, uint32_t numPeriods,
+                        ADI_EVB_CF_BURST_CALLBACK pfCallback);
+
+/**
+ * @brief Stops the CF outputs started with #EvbStartCfBurst and returns the CF timer to
+ * one period at a time updates
+ */
+void EvbStopCfBurst(void);
+
+/**
+ * @brief Starts capturing the system timer count at each DREADY edge. The timer captures
+ * the edge in hardware and DMA writes the count to a ring, so no interrupt runs per edge.
+ * Entry n of the ring holds the count of DREADY edge n, modulo numEntries, counted from
+ * this call. Requires DREADY to be routed to a capture input of the system timer.
+ * @param[in] pRing       - ring of captured counts, must remain valid until
+ * #EvbStopDreadyCapture
+ * @param[in] numEntries  - num of entries in the ring
+ * @return 0 -  success
+ */
+int32_t EvbStartDreadyCapture(uint32_t *pRing, uint32_t numEntries);
+
+/**
+ * @brief Stops the DREADY capture started with #EvbStartDreadyCapture
+ */
+void EvbStopDreadyCapture(void);
+
+/**
+ * @brief Gets the num of DREADY edges captured since #EvbStartDreadyCapture. The count of
+ * the last edge is at index (num - 1) modulo the ring size.
+ * @return num of captured edges
+ */
+uint32_t EvbGetDreadyCaptureCount(void);
+
+/**
+ * @brief Converts a captured count to the time of #EvbGetTime64. The capture must be
+ * less than one counter period old.
+ * @param[in] count  - count read from the capture ring
+ * @return ticks since #EvbStartTimer
+ */
+uint64_t EvbCaptureToTime64(uint32_t count);
+
+/**
+ * @brief Starts counting the pulses of a CF input in a hardware timer. The GPIO interrupt
+ * of the input is not used, the timer interrupts once every threshold pulses.
+ * @param[in] idx         - pulse input, #ADI_EVB_PULSE_INPUT_CF1 or #ADI_EVB_PULSE_INPUT_CF2
+ * @param[in] threshold   - num of pulses between callbacks
+ * @param[in] pfCallback  - called every threshold pulses, NULL to only count
+ * @return 0 -  success
+ */
+int32_t EvbStartPulseCount(uint32_t idx, uint32_t threshold, ADI_EVB_PULSE_CALLBACK pfCallback);
+
+/**
+ * @brief Stops counting the pulses of a CF input
+ * @param[in] idx  - pulse input
+ */
+void EvbStopPulseCount(uint32_t idx);
+
+/**
+ * @brief Gets the num of pulses counted since #EvbStartPulseCount. Safe to call from
+ * interrupts.
+ * @param[in] idx  - pulse input
+ * @return num of pulses
+ */
+uint32_t EvbGetPulseCount(uint32_t idx);
+
 /**
  * @brief Set the LPTIM output pin to be used for TDM
  */
@@ -0,0 +1,53 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file  sw_crc_tables.h
+ * @brief Precomputed slice tables of the software CRC, internal to sw_crc.c
+ * @{
+ */
+
+#ifndef __SW_CRC_TABLES_H__
+#define __SW_CRC_TABLES_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*============= I N C L U D E S =============*/
+
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Number of tables used by the slice-by-4 loop */
+#define SW_CRC_NUM_SLICES 4u
+/** Number of polynomials with precomputed tables */
+#define SW_CRC_NUM_TABLES 4u
+
+/** Slice tables of one polynomial, table k holds the CRC of a byte followed by k zero bytes */
+typedef struct
+{
+    /** polynomial aligned as the CRC register, right when reflected, left otherwise */
+    uint32_t regPoly;
+    /** 1 for the reflected (LSB first) form */
+    uint8_t reflectIn;
+    /** slice tables */
+    const uint32_t (*pTable)[256];
+} SW_CRC_TABLE;
+
+/*=============  D A T A  =============*/
+
+/** Tables of the catalogue polynomials, see sw_crc_tables.c */
+extern const SW_CRC_TABLE swCrcTables[SW_CRC_NUM_TABLES];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __SW_CRC_TABLES_H__ */
+
+/**
+ * @}
+ */
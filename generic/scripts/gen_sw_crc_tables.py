@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+# Copyright (c) 2024 - 2025  Analog Devices Inc.
+"""Generates generic/source/sw_crc_tables.c, the slice tables of the catalogue CRCs.
+
+Usage: python3 gen_sw_crc_tables.py > ../source/sw_crc_tables.c
+"""
+
+NUM_SLICES = 4
+ENTRIES_PER_LINE = 6
+
+# name, width, polynomial in normal form, 1 for the reflected form
+CATALOGUE = [
+    ("Crc32Reflected", 32, 0x04C11DB7, 1),
+    ("Crc16Normal", 16, 0x1021, 0),
+    ("Crc16Reflected", 16, 0x1021, 1),
+    ("Crc8Normal", 8, 0x07, 0),
+]
+
+
+def reflect(value, num_bits):
+    result = 0
+    for i in range(num_bits):
+        result = (result << 1) | ((value >> i) & 1)
+    return result
+
+
+def register_poly(num_bits, poly, reflected):
+    if reflected:
+        return reflect(poly, num_bits)
+    return (poly << (32 - num_bits)) & 0xFFFFFFFF
+
+
+def build_tables(reg_poly, reflected):
+    table0 = []
+    for i in range(256):
+        if reflected:
+            crc = i
+            for _ in range(8):
+                crc = (crc >> 1) ^ reg_poly if crc & 1 else crc >> 1
+        else:
+            crc = i << 24
+            for _ in range(8):
+                crc = ((crc << 1) ^ reg_poly if crc & 0x80000000 else crc << 1) & 0xFFFFFFFF
+        table0.append(crc)
+    tables = [table0]
+    for _ in range(1, NUM_SLICES):
+        prev = tables[-1]
+        if reflected:
+            tables.append([(p >> 8) ^ table0[p & 0xFF] for p in prev])
+        else:
+            tables.append([((p << 8) & 0xFFFFFFFF) ^ table0[p >> 24] for p in prev])
+    return tables
+
+
+def main():
+    out = []
+    out.append("/" + "*" * 78)
+    out.append(" Copyright (c) 2024 - 2025  Analog Devices Inc.")
+    out.append("*" * 78 + "/")
+    out.append("")
+    out.append("/**")
+    out.append(" * @file     sw_crc_tables.c")
+    out.append(" * @brief    Slice tables of the catalogue CRCs, in the register alignment of sw_crc.c.")
+    out.append(" *           Generated by generic/scripts/gen_sw_crc_tables.py, do not edit.")
+    out.append(" * @{")
+    out.append(" */")
+    out.append("")
+    out.append("/*=============  I N C L U D E S   =============*/")
+    out.append("")
+    out.append('#include "sw_crc_tables.h"')
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("/*=============  D A T A  =============*/")
+    entries = []
+    for name, num_bits, poly, reflected in CATALOGUE:
+        reg_poly = register_poly(num_bits, poly, reflected)
+        tables = build_tables(reg_poly, reflected)
+        var = "table" + name
+        entries.append((reg_poly, reflected, var))
+        out.append("")
+        form = "reflected" if reflected else "normal"
+        out.append("/** Polynomial 0x%0*X, %d bits, %s form */" % (num_bits // 4, poly, num_bits, form))
+        out.append("static const uint32_t %s[SW_CRC_NUM_SLICES][256] = {" % var)
+        for table in tables:
+            out.append("    {")
+            for i in range(0, 256, ENTRIES_PER_LINE):
+                row = table[i:i + ENTRIES_PER_LINE]
+                out.append("        " + " ".join("0x%08Xu," % v for v in row))
+            out.append("    },")
+        out.append("};")
+    out.append("")
+    out.append("const SW_CRC_TABLE swCrcTables[SW_CRC_NUM_TABLES] = {")
+    for reg_poly, reflected, var in entries:
+        out.append("    {0x%08Xu, %d, %s}," % (reg_poly, reflected, var))
+    out.append("};")
+    out.append("")
+    out.append("/**")
+    out.append(" * @}")
+    out.append(" */")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,210 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     crc_queue.c
+ * @brief    CRC contexts and job queue on top of the CRC driver. Built together with
+ *           the CRC driver of a board.
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+
+#include "adi_evb.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** CRC job queue */
+typedef struct
+{
+    /** Evb handle of the CRC driver */
+    void *hEvb;
+    /** first pending job */
+    ADI_EVB_CRC_JOB *pHead;
+    /** last pending job */
+    ADI_EVB_CRC_JOB *pTail;
+    /** job owning the CRC unit, NULL when idle */
+    ADI_EVB_CRC_JOB *volatile pActive;
+    /** context the CRC unit is configured for, NULL when unknown */
+    ADI_EVB_CRC_CONTEXT *pLoaded;
+} EVB_CRC_QUEUE;
+
+/*=============  D A T A  =============*/
+
+static EVB_CRC_QUEUE evbCrcQueue;
+
+/*============= F U N C T I O N S =============*/
+
+/** Starts a job, and the following ones if a job fails to start */
+static void StartJob(ADI_EVB_CRC_JOB *pJob);
+
+/** Saves the context of a job, claims the next job and calls the job callback */
+static ADI_EVB_CRC_JOB *FinishJob(ADI_EVB_CRC_JOB *pJob, int32_t status);
+
+/*=============  C O D E  =============*/
+
+int32_t EvbCrcContextInit(ADI_EVB_CRC_CONTEXT *pContext, ADI_EVB_CRC_PARAMS *pParams)
+{
+    int32_t status = -1;
+
+    if ((pContext != NULL) && (pParams != NULL))
+    {
+        pContext->params = *pParams;
+        pContext->state = 0;
+        pContext->value = 0;
+        pContext->isNew = 1;
+        if (evbCrcQueue.pLoaded == pContext)
+        {
+            // Parameters may have changed, reconfigure on the next job
+            evbCrcQueue.pLoaded = NULL;
+        }
+        status = 0;
+    }
+
+    return status;
+}
+
+int32_t EvbCrcSubmit(void *hEvb, ADI_EVB_CRC_JOB *pJob)
+{
+    int32_t status = -1;
+    uint32_t state;
+    ADI_EVB_CRC_JOB *pStart = NULL;
+
+    if ((hEvb != NULL) && (pJob != NULL) && (pJob->pContext != NULL) && (pJob->pData != NULL) &&
+        (pJob->numBytes > 0))
+    {
+        pJob->pNext = NULL;
+        state = EvbEnterCritical();
+        evbCrcQueue.hEvb = hEvb;
+        if (evbCrcQueue.pActive == NULL)
+        {
+            // Claim the idle unit so that no other submitter starts a job
+            evbCrcQueue.pActive = pJob;
+            pStart = pJob;
+        }
+        else if (evbCrcQueue.pTail == NULL)
+        {
+            evbCrcQueue.pHead = pJob;
+            evbCrcQueue.pTail = pJob;
+        }
+        else
+        {
+            evbCrcQueue.pTail->pNext = pJob;
+            evbCrcQueue.pTail = pJob;
+        }
+        EvbExitCritical(state);
+        StartJob(pStart);
+        status = 0;
+    }
+
+    return status;
+}
+
+uint8_t EvbCrcJobIrqCallback(uint8_t error)
+{
+    uint8_t isJob = 0;
+    ADI_EVB_CRC_JOB *pNext;
+
+    if (evbCrcQueue.pActive != NULL)
+    {
+        isJob = 1;
+        pNext = FinishJob(evbCrcQueue.pActive, (error == 0) ? 0 : -1);
+        StartJob(pNext);
+    }
+
+    return isJob;
+}
+
+void StartJob(ADI_EVB_CRC_JOB *pJob)
+{
+    int32_t status;
+    void *hEvb = evbCrcQueue.hEvb;
+    ADI_EVB_CRC_CONTEXT *pContext;
+
+    while (pJob != NULL)
+    {
+        status = 0;
+        pContext = pJob->pContext;
+        if (evbCrcQueue.pLoaded != pContext)
+        {
+            evbCrcQueue.pLoaded = NULL;
+            status = EvbCrcConfigure(hEvb, &pContext->params);
+            if (status == 0)
+            {
+                evbCrcQueue.pLoaded = pContext;
+            }
+        }
+        if ((status == 0) && (pContext->isNew == 1))
+        {
+            status = EvbCrcStart(hEvb);
+        }
+        else if (status == 0)
+        {
+            status = EvbCrcRestoreState(hEvb, pContext->state);
+        }
+        if (status == 0)
+        {
+            status = EvbCrcAccumulate(hEvb, pJob->pData, pJob->numBytes);
+        }
+        if (status == 0)
+        {
+            // The driver completes the job through EvbCrcJobIrqCallback
+            pJob = NULL;
+        }
+        else
+        {
+            pJob = FinishJob(pJob, status);
+        }
+    }
+}
+
+ADI_EVB_CRC_JOB *FinishJob(ADI_EVB_CRC_JOB *pJob, int32_t status)
+{
+    uint32_t state;
+    void *hEvb = evbCrcQueue.hEvb;
+    ADI_EVB_CRC_CONTEXT *pContext = pJob->pContext;
+    ADI_EVB_CRC_JOB *pNext;
+
+    if (status == 0)
+    {
+        status = EvbCrcSaveState(hEvb, &pContext->state);
+    }
+    if (status == 0)
+    {
+        status = EvbCrcFinalise(hEvb, &pContext->value);
+    }
+    if (status == 0)
+    {
+        pContext->isNew = 0;
+    }
+    state = EvbEnterCritical();
+    pNext = evbCrcQueue.pHead;
+    if (pNext != NULL)
+    {
+        evbCrcQueue.pHead = pNext->pNext;
+        if (evbCrcQueue.pHead == NULL)
+        {
+            evbCrcQueue.pTail = NULL;
+        }
+    }
+    else
+    {
+        // Idle, the unit may be used directly until the next job
+        evbCrcQueue.pLoaded = NULL;
+    }
+    evbCrcQueue.pActive = pNext;
+    EvbExitCritical(state);
+    if (pJob->pfCallback != NULL)
+    {
+        pJob->pfCallback(pJob, status);
+    }
+
+    return pNext;
+}
+
+/**
+ * @}
+ */
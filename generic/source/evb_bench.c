@@ -0,0 +1,344 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     evb_bench.c
+ * @brief    Benchmarks of the board drivers. Each method is run the same number of
+ *           times and measured with its own profiling probe.
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+
+#include "adi_evb.h"
+#include "app_cfg.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Evb bench info */
+typedef struct
+{
+    /** probe stopped by the completion callback */
+    uint32_t doneProbeId;
+    /** status given to the completion callback */
+    volatile int32_t status;
+    /** set by the completion callback */
+    volatile uint8_t isDone;
+    /** set while a benchmarked spi transfer is waiting for #EvbBenchAdeSpiRxDone */
+    volatile uint8_t isSpiPending;
+    /** segment of the benchmarked spi transfer */
+    ADI_EVB_SPI_SEGMENT spiSegment;
+} EVB_BENCH_INFO;
+
+/*=============  D A T A  =============*/
+
+static EVB_BENCH_INFO evbBenchInfo;
+
+/*============= F U N C T I O N S =============*/
+
+#if APP_CFG_ENABLE_MEM_DMA == 1
+/** Completion of a benchmarked DMA copy */
+static void BenchMemDone(int32_t status);
+#endif /* APP_CFG_ENABLE_MEM_DMA */
+
+#if APP_CFG_ENABLE_HW_CRC == 1
+/** Completion of a benchmarked CRC job */
+static void BenchCrcDone(ADI_EVB_CRC_JOB *pJob, int32_t status);
+
+/** Bit at a time CRC, the reference of the CRC benchmark */
+static uint32_t BitwiseCrc(const ADI_EVB_CRC_PARAMS *pParams, const uint8_t *pData,
+                           uint32_t numBytes);
+
+/** Reflects the low numBits bits of a value */
+static uint32_t ReflectBits(uint32_t value, uint32_t numBits);
+#endif /* APP_CFG_ENABLE_HW_CRC */
+
+#if APP_CFG_ENABLE_SPI == 1
+/** Runs the spi transfers of one configuration, measured with probeId */
+static int32_t BenchSpiRuns(void *hEvb, uint32_t numRuns, uint32_t timeOutCount,
+                            uint32_t probeId);
+#endif /* APP_CFG_ENABLE_SPI */
+
+/*=============  C O D E  =============*/
+
+int32_t EvbBenchMemcpy(void *hEvb, void *pDst, const void *pSrc, uint32_t numBytes,
+                       uint32_t numRuns, uint32_t probeId)
+{
+    int32_t status = -1;
+#if APP_CFG_ENABLE_MEM_DMA == 1
+    uint32_t run;
+
+    if ((hEvb != NULL) && (pDst != NULL) && (pSrc != NULL) &&
+        (probeId + ADI_EVB_BENCH_MEMCPY_PROBES <= ADI_EVB_PROF_MAX_PROBES))
+    {
+        status = EvbProfRegister(probeId, "memcpy cpu");
+        status |= EvbProfRegister(probeId + 1, "memcpy dma start");
+        status |= EvbProfRegister(probeId + 2, "memcpy dma total");
+        evbBenchInfo.doneProbeId = probeId + 2;
+        for (run = 0; (run < numRuns) && (status == 0); run++)
+        {
+            EvbProfStart(probeId);
+            memcpy(pDst, pSrc, numBytes);
+            EvbProfStop(probeId);
+
+            evbBenchInfo.isDone = 0;
+            EvbProfStart(probeId + 2);
+            EvbProfStart(probeId + 1);
+            status = EvbMemcpyAsync(hEvb, pDst, pSrc, numBytes, BenchMemDone);
+            EvbProfStop(probeId + 1);
+            while ((status == 0) && (evbBenchInfo.isDone == 0))
+            {
+            }
+            if (status == 0)
+            {
+                status = EvbMemGetStatus(hEvb);
+            }
+        }
+    }
+#else
+    (void)hEvb;
+    (void)pDst;
+    (void)pSrc;
+    (void)numBytes;
+    (void)numRuns;
+    (void)probeId;
+    (void)evbBenchInfo;
+#endif /* APP_CFG_ENABLE_MEM_DMA */
+
+    return status;
+}
+
+int32_t EvbBenchCrc(void *hEvb, ADI_EVB_CRC_PARAMS *pParams, uint8_t *pData, uint32_t numBytes,
+                    uint32_t numRuns, uint32_t probeId)
+{
+    int32_t status = -1;
+#if APP_CFG_ENABLE_HW_CRC == 1
+    uint32_t run;
+    uint32_t bitwiseCrc = 0;
+    ADI_EVB_CRC_CONTEXT context;
+    ADI_EVB_CRC_JOB job;
+
+    if ((hEvb != NULL) && (pParams != NULL) && (pData != NULL) && (numBytes > 0) &&
+        (probeId + ADI_EVB_BENCH_CRC_PROBES <= ADI_EVB_PROF_MAX_PROBES))
+    {
+        status = EvbProfRegister(probeId, "crc api");
+        status |= EvbProfRegister(probeId + 1, "crc bitwise");
+        evbBenchInfo.doneProbeId = probeId;
+        for (run = 0; (run < numRuns) && (status == 0); run++)
+        {
+            status = EvbCrcContextInit(&context, pParams);
+            job.pContext = &context;
+            job.pData = pData;
+            job.numBytes = numBytes;
+            job.pfCallback = BenchCrcDone;
+            evbBenchInfo.isDone = 0;
+            if (status == 0)
+            {
+                EvbProfStart(probeId);
+                status = EvbCrcSubmit(hEvb, &job);
+            }
+            while ((status == 0) && (evbBenchInfo.isDone == 0))
+            {
+            }
+
+            EvbProfStart(probeId + 1);
+            bitwiseCrc = BitwiseCrc(pParams, pData, numBytes);
+            EvbProfStop(probeId + 1);
+
+            if ((status == 0) && (evbBenchInfo.status != 0))
+            {
+                status = evbBenchInfo.status;
+            }
+            if ((status == 0) && (context.value != bitwiseCrc))
+            {
+                status = ADI_EVB_STATUS_CRC_ERROR;
+            }
+        }
+    }
+#else
+    (void)hEvb;
+    (void)pParams;
+    (void)pData;
+    (void)numBytes;
+    (void)numRuns;
+    (void)probeId;
+#endif /* APP_CFG_ENABLE_HW_CRC */
+
+    return status;
+}
+
+int32_t EvbBenchAdeSpi(void *hEvb, uint8_t *pTxData, uint8_t *pRxData, uint32_t numBytes,
+                       uint32_t dataSize, uint32_t burstLength, uint32_t numRuns,
+                       uint32_t timeOutCount, uint32_t probeId)
+{
+    int32_t status = -1;
+#if APP_CFG_ENABLE_SPI == 1
+    if ((hEvb != NULL) && (pTxData != NULL) && (pRxData != NULL) &&
+        (probeId + ADI_EVB_BENCH_SPI_PROBES <= ADI_EVB_PROF_MAX_PROBES))
+    {
+        status = EvbProfRegister(probeId, "spi 8 bit x1");
+        status |= EvbProfRegister(probeId + 1, "spi packed");
+        evbBenchInfo.spiSegment.pTxData = pTxData;
+        evbBenchInfo.spiSegment.pRxData = pRxData;
+        evbBenchInfo.spiSegment.numBytes = numBytes;
+        if (status == 0)
+        {
+            status = EvbAdeSpiSetDataSize(hEvb, 8, 1);
+        }
+        if (status == 0)
+        {
+            status = BenchSpiRuns(hEvb, numRuns, timeOutCount, probeId);
+        }
+        if (status == 0)
+        {
+            status = EvbAdeSpiSetDataSize(hEvb, dataSize, burstLength);
+        }
+        if (status == 0)
+        {
+            status = BenchSpiRuns(hEvb, numRuns, timeOutCount, probeId + 1);
+        }
+        if (evbBenchInfo.isSpiPending == 0)
+        {
+            /* A transfer still pending keeps its frame size until it times out in the driver */
+            (void)EvbAdeSpiSetDataSize(hEvb, 8, 1);
+        }
+    }
+#else
+    (void)hEvb;
+    (void)pTxData;
+    (void)pRxData;
+    (void)numBytes;
+    (void)dataSize;
+    (void)burstLength;
+    (void)numRuns;
+    (void)timeOutCount;
+    (void)probeId;
+#endif /* APP_CFG_ENABLE_SPI */
+
+    return status;
+}
+
+void EvbBenchAdeSpiRxDone(void)
+{
+    if (evbBenchInfo.isSpiPending == 1)
+    {
+        EvbProfStop(evbBenchInfo.doneProbeId);
+        evbBenchInfo.isSpiPending = 0;
+    }
+}
+
+#if APP_CFG_ENABLE_SPI == 1
+int32_t BenchSpiRuns(void *hEvb, uint32_t numRuns, uint32_t timeOutCount, uint32_t probeId)
+{
+    int32_t status = 0;
+    uint32_t run;
+    uint32_t waitCount;
+
+    evbBenchInfo.doneProbeId = probeId;
+    for (run = 0; (run < numRuns) && (status == 0); run++)
+    {
+        waitCount = 0;
+        evbBenchInfo.isSpiPending = 1;
+        EvbProfStart(probeId);
+        status = EvbAdeSpiTransceiveBurst(hEvb, &evbBenchInfo.spiSegment, 1);
+        while ((status == 0) && (evbBenchInfo.isSpiPending == 1) && (waitCount < timeOutCount))
+        {
+            waitCount++;
+        }
+        if (status != 0)
+        {
+            evbBenchInfo.isSpiPending = 0;
+        }
+        else if (evbBenchInfo.isSpiPending == 1)
+        {
+            status = -1;
+        }
+        else
+        {
+            status = EvbAdeSpiGetXferStatus(hEvb);
+        }
+    }
+
+    return status;
+}
+#endif /* APP_CFG_ENABLE_SPI */
+
+#if APP_CFG_ENABLE_MEM_DMA == 1
+void BenchMemDone(int32_t status)
+{
+    (void)status;
+    EvbProfStop(evbBenchInfo.doneProbeId);
+    evbBenchInfo.isDone = 1;
+}
+#endif /* APP_CFG_ENABLE_MEM_DMA */
+
+#if APP_CFG_ENABLE_HW_CRC == 1
+void BenchCrcDone(ADI_EVB_CRC_JOB *pJob, int32_t status)
+{
+    (void)pJob;
+    EvbProfStop(evbBenchInfo.doneProbeId);
+    evbBenchInfo.status = status;
+    evbBenchInfo.isDone = 1;
+}
+
+uint32_t BitwiseCrc(const ADI_EVB_CRC_PARAMS *pParams, const uint8_t *pData, uint32_t numBytes)
+{
+    uint32_t numBits = 8;
+    uint32_t mask;
+    uint32_t topBit;
+    uint32_t crc;
+    uint32_t value;
+    uint32_t bit;
+
+    if (pParams->crcType == ADI_EVB_CRC_TYPE_CRC16)
+    {
+        numBits = 16;
+    }
+    else if (pParams->crcType == ADI_EVB_CRC_TYPE_CRC32)
+    {
+        numBits = 32;
+    }
+    mask = 0xFFFFFFFFu >> (32 - numBits);
+    topBit = 1u << (numBits - 1);
+    crc = pParams->seed & mask;
+    while (numBytes > 0)
+    {
+        value = (pParams->reflectIn == 1) ? ReflectBits(*pData, 8) : *pData;
+        crc ^= value << (numBits - 8);
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = ((crc & topBit) != 0) ? ((crc << 1) ^ pParams->polynomial) : (crc << 1);
+        }
+        crc &= mask;
+        pData++;
+        numBytes--;
+    }
+    if (pParams->reflectOut == 1)
+    {
+        crc = ReflectBits(crc, numBits);
+    }
+
+    return (crc ^ pParams->finalXor) & mask;
+}
+
+uint32_t ReflectBits(uint32_t value, uint32_t numBits)
+{
+    uint32_t reflected = 0;
+    uint32_t i;
+
+    for (i = 0; i < numBits; i++)
+    {
+        reflected = (reflected << 1) | ((value >> i) & 1u);
+    }
+
+    return reflected;
+}
+#endif /* APP_CFG_ENABLE_HW_CRC */
+
+/**
+ * @}
+ */
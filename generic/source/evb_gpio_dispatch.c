@@ -0,0 +1,144 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     evb_gpio_dispatch.c
+ * @brief    Per pin GPIO callbacks. The pending pins of an interrupt are walked one set
+ *           bit at a time, the index of a bit is found from a lookup table.
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+
+#include "adi_evb.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Multiplier mapping each single bit to a distinct 5 bit table index */
+#define GPIO_DEBRUIJN_MULT 0x077CB531u
+/** Shift leaving the 5 bit table index */
+#define GPIO_DEBRUIJN_SHIFT 27u
+
+/** Callback of a pin */
+typedef struct
+{
+    /** callback, NULL if the pin has none */
+    ADI_EVB_PIN_CALLBACK pfCallback;
+    /** argument of the callback */
+    void *pArg;
+    /** port of the pin */
+    uint32_t port;
+} EVB_PIN_HANDLER;
+
+/** Evb gpio dispatch info */
+typedef struct
+{
+    /** callbacks indexed by pin number, a pin number is used by one port only */
+    EVB_PIN_HANDLER handlers[ADI_EVB_GPIO_MAX_PINS];
+    /** pins of the fast group */
+    volatile uint32_t fastPins;
+} EVB_GPIO_DISPATCH_INFO;
+
+/*=============  D A T A  =============*/
+
+static EVB_GPIO_DISPATCH_INFO evbGpioDispatchInfo;
+
+/** Pin number of a single bit, indexed by the top bits of the bit times the multiplier */
+static const uint8_t pinNumbers[ADI_EVB_GPIO_MAX_PINS] = {
+    0,  1,  28, 2,  29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4,  8,
+    31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6,  11, 5,  10, 9};
+
+/*============= F U N C T I O N S =============*/
+
+static uint32_t PinNumber(uint32_t pin);
+
+static uint32_t DispatchPins(uint32_t port, uint32_t pins);
+
+/*=============  C O D E  =============*/
+
+int32_t EvbRegisterPinCallback(uint32_t port, uint32_t pin, ADI_EVB_GPIO_GROUP group,
+                               ADI_EVB_PIN_CALLBACK pfCallback, void *pArg)
+{
+    int32_t status = ADI_EVB_STATUS_INVALID_INDEX;
+    uint32_t state;
+    EVB_PIN_HANDLER *pHandler;
+
+    if ((pin != 0) && ((pin & (pin - 1u)) == 0))
+    {
+        pHandler = &evbGpioDispatchInfo.handlers[PinNumber(pin)];
+        state = EvbEnterCritical();
+        // A pin number has one entry, it is owned by the port holding its callback
+        if ((pHandler->pfCallback == NULL) || (pHandler->port == port))
+        {
+            pHandler->pfCallback = pfCallback;
+            pHandler->pArg = pArg;
+            pHandler->port = port;
+            if ((group == ADI_EVB_GPIO_GROUP_FAST) && (pfCallback != NULL))
+            {
+                evbGpioDispatchInfo.fastPins |= pin;
+            }
+            else
+            {
+                evbGpioDispatchInfo.fastPins &= ~pin;
+            }
+            status = ADI_EVB_STATUS_SUCCESS;
+        }
+        EvbExitCritical(state);
+    }
+
+    return status;
+}
+
+uint32_t EvbGpioDispatch(uint32_t port, uint32_t pending)
+{
+    uint32_t fastPins = pending & evbGpioDispatchInfo.fastPins;
+    uint32_t unhandled;
+
+    unhandled = DispatchPins(port, fastPins);
+    unhandled |= DispatchPins(port, pending & ~fastPins);
+
+    return unhandled;
+}
+
+uint32_t EvbGpioDispatchPin(uint32_t port, uint32_t pin)
+{
+    EVB_PIN_HANDLER *pHandler = &evbGpioDispatchInfo.handlers[PinNumber(pin)];
+    uint32_t unhandled = pin;
+
+    if ((pHandler->pfCallback != NULL) && (pHandler->port == port))
+    {
+        pHandler->pfCallback(port, pin, pHandler->pArg);
+        unhandled = 0;
+    }
+
+    return unhandled;
+}
+
+static uint32_t PinNumber(uint32_t pin)
+{
+    // Only the lowest set bit is looked up
+    uint32_t lowest = pin & (~pin + 1u);
+    return pinNumbers[(lowest * GPIO_DEBRUIJN_MULT) >> GPIO_DEBRUIJN_SHIFT];
+}
+
+static uint32_t DispatchPins(uint32_t port, uint32_t pins)
+{
+    uint32_t unhandled = 0;
+    uint32_t pin;
+
+    while (pins != 0)
+    {
+        pin = pins & (~pins + 1u);
+        pins &= pins - 1u;
+        unhandled |= EvbGpioDispatchPin(port, pin);
+    }
+
+    return unhandled;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,263 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     evb_idle.c
+ * @brief    Tickless low power idle. The idle time is bounded by the next software
+ *           timer expiry and the expected DREADY, the board wake timer ends the sleep.
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+
+#include "adi_evb.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Microseconds in a second */
+#define IDLE_US_PER_SEC 1000000u
+/** Microseconds in a software timer tick */
+#define IDLE_US_PER_TICK 1000u
+
+/** Evb idle info */
+typedef struct
+{
+    /** configuration */
+    ADI_EVB_IDLE_CONFIG config;
+    /** statistics, the times are kept in ticks below */
+    ADI_EVB_IDLE_STATS stats;
+    /** system timer ticks in low power modes */
+    uint64_t asleepTicks;
+    /** system time at which the statistics were cleared */
+    uint64_t statsStartTicks;
+    /** system time of the last DREADY */
+    volatile uint64_t dreadyTicks;
+    /** DREADY period in system timer ticks, 0 when the ADC is not running */
+    uint64_t dreadyPeriodTicks;
+    /** 1 once #EvbIdleInit was called */
+    uint8_t isInit;
+} EVB_IDLE_INFO;
+
+/*=============  D A T A  =============*/
+
+static EVB_IDLE_INFO evbIdleInfo;
+
+/*============= F U N C T I O N S =============*/
+
+static uint64_t UsToTicks(uint32_t timeUs);
+
+static uint32_t TimerIdleUs(void);
+
+static uint32_t DreadyIdleUs(uint64_t now);
+
+static void UpdateStats(ADI_EVB_POWER_MODE mode, int32_t wake, uint64_t startTicks,
+                        uint32_t sleepUs);
+
+/*=============  C O D E  =============*/
+
+int32_t EvbIdleInit(ADI_EVB_IDLE_CONFIG *pConfig)
+{
+    int32_t status = -1;
+    if (pConfig != NULL)
+    {
+        evbIdleInfo.config = *pConfig;
+        EvbIdleSetDreadyPeriod(pConfig->dreadyPeriodUs);
+        EvbIdleResetStats();
+        evbIdleInfo.isInit = 1;
+        status = 0;
+    }
+
+    return status;
+}
+
+int32_t EvbIdle(void)
+{
+    int32_t mode = -1;
+    int32_t wake = -1;
+    uint32_t state;
+    uint32_t timerUs;
+    uint32_t deadlineUs;
+    uint32_t sleepUs = 0;
+    uint64_t startTicks;
+    ADI_EVB_POWER_MODE powerMode = ADI_EVB_POWER_MODE_SLEEP;
+    ADI_EVB_IDLE_CONFIG *pConfig = &evbIdleInfo.config;
+
+    if (evbIdleInfo.isInit == 1)
+    {
+        // Interrupts stay masked until the clocks are back, a pending interrupt still wakes
+        state = EvbEnterCritical();
+        startTicks = EvbGetTime64();
+        timerUs = TimerIdleUs();
+        deadlineUs = DreadyIdleUs(startTicks);
+        deadlineUs = (timerUs < deadlineUs) ? timerUs : deadlineUs;
+
+        // DREADY wakes from SLEEP by itself, STOP also has to end before it
+        if ((pConfig->pfRestoreClocks != NULL) && (deadlineUs >= pConfig->minStopUs) &&
+            (deadlineUs > pConfig->stopExitUs))
+        {
+            powerMode = ADI_EVB_POWER_MODE_STOP;
+            sleepUs = deadlineUs - pConfig->stopExitUs;
+            wake = EvbEnterLowPower(powerMode, sleepUs);
+        }
+        if (wake < 0)
+        {
+            powerMode = ADI_EVB_POWER_MODE_SLEEP;
+            sleepUs = (timerUs >= pConfig->minTicklessUs) ? timerUs : 0;
+            wake = EvbEnterLowPower(powerMode, sleepUs);
+        }
+        if (wake >= 0)
+        {
+            if (powerMode == ADI_EVB_POWER_MODE_STOP)
+            {
+                pConfig->pfRestoreClocks();
+            }
+            UpdateStats(powerMode, wake, startTicks, sleepUs);
+            mode = (int32_t)powerMode;
+        }
+        EvbExitCritical(state);
+    }
+
+    return mode;
+}
+
+void EvbIdleNotifyDready(void)
+{
+    evbIdleInfo.dreadyTicks = EvbGetTime64();
+}
+
+void EvbIdleSetDreadyPeriod(uint32_t periodUs)
+{
+    uint32_t state = EvbEnterCritical();
+    evbIdleInfo.dreadyPeriodTicks = UsToTicks(periodUs);
+    evbIdleInfo.dreadyTicks = EvbGetTime64();
+    EvbExitCritical(state);
+}
+
+int32_t EvbIdleGetStats(ADI_EVB_IDLE_STATS *pStats)
+{
+    int32_t status = -1;
+    uint32_t state;
+    uint64_t asleepTicks;
+    uint64_t totalTicks;
+
+    if (pStats != NULL)
+    {
+        state = EvbEnterCritical();
+        *pStats = evbIdleInfo.stats;
+        asleepTicks = evbIdleInfo.asleepTicks;
+        totalTicks = EvbGetTime64() - evbIdleInfo.statsStartTicks;
+        EvbExitCritical(state);
+        pStats->asleepUs = EvbTicksToUs(asleepTicks);
+        pStats->totalUs = EvbTicksToUs(totalTicks);
+        status = 0;
+    }
+
+    return status;
+}
+
+uint32_t EvbIdleGetAsleepPermille(void)
+{
+    uint32_t permille = 0;
+    ADI_EVB_IDLE_STATS stats;
+
+    EvbIdleGetStats(&stats);
+    if (stats.totalUs > 0)
+    {
+        permille = (uint32_t)((stats.asleepUs * 1000u) / stats.totalUs);
+    }
+
+    return permille;
+}
+
+void EvbIdleResetStats(void)
+{
+    uint32_t state = EvbEnterCritical();
+    evbIdleInfo.stats.numSleep = 0;
+    evbIdleInfo.stats.numStop = 0;
+    evbIdleInfo.stats.numTimerWakes = 0;
+    evbIdleInfo.stats.lastWakeLatencyNs = 0;
+    evbIdleInfo.stats.maxWakeLatencyNs = 0;
+    evbIdleInfo.stats.asleepUs = 0;
+    evbIdleInfo.stats.totalUs = 0;
+    evbIdleInfo.asleepTicks = 0;
+    evbIdleInfo.statsStartTicks = EvbGetTime64();
+    EvbExitCritical(state);
+}
+
+static uint64_t UsToTicks(uint32_t timeUs)
+{
+    return ((uint64_t)timeUs * EvbGetTimerFrequency()) / IDLE_US_PER_SEC;
+}
+
+static uint32_t TimerIdleUs(void)
+{
+    uint32_t idleTicks = EvbSwTimerGetIdleTicks();
+    uint32_t idleUs = ADI_EVB_IDLE_MAX_SLEEP_US;
+
+    // The current tick is partly elapsed, only the whole ticks after it are idle
+    if (idleTicks <= (ADI_EVB_IDLE_MAX_SLEEP_US / IDLE_US_PER_TICK))
+    {
+        idleUs = (idleTicks > 0) ? ((idleTicks - 1) * IDLE_US_PER_TICK) : 0;
+    }
+
+    return idleUs;
+}
+
+static uint32_t DreadyIdleUs(uint64_t now)
+{
+    uint32_t idleUs = ADI_EVB_IDLE_MAX_SLEEP_US;
+    uint64_t elapsedTicks;
+    uint64_t leftUs;
+
+    if (evbIdleInfo.dreadyPeriodTicks != 0)
+    {
+        idleUs = 0;
+        elapsedTicks = now - evbIdleInfo.dreadyTicks;
+        // An overdue DREADY is treated as imminent
+        if (elapsedTicks < evbIdleInfo.dreadyPeriodTicks)
+        {
+            leftUs = EvbTicksToUs(evbIdleInfo.dreadyPeriodTicks - elapsedTicks);
+            idleUs = (leftUs < ADI_EVB_IDLE_MAX_SLEEP_US) ? (uint32_t)leftUs
+                                                          : ADI_EVB_IDLE_MAX_SLEEP_US;
+        }
+    }
+
+    return idleUs;
+}
+
+static void UpdateStats(ADI_EVB_POWER_MODE mode, int32_t wake, uint64_t startTicks,
+                        uint32_t sleepUs)
+{
+    uint64_t endTicks = EvbGetTime64();
+    uint64_t deadlineTicks;
+    uint64_t latencyNs;
+
+    evbIdleInfo.asleepTicks += endTicks - startTicks;
+    if (mode == ADI_EVB_POWER_MODE_STOP)
+    {
+        evbIdleInfo.stats.numStop++;
+    }
+    else
+    {
+        evbIdleInfo.stats.numSleep++;
+    }
+    if (wake == 1)
+    {
+        evbIdleInfo.stats.numTimerWakes++;
+        deadlineTicks = startTicks + UsToTicks(sleepUs);
+        latencyNs = (endTicks > deadlineTicks) ? EvbTicksToNs(endTicks - deadlineTicks) : 0;
+        latencyNs = (latencyNs < 0xFFFFFFFFu) ? latencyNs : 0xFFFFFFFFu;
+        evbIdleInfo.stats.lastWakeLatencyNs = (uint32_t)latencyNs;
+        if (latencyNs > evbIdleInfo.stats.maxWakeLatencyNs)
+        {
+            evbIdleInfo.stats.maxWakeLatencyNs = (uint32_t)latencyNs;
+        }
+    }
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,175 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     evb_led_pattern.c
+ * @brief    LED patterns played from the software timers, so that status indication
+ *           does not block the caller.
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+
+#include "adi_evb.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Pattern playing on an LED */
+typedef struct
+{
+    /** timer of the current step */
+    ADI_EVB_SWTIMER timer;
+    /** step durations in ms */
+    const uint16_t *pStepsMs;
+    /** num of steps */
+    uint32_t numSteps;
+    /** plays left, 0 to repeat until stopped */
+    uint32_t numRepeats;
+    /** index of the current step */
+    uint32_t step;
+    /** storage of the steps of #EvbLedFlashAsync */
+    uint16_t flashStepsMs[2];
+} EVB_LED_PATTERN;
+
+/*=============  D A T A  =============*/
+
+static EVB_LED_PATTERN evbLedPatterns[ADI_EVB_LED_MAX_PATTERNS];
+
+/*============= F U N C T I O N S =============*/
+
+static int32_t StartStep(uint32_t idx);
+
+static void StepCallBack(ADI_EVB_SWTIMER *pTimer, void *pArg);
+
+/*=============  C O D E  =============*/
+
+int32_t EvbLedPlayPattern(uint32_t idx, const uint16_t *pStepsMs, uint32_t numSteps,
+                          uint32_t numRepeats)
+{
+    int32_t status = ADI_EVB_STATUS_INVALID_INDEX;
+    EVB_LED_PATTERN *pPattern;
+
+    if (idx < ADI_EVB_LED_MAX_PATTERNS)
+    {
+        status = -1;
+        if ((pStepsMs != NULL) && (numSteps > 0))
+        {
+            pPattern = &evbLedPatterns[idx];
+            EvbSwTimerStop(&pPattern->timer);
+            pPattern->pStepsMs = pStepsMs;
+            pPattern->numSteps = numSteps;
+            pPattern->numRepeats = numRepeats;
+            pPattern->step = 0;
+            status = StartStep(idx);
+        }
+    }
+
+    return status;
+}
+
+int32_t EvbLedFlashAsync(uint32_t idx, uint32_t numFlashes, uint32_t flashMs)
+{
+    int32_t status = ADI_EVB_STATUS_INVALID_INDEX;
+    EVB_LED_PATTERN *pPattern;
+
+    if (idx < ADI_EVB_LED_MAX_PATTERNS)
+    {
+        status = -1;
+        if ((numFlashes > 0) && (flashMs > 0) && (flashMs <= 0xFFFFu))
+        {
+            pPattern = &evbLedPatterns[idx];
+            // Stopped first, the steps below may be in use by the tick interrupt
+            EvbSwTimerStop(&pPattern->timer);
+            pPattern->flashStepsMs[0] = (uint16_t)flashMs;
+            pPattern->flashStepsMs[1] = (uint16_t)flashMs;
+            status = EvbLedPlayPattern(idx, pPattern->flashStepsMs, 2, numFlashes);
+        }
+    }
+
+    return status;
+}
+
+int32_t EvbLedStopPattern(uint32_t idx)
+{
+    int32_t status = ADI_EVB_STATUS_INVALID_INDEX;
+
+    if (idx < ADI_EVB_LED_MAX_PATTERNS)
+    {
+        EvbSwTimerStop(&evbLedPatterns[idx].timer);
+        status = EvbLedOff(idx);
+    }
+
+    return status;
+}
+
+uint8_t EvbLedIsPatternActive(uint32_t idx)
+{
+    uint8_t isActive = 0;
+
+    if (idx < ADI_EVB_LED_MAX_PATTERNS)
+    {
+        isActive = EvbSwTimerIsActive(&evbLedPatterns[idx].timer);
+    }
+
+    return isActive;
+}
+
+static int32_t StartStep(uint32_t idx)
+{
+    int32_t status;
+    EVB_LED_PATTERN *pPattern = &evbLedPatterns[idx];
+
+    // Even steps turn the LED on, odd steps turn it off
+    if ((pPattern->step & 1u) == 0)
+    {
+        status = EvbLedOn(idx);
+    }
+    else
+    {
+        status = EvbLedOff(idx);
+    }
+    if (status == ADI_EVB_STATUS_SUCCESS)
+    {
+        status = EvbSwTimerStart(&pPattern->timer, pPattern->pStepsMs[pPattern->step], 0,
+                                 StepCallBack, pPattern);
+    }
+
+    return status;
+}
+
+static void StepCallBack(ADI_EVB_SWTIMER *pTimer, void *pArg)
+{
+    EVB_LED_PATTERN *pPattern = (EVB_LED_PATTERN *)pArg;
+    uint32_t idx = (uint32_t)(pPattern - evbLedPatterns);
+    uint8_t isDone = 0;
+
+    (void)pTimer; /* Dummy use of argument */
+    pPattern->step++;
+    if (pPattern->step >= pPattern->numSteps)
+    {
+        pPattern->step = 0;
+        if (pPattern->numRepeats == 1)
+        {
+            isDone = 1;
+        }
+        else if (pPattern->numRepeats > 1)
+        {
+            pPattern->numRepeats--;
+        }
+    }
+    if (isDone == 1)
+    {
+        EvbLedOff(idx);
+    }
+    else
+    {
+        StartStep(idx);
+    }
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,181 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     evb_prof.c
+ * @brief    Profiling probes measured with the CPU cycle counter. Statistics are
+ *           accumulated in a fixed table and printed through the message buffer.
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+
+#include "adi_evb.h"
+#include "message.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Evb profiling probe */
+typedef struct
+{
+    /** statistics */
+    ADI_EVB_PROF_STATS stats;
+    /** cycle count at EvbProfStart */
+    volatile uint32_t startCycles;
+} EVB_PROF_PROBE;
+
+/** Evb profiling info */
+typedef struct
+{
+    /** probe table */
+    EVB_PROF_PROBE probes[ADI_EVB_PROF_MAX_PROBES];
+    /** cycles taken by the counter reads themselves, removed from each measurement */
+    uint32_t overheadCycles;
+} EVB_PROF_INFO;
+
+/*=============  D A T A  =============*/
+
+static EVB_PROF_INFO evbProfInfo;
+
+/*============= F U N C T I O N S =============*/
+
+static void ClearStats(ADI_EVB_PROF_STATS *pStats);
+
+/*=============  C O D E  =============*/
+
+int32_t EvbProfInit(void)
+{
+    int32_t status;
+    uint32_t probeId;
+    uint32_t startCycles;
+
+    status = EvbInitCycleCounter();
+    if (status == 0)
+    {
+        for (probeId = 0; probeId < ADI_EVB_PROF_MAX_PROBES; probeId++)
+        {
+            evbProfInfo.probes[probeId].stats.pName = NULL;
+            ClearStats(&evbProfInfo.probes[probeId].stats);
+        }
+        startCycles = EvbGetCycleCount();
+        evbProfInfo.overheadCycles = EvbGetCycleCount() - startCycles;
+    }
+
+    return status;
+}
+
+int32_t EvbProfRegister(uint32_t probeId, const char *pName)
+{
+    int32_t status = -1;
+    if ((probeId < ADI_EVB_PROF_MAX_PROBES) && (pName != NULL))
+    {
+        evbProfInfo.probes[probeId].stats.pName = pName;
+        status = 0;
+    }
+
+    return status;
+}
+
+void EvbProfStart(uint32_t probeId)
+{
+    if (probeId < ADI_EVB_PROF_MAX_PROBES)
+    {
+        evbProfInfo.probes[probeId].startCycles = EvbGetCycleCount();
+    }
+}
+
+void EvbProfStop(uint32_t probeId)
+{
+    uint32_t stopCycles = EvbGetCycleCount();
+    uint32_t cycles;
+    uint32_t state;
+    ADI_EVB_PROF_STATS *pStats;
+
+    if (probeId < ADI_EVB_PROF_MAX_PROBES)
+    {
+        pStats = &evbProfInfo.probes[probeId].stats;
+        // Unsigned difference is correct across one wrap of the counter
+        cycles = stopCycles - evbProfInfo.probes[probeId].startCycles;
+        cycles = (cycles > evbProfInfo.overheadCycles) ? cycles - evbProfInfo.overheadCycles : 0;
+        state = EvbEnterCritical();
+        pStats->count++;
+        pStats->totalCycles += cycles;
+        if (cycles < pStats->minCycles)
+        {
+            pStats->minCycles = cycles;
+        }
+        if (cycles > pStats->maxCycles)
+        {
+            pStats->maxCycles = cycles;
+        }
+        EvbExitCritical(state);
+    }
+}
+
+int32_t EvbProfGetStats(uint32_t probeId, ADI_EVB_PROF_STATS *pStats)
+{
+    int32_t status = -1;
+    uint32_t state;
+    if ((probeId < ADI_EVB_PROF_MAX_PROBES) && (pStats != NULL))
+    {
+        state = EvbEnterCritical();
+        memcpy(pStats, &evbProfInfo.probes[probeId].stats, sizeof(ADI_EVB_PROF_STATS));
+        EvbExitCritical(state);
+        status = 0;
+    }
+
+    return status;
+}
+
+void EvbProfReset(void)
+{
+    uint32_t probeId;
+    uint32_t state;
+
+    for (probeId = 0; probeId < ADI_EVB_PROF_MAX_PROBES; probeId++)
+    {
+        state = EvbEnterCritical();
+        ClearStats(&evbProfInfo.probes[probeId].stats);
+        EvbExitCritical(state);
+    }
+}
+
+int32_t EvbProfDump(void)
+{
+    int32_t status = 0;
+    uint32_t probeId;
+    uint32_t avgCycles;
+    ADI_EVB_PROF_STATS stats;
+
+    status |= PrintMessage("", "%-16s %10s %10s %10s %10s", "probe", "count", "min", "max",
+                           "avg");
+    for (probeId = 0; probeId < ADI_EVB_PROF_MAX_PROBES; probeId++)
+    {
+        EvbProfGetStats(probeId, &stats);
+        if ((stats.pName != NULL) && (stats.count > 0))
+        {
+            avgCycles = (uint32_t)(stats.totalCycles / stats.count);
+            status |= PrintMessage("", "%-16s %10lu %10lu %10lu %10lu", stats.pName,
+                                   (unsigned long)stats.count, (unsigned long)stats.minCycles,
+                                   (unsigned long)stats.maxCycles, (unsigned long)avgCycles);
+        }
+    }
+
+    return status;
+}
+
+static void ClearStats(ADI_EVB_PROF_STATS *pStats)
+{
+    pStats->count = 0;
+    pStats->minCycles = 0xFFFFFFFFu;
+    pStats->maxCycles = 0;
+    pStats->totalCycles = 0;
+}
+
+/**
+ * @}
+ */
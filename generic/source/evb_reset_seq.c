@@ -0,0 +1,199 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     evb_reset_seq.c
+ * @brief    Reset sequences of the devices on the evaluation board, run from the
+ *           software timers so that init work can overlap the wait after a reset.
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+
+#include "adi_evb.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Duration in ms of the low pulse. */
+#define RESET_PULSE_MSEC 10
+/** Duration in ms to wait after the low pulse. */
+#define RESET_WAIT_MSEC 200
+/** Longest sequence, a reset of the ADCs followed by one of the ADE */
+#define RESET_MAX_PINS 2
+
+/** State of a reset sequence */
+typedef enum
+{
+    /** No reset in progress */
+    EVB_RESET_STATE_IDLE,
+    /** Reset pin held low */
+    EVB_RESET_STATE_PULSE,
+    /** Reset pin released, waiting for the device to start */
+    EVB_RESET_STATE_WAIT
+} EVB_RESET_STATE;
+
+/** Evb reset sequence info */
+typedef struct
+{
+    /** timer of the current state */
+    ADI_EVB_SWTIMER timer;
+    /** reset pins in the order they are toggled */
+    uint32_t pins[RESET_MAX_PINS];
+    /** num of pins in the sequence */
+    uint32_t numPins;
+    /** index of the pin being toggled */
+    uint32_t pinIdx;
+    /** current state */
+    volatile EVB_RESET_STATE state;
+    /** callback at the end of the sequence */
+    ADI_EVB_RESET_CALLBACK pfCallback;
+} EVB_RESET_INFO;
+
+/*=============  D A T A  =============*/
+
+static EVB_RESET_INFO evbResetInfo;
+
+/*============= F U N C T I O N S =============*/
+
+static int32_t StartSequence(const uint32_t *pPins, uint32_t numPins,
+                             ADI_EVB_RESET_CALLBACK pfCallback);
+
+static int32_t StartPulse(void);
+
+static void FinishSequence(int32_t status);
+
+static void ResetCallBack(ADI_EVB_SWTIMER *pTimer, void *pArg);
+
+/*=============  C O D E  =============*/
+
+int32_t EvbResetAdeAsync(ADI_EVB_RESET_CALLBACK pfCallback)
+{
+    static const uint32_t pins[] = {ADI_EVB_RESET_PIN_ADE};
+    return StartSequence(pins, 1, pfCallback);
+}
+
+int32_t EvbResetAdcsAsync(ADI_EVB_RESET_CALLBACK pfCallback)
+{
+    static const uint32_t pins[] = {ADI_EVB_RESET_PIN_ADC};
+    return StartSequence(pins, 1, pfCallback);
+}
+
+int32_t EvbResetAllAsync(ADI_EVB_RESET_CALLBACK pfCallback)
+{
+#if BOARD_CFG_RESET_TYPE == 0
+    // Both for Ade9178 and Adc reset pin is tied together.
+    static const uint32_t pins[] = {ADI_EVB_RESET_PIN_ADE};
+#else
+    static const uint32_t pins[] = {ADI_EVB_RESET_PIN_ADC, ADI_EVB_RESET_PIN_ADE};
+#endif
+    return StartSequence(pins, sizeof(pins) / sizeof(pins[0]), pfCallback);
+}
+
+uint8_t EvbIsResetBusy(void)
+{
+    return (evbResetInfo.state != EVB_RESET_STATE_IDLE) ? 1u : 0u;
+}
+
+static int32_t StartSequence(const uint32_t *pPins, uint32_t numPins,
+                             ADI_EVB_RESET_CALLBACK pfCallback)
+{
+    int32_t status = -1;
+    uint32_t state;
+    uint32_t i;
+
+    state = EvbEnterCritical();
+    if (evbResetInfo.state == EVB_RESET_STATE_IDLE)
+    {
+        // Claimed before the pins are touched, a second caller gets an error
+        evbResetInfo.state = EVB_RESET_STATE_PULSE;
+        status = 0;
+    }
+    EvbExitCritical(state);
+
+    if (status == 0)
+    {
+        for (i = 0; i < numPins; i++)
+        {
+            evbResetInfo.pins[i] = pPins[i];
+        }
+        evbResetInfo.numPins = numPins;
+        evbResetInfo.pinIdx = 0;
+        evbResetInfo.pfCallback = pfCallback;
+        status = StartPulse();
+        if (status != 0)
+        {
+            evbResetInfo.state = EVB_RESET_STATE_IDLE;
+        }
+    }
+
+    return status;
+}
+
+static int32_t StartPulse(void)
+{
+    int32_t status;
+
+    evbResetInfo.state = EVB_RESET_STATE_PULSE;
+    status = EvbSetResetPin(evbResetInfo.pins[evbResetInfo.pinIdx], 0);
+    if (status == ADI_EVB_STATUS_SUCCESS)
+    {
+        status = EvbSwTimerStart(&evbResetInfo.timer, RESET_PULSE_MSEC, 0, ResetCallBack, NULL);
+    }
+
+    return status;
+}
+
+static void FinishSequence(int32_t status)
+{
+    ADI_EVB_RESET_CALLBACK pfCallback = evbResetInfo.pfCallback;
+
+    // Idle before the callback, so that it can start another reset
+    evbResetInfo.state = EVB_RESET_STATE_IDLE;
+    if (pfCallback != NULL)
+    {
+        pfCallback(status);
+    }
+}
+
+static void ResetCallBack(ADI_EVB_SWTIMER *pTimer, void *pArg)
+{
+    int32_t status = ADI_EVB_STATUS_SUCCESS;
+
+    (void)pArg; /* Dummy use of argument */
+    if (evbResetInfo.state == EVB_RESET_STATE_PULSE)
+    {
+        evbResetInfo.state = EVB_RESET_STATE_WAIT;
+        status = EvbSetResetPin(evbResetInfo.pins[evbResetInfo.pinIdx], 1);
+        if (status == ADI_EVB_STATUS_SUCCESS)
+        {
+            status = EvbSwTimerStart(pTimer, RESET_WAIT_MSEC, 0, ResetCallBack, NULL);
+        }
+        if (status != ADI_EVB_STATUS_SUCCESS)
+        {
+            FinishSequence(status);
+        }
+    }
+    else if (evbResetInfo.state == EVB_RESET_STATE_WAIT)
+    {
+        evbResetInfo.pinIdx++;
+        if (evbResetInfo.pinIdx < evbResetInfo.numPins)
+        {
+            status = StartPulse();
+            if (status != ADI_EVB_STATUS_SUCCESS)
+            {
+                FinishSequence(status);
+            }
+        }
+        else
+        {
+            FinishSequence(status);
+        }
+    }
+}
+
+/**
+ * @}
+ */
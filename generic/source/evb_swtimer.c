@@ -0,0 +1,277 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     evb_swtimer.c
+ * @brief    Hierarchical timer wheel for software timers. Each level has 64 slots,
+ *           a level covers 64 times the range of the level below. Timers are
+ *           moved to a lower level when the slot holding them is reached.
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+
+#include "adi_evb.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Number of levels of the wheel */
+#define SWTIMER_NUM_LEVELS 4u
+/** Index bits of a level */
+#define SWTIMER_LEVEL_BITS 6u
+/** Slots in a level */
+#define SWTIMER_NUM_SLOTS  (1u << SWTIMER_LEVEL_BITS)
+/** Mask of a slot index */
+#define SWTIMER_SLOT_MASK  (SWTIMER_NUM_SLOTS - 1u)
+/** Longest delay the wheel holds, longer timers are moved back to the top level */
+#define SWTIMER_MAX_DELTA  ((1u << (SWTIMER_NUM_LEVELS * SWTIMER_LEVEL_BITS)) - 1u)
+
+/** Evb software timer info */
+typedef struct
+{
+    /** timer lists of each slot */
+    ADI_EVB_SWTIMER *pWheel[SWTIMER_NUM_LEVELS][SWTIMER_NUM_SLOTS];
+    /** current tick */
+    volatile uint32_t now;
+    /** num of running timers */
+    uint32_t numActive;
+} EVB_SWTIMER_INFO;
+
+/*=============  D A T A  =============*/
+
+static EVB_SWTIMER_INFO evbSwTimerInfo;
+
+/*============= F U N C T I O N S =============*/
+
+static void InsertTimer(ADI_EVB_SWTIMER *pTimer);
+
+static void RemoveTimer(ADI_EVB_SWTIMER *pTimer);
+
+static void CascadeSlot(uint32_t level, uint32_t slot);
+
+static uint32_t LevelIdleTicks(uint32_t now, uint32_t level);
+
+/*=============  C O D E  =============*/
+
+int32_t EvbSwTimerStart(ADI_EVB_SWTIMER *pTimer, uint32_t delayMs, uint32_t periodMs,
+                        ADI_EVB_SWTIMER_CALLBACK pfCallback, void *pArg)
+{
+    int32_t status = -1;
+    uint32_t state;
+    uint32_t numActive;
+    if ((pTimer != NULL) && (pfCallback != NULL) && (delayMs < 0x80000000u) &&
+        (periodMs < 0x80000000u))
+    {
+        state = EvbEnterCritical();
+        if (pTimer->ppLink != NULL)
+        {
+            RemoveTimer(pTimer);
+        }
+        numActive = evbSwTimerInfo.numActive;
+        pTimer->pfCallback = pfCallback;
+        pTimer->pArg = pArg;
+        pTimer->periodMs = periodMs;
+        // The current tick is partly elapsed, so the first expiry is at least one tick away
+        pTimer->expiry = evbSwTimerInfo.now + ((delayMs == 0) ? 1u : delayMs);
+        InsertTimer(pTimer);
+        if (numActive == 0)
+        {
+            EvbStartTickTimer();
+        }
+        EvbExitCritical(state);
+        status = 0;
+    }
+
+    return status;
+}
+
+int32_t EvbSwTimerStop(ADI_EVB_SWTIMER *pTimer)
+{
+    int32_t status = -1;
+    uint32_t state;
+    if (pTimer != NULL)
+    {
+        state = EvbEnterCritical();
+        if (pTimer->ppLink != NULL)
+        {
+            RemoveTimer(pTimer);
+            if (evbSwTimerInfo.numActive == 0)
+            {
+                EvbStopTickTimer();
+            }
+        }
+        EvbExitCritical(state);
+        status = 0;
+    }
+
+    return status;
+}
+
+uint8_t EvbSwTimerIsActive(ADI_EVB_SWTIMER *pTimer)
+{
+    return ((pTimer != NULL) && (pTimer->ppLink != NULL)) ? 1u : 0u;
+}
+
+uint32_t EvbSwTimerGetIdleTicks(void)
+{
+    uint32_t idleTicks = 0xFFFFFFFFu;
+    uint32_t levelTicks;
+    uint32_t state;
+    uint32_t now;
+    uint32_t level;
+
+    state = EvbEnterCritical();
+    if (evbSwTimerInfo.numActive > 0)
+    {
+        now = evbSwTimerInfo.now;
+        for (level = 0; level < SWTIMER_NUM_LEVELS; level++)
+        {
+            levelTicks = LevelIdleTicks(now, level);
+            if (levelTicks < idleTicks)
+            {
+                idleTicks = levelTicks;
+            }
+        }
+    }
+    EvbExitCritical(state);
+
+    return idleTicks;
+}
+
+void EvbSwTimerTick(void)
+{
+    uint32_t state;
+    uint32_t now;
+    uint32_t level;
+    ADI_EVB_SWTIMER **ppSlot;
+    ADI_EVB_SWTIMER *pTimer;
+
+    state = EvbEnterCritical();
+    now = evbSwTimerInfo.now + 1;
+    evbSwTimerInfo.now = now;
+    // A level is cascaded each time the index of the level below wraps to 0
+    for (level = 1; level < SWTIMER_NUM_LEVELS; level++)
+    {
+        if (((now >> ((level - 1) * SWTIMER_LEVEL_BITS)) & SWTIMER_SLOT_MASK) != 0)
+        {
+            break;
+        }
+        CascadeSlot(level, (now >> (level * SWTIMER_LEVEL_BITS)) & SWTIMER_SLOT_MASK);
+    }
+
+    // Every timer in the current slot of the first level expires now
+    ppSlot = &evbSwTimerInfo.pWheel[0][now & SWTIMER_SLOT_MASK];
+    while (*ppSlot != NULL)
+    {
+        pTimer = *ppSlot;
+        RemoveTimer(pTimer);
+        if (pTimer->periodMs != 0)
+        {
+            pTimer->expiry += pTimer->periodMs;
+            // Ticks lost to a late interrupt are skipped rather than fired in a burst
+            if ((int32_t)(pTimer->expiry - now) <= 0)
+            {
+                pTimer->expiry = now + 1;
+            }
+            InsertTimer(pTimer);
+        }
+        // Callbacks may start or stop timers
+        EvbExitCritical(state);
+        pTimer->pfCallback(pTimer, pTimer->pArg);
+        state = EvbEnterCritical();
+    }
+    if (evbSwTimerInfo.numActive == 0)
+    {
+        EvbStopTickTimer();
+    }
+    EvbExitCritical(state);
+}
+
+static void InsertTimer(ADI_EVB_SWTIMER *pTimer)
+{
+    uint32_t delta = pTimer->expiry - evbSwTimerInfo.now;
+    uint32_t slotTick = pTimer->expiry;
+    uint32_t level = 0;
+    uint32_t slot;
+    ADI_EVB_SWTIMER **ppSlot;
+
+    if (delta > SWTIMER_MAX_DELTA)
+    {
+        delta = SWTIMER_MAX_DELTA;
+        slotTick = evbSwTimerInfo.now + delta;
+    }
+    while ((level < (SWTIMER_NUM_LEVELS - 1)) &&
+           (delta >= (1u << ((level + 1) * SWTIMER_LEVEL_BITS))))
+    {
+        level++;
+    }
+    slot = (slotTick >> (level * SWTIMER_LEVEL_BITS)) & SWTIMER_SLOT_MASK;
+    ppSlot = &evbSwTimerInfo.pWheel[level][slot];
+
+    pTimer->pNext = *ppSlot;
+    if (pTimer->pNext != NULL)
+    {
+        pTimer->pNext->ppLink = &pTimer->pNext;
+    }
+    *ppSlot = pTimer;
+    pTimer->ppLink = ppSlot;
+    evbSwTimerInfo.numActive++;
+}
+
+static void RemoveTimer(ADI_EVB_SWTIMER *pTimer)
+{
+    *pTimer->ppLink = pTimer->pNext;
+    if (pTimer->pNext != NULL)
+    {
+        pTimer->pNext->ppLink = pTimer->ppLink;
+    }
+    pTimer->pNext = NULL;
+    pTimer->ppLink = NULL;
+    evbSwTimerInfo.numActive--;
+}
+
+static void CascadeSlot(uint32_t level, uint32_t slot)
+{
+    ADI_EVB_SWTIMER *pTimer;
+    ADI_EVB_SWTIMER *pNext;
+
+    pTimer = evbSwTimerInfo.pWheel[level][slot];
+    evbSwTimerInfo.pWheel[level][slot] = NULL;
+    while (pTimer != NULL)
+    {
+        pNext = pTimer->pNext;
+        evbSwTimerInfo.numActive--;
+        InsertTimer(pTimer);
+        pTimer = pNext;
+    }
+}
+
+static uint32_t LevelIdleTicks(uint32_t now, uint32_t level)
+{
+    uint32_t shift = level * SWTIMER_LEVEL_BITS;
+    uint32_t current = (now >> shift) & SWTIMER_SLOT_MASK;
+    uint32_t offset;
+    uint32_t slot;
+    uint32_t idleTicks = 0xFFFFFFFFu;
+
+    // The slot at the current index is a full turn away, it was emptied when reached
+    for (offset = 1; offset <= SWTIMER_NUM_SLOTS; offset++)
+    {
+        slot = (current + offset) & SWTIMER_SLOT_MASK;
+        if (evbSwTimerInfo.pWheel[level][slot] != NULL)
+        {
+            // Upper level slots are reached when the index of the level below wraps
+            idleTicks = (offset << shift) - (now & ((1u << shift) - 1u));
+            break;
+        }
+    }
+
+    return idleTicks;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,130 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     evb_time.c
+ * @brief    Conversion of system timer ticks to time units. Uses fixed point
+ *           reciprocals of the timer frequency, so that no division is done per call.
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+
+#include "adi_evb.h"
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Nanoseconds in a second */
+#define EVB_TIME_NS_PER_SEC 1000000000u
+/** Microseconds in a second */
+#define EVB_TIME_US_PER_SEC 1000000u
+
+/** Time units per tick as an integer part and a 64 bit binary fraction */
+typedef struct
+{
+    /** integer part */
+    uint32_t integer;
+    /** upper 32 bits of the fraction */
+    uint32_t fracHigh;
+    /** lower 32 bits of the fraction */
+    uint32_t fracLow;
+} EVB_TIME_SCALE;
+
+/** Evb time info */
+typedef struct
+{
+    /** timer frequency the scales were computed for */
+    volatile uint32_t frequency;
+    /** ns per tick */
+    EVB_TIME_SCALE nsPerTick;
+    /** us per tick */
+    EVB_TIME_SCALE usPerTick;
+} EVB_TIME_INFO;
+
+/*=============  D A T A  =============*/
+
+static EVB_TIME_INFO evbTimeInfo;
+
+/*============= F U N C T I O N S =============*/
+
+static void UpdateScales(void);
+
+static void ComputeScale(EVB_TIME_SCALE *pScale, uint32_t unitsPerSec, uint32_t frequency);
+
+static uint64_t ScaleTicks(uint64_t ticks, EVB_TIME_SCALE *pScale);
+
+/*=============  C O D E  =============*/
+
+uint64_t EvbTicksToNs(uint64_t ticks)
+{
+    UpdateScales();
+    return ScaleTicks(ticks, &evbTimeInfo.nsPerTick);
+}
+
+uint64_t EvbTicksToUs(uint64_t ticks)
+{
+    UpdateScales();
+    return ScaleTicks(ticks, &evbTimeInfo.usPerTick);
+}
+
+static void UpdateScales(void)
+{
+    uint32_t frequency = EvbGetTimerFrequency();
+
+    if ((frequency != 0) && (frequency != evbTimeInfo.frequency))
+    {
+        // Frequency is written last, an interrupt arriving in between computes them again
+        ComputeScale(&evbTimeInfo.nsPerTick, EVB_TIME_NS_PER_SEC, frequency);
+        ComputeScale(&evbTimeInfo.usPerTick, EVB_TIME_US_PER_SEC, frequency);
+        evbTimeInfo.frequency = frequency;
+    }
+}
+
+static void ComputeScale(EVB_TIME_SCALE *pScale, uint32_t unitsPerSec, uint32_t frequency)
+{
+    uint64_t remainder;
+
+    // Long division, 32 fraction bits at a time
+    pScale->integer = unitsPerSec / frequency;
+    remainder = (uint64_t)(unitsPerSec % frequency) << 32;
+    pScale->fracHigh = (uint32_t)(remainder / frequency);
+    remainder = (remainder % frequency) << 32;
+    pScale->fracLow = (uint32_t)(remainder / frequency);
+    // Rounded up, so that exact multiples of a unit are not truncated to the unit below
+    if ((remainder % frequency) != 0)
+    {
+        pScale->fracLow++;
+        if (pScale->fracLow == 0)
+        {
+            pScale->fracHigh++;
+            if (pScale->fracHigh == 0)
+            {
+                pScale->integer++;
+            }
+        }
+    }
+}
+
+static uint64_t ScaleTicks(uint64_t ticks, EVB_TIME_SCALE *pScale)
+{
+    uint64_t ticksHigh = ticks >> 32;
+    uint64_t ticksLow = ticks & 0xFFFFFFFFu;
+    uint64_t productMid = ticksLow * pScale->fracHigh;
+    uint64_t partHigh;
+    uint64_t partLow;
+
+    // Products are split at 32 bits so that they fit in 64 bits, the bits below the binary
+    // point of the upper fraction are carried into the lower one
+    partHigh = (ticksHigh * pScale->fracHigh) + (productMid >> 32);
+    partLow = ((ticksHigh * pScale->fracLow) + ((ticksLow * pScale->fracLow) >> 32) +
+               (productMid & 0xFFFFFFFFu)) >>
+              32;
+
+    return (ticks * pScale->integer) + partHigh + partLow;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,390 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     sw_crc.c
+ * @brief    Software implementation of the CRC API for host builds and boards
+ *           without a CRC unit. Uses slice-by-4 tables, precomputed for the catalogue
+ *           polynomials and built once in RAM for any other polynomial.
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+
+#include "adi_evb.h"
+#include "sw_crc_tables.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Evb crc info */
+typedef struct
+{
+    /** callback */
+    ADI_EVB_CALLBACK pfCallback;
+    /** slice tables of the configured polynomial */
+    const uint32_t (*pTable)[256];
+    /** tables built for a polynomial without precomputed tables */
+    uint32_t table[SW_CRC_NUM_SLICES][256];
+    /** register aligned polynomial of the built tables */
+    uint32_t builtPoly;
+    /** input reflection of the built tables */
+    uint8_t builtReflectIn;
+    /** set once tables have been built */
+    uint8_t isBuilt;
+    /** running CRC register, right aligned when reflected, left aligned otherwise */
+    uint32_t crc;
+    /** seed, aligned as the register */
+    uint32_t seed;
+    /** CRC width in bits */
+    uint32_t numBits;
+    /** 1 when input bytes are reflected */
+    uint8_t reflectIn;
+    /** 1 when the CRC is reflected before the final XOR */
+    uint8_t reflectOut;
+    /** Value XORed with the CRC at the end */
+    uint32_t finalXor;
+    /** set once the tables are built */
+    uint8_t isConfigured;
+} EVB_CRC_INFO;
+
+/*=============  D A T A  =============*/
+
+static EVB_CRC_INFO evbCrcInfo;
+
+/*============= F U N C T I O N S =============*/
+
+/** Selects the default CRC-16/CCITT-FALSE when the CRC was not configured */
+static void ConfigureDefault(void);
+
+/** Selects the slice tables of a register aligned polynomial */
+static void SelectTables(uint32_t regPoly, uint8_t reflectIn);
+
+/** Builds the slice tables for a register aligned polynomial */
+static void BuildTables(uint32_t regPoly);
+
+/** Adds data to the CRC register, LSB first */
+static uint32_t UpdateReflected(uint32_t crc, const uint8_t *pData, uint32_t numBytes);
+
+/** Adds data to the CRC register, MSB first */
+static uint32_t UpdateNormal(uint32_t crc, const uint8_t *pData, uint32_t numBytes);
+
+/** Reflects the low numBits bits of a value */
+static uint32_t ReflectBits(uint32_t value, uint32_t numBits);
+
+/*=============  C O D E  =============*/
+
+int32_t EvbInitCrc(void **phCrc, ADI_EVB_CRC_CONFIG *pConfig)
+{
+    evbCrcInfo.pfCallback = pConfig->pfCallback;
+    *phCrc = &evbCrcInfo;
+    ConfigureDefault();
+
+    return 0;
+}
+
+int32_t EvbCrcConfigure(void *hEvb, ADI_EVB_CRC_PARAMS *pParams)
+{
+    int32_t status = -1;
+    uint32_t numBits = 0;
+
+    (void)hEvb; /* Dummy use of argument */
+    if (pParams != NULL)
+    {
+        if (pParams->crcType == ADI_EVB_CRC_TYPE_CRC8)
+        {
+            numBits = 8;
+        }
+        else if (pParams->crcType == ADI_EVB_CRC_TYPE_CRC16)
+        {
+            numBits = 16;
+        }
+        else if (pParams->crcType == ADI_EVB_CRC_TYPE_CRC32)
+        {
+            numBits = 32;
+        }
+    }
+    if (numBits != 0)
+    {
+        evbCrcInfo.numBits = numBits;
+        evbCrcInfo.reflectIn = pParams->reflectIn;
+        evbCrcInfo.reflectOut = pParams->reflectOut;
+        evbCrcInfo.finalXor = pParams->finalXor;
+        if (pParams->reflectIn == 1)
+        {
+            evbCrcInfo.seed = ReflectBits(pParams->seed, numBits);
+            SelectTables(ReflectBits(pParams->polynomial, numBits), 1);
+        }
+        else
+        {
+            evbCrcInfo.seed = pParams->seed << (32 - numBits);
+            SelectTables(pParams->polynomial << (32 - numBits), 0);
+        }
+        evbCrcInfo.crc = evbCrcInfo.seed;
+        evbCrcInfo.isConfigured = 1;
+        status = 0;
+    }
+
+    return status;
+}
+
+int32_t EvbCrcCalculate(void *hEvb, uint8_t *pData, uint32_t numBytes)
+{
+    int32_t status;
+
+    status = EvbCrcStart(hEvb);
+    if (status == 0)
+    {
+        status = EvbCrcAccumulate(hEvb, pData, numBytes);
+    }
+
+    return status;
+}
+
+int32_t EvbCrcStart(void *hEvb)
+{
+    (void)hEvb; /* Dummy use of argument */
+    ConfigureDefault();
+    evbCrcInfo.crc = evbCrcInfo.seed;
+
+    return 0;
+}
+
+int32_t EvbCrcAccumulate(void *hEvb, uint8_t *pData, uint32_t numBytes)
+{
+    int32_t status = -1;
+
+    (void)hEvb; /* Dummy use of argument */
+    if (pData != NULL)
+    {
+        ConfigureDefault();
+        if (evbCrcInfo.reflectIn == 1)
+        {
+            evbCrcInfo.crc = UpdateReflected(evbCrcInfo.crc, pData, numBytes);
+        }
+        else
+        {
+            evbCrcInfo.crc = UpdateNormal(evbCrcInfo.crc, pData, numBytes);
+        }
+        // Queued jobs have their own callbacks
+        if ((EvbCrcJobIrqCallback(0) == 0) && (evbCrcInfo.pfCallback != NULL))
+        {
+            evbCrcInfo.pfCallback();
+        }
+        status = 0;
+    }
+
+    return status;
+}
+
+int32_t EvbCrcFinalise(void *hEvb, uint32_t *pData)
+{
+    int32_t status = -1;
+    uint32_t numBits;
+    uint32_t result;
+
+    (void)hEvb; /* Dummy use of argument */
+    if (pData != NULL)
+    {
+        ConfigureDefault();
+        numBits = evbCrcInfo.numBits;
+        result = evbCrcInfo.crc;
+        if (evbCrcInfo.reflectIn == 0)
+        {
+            result = result >> (32 - numBits);
+        }
+        if (evbCrcInfo.reflectIn != evbCrcInfo.reflectOut)
+        {
+            result = ReflectBits(result, numBits);
+        }
+        *pData = (result ^ evbCrcInfo.finalXor) & (0xFFFFFFFFu >> (32 - numBits));
+        status = 0;
+    }
+
+    return status;
+}
+
+int32_t EvbCrcSaveState(void *hEvb, uint32_t *pState)
+{
+    int32_t status = -1;
+
+    (void)hEvb; /* Dummy use of argument */
+    if (pState != NULL)
+    {
+        *pState = evbCrcInfo.crc;
+        status = 0;
+    }
+
+    return status;
+}
+
+int32_t EvbCrcRestoreState(void *hEvb, uint32_t state)
+{
+    (void)hEvb; /* Dummy use of argument */
+    ConfigureDefault();
+    evbCrcInfo.crc = state;
+
+    return 0;
+}
+
+int32_t EvbCrcGetValue(void *hEvb, uint32_t *pData)
+{
+    return EvbCrcFinalise(hEvb, pData);
+}
+
+void EvbCrcClearInterrupt(void)
+{
+}
+
+void EvbCrcReset(void)
+{
+    evbCrcInfo.crc = evbCrcInfo.seed;
+}
+
+void ConfigureDefault(void)
+{
+    ADI_EVB_CRC_PARAMS params = {ADI_EVB_CRC_TYPE_CRC16, 0x1021, 0xFFFF, 0, 0, 0};
+
+    if (evbCrcInfo.isConfigured == 0)
+    {
+        (void)EvbCrcConfigure(&evbCrcInfo, &params);
+    }
+}
+
+void SelectTables(uint32_t regPoly, uint8_t reflectIn)
+{
+    uint32_t i;
+
+    evbCrcInfo.pTable = NULL;
+    for (i = 0; (i < SW_CRC_NUM_TABLES) && (evbCrcInfo.pTable == NULL); i++)
+    {
+        if ((swCrcTables[i].regPoly == regPoly) && (swCrcTables[i].reflectIn == reflectIn))
+        {
+            evbCrcInfo.pTable = swCrcTables[i].pTable;
+        }
+    }
+    if (evbCrcInfo.pTable == NULL)
+    {
+        // Other polynomials are built once, a reconfigure with the same one keeps them
+        if ((evbCrcInfo.isBuilt == 0) || (evbCrcInfo.builtPoly != regPoly) ||
+            (evbCrcInfo.builtReflectIn != reflectIn))
+        {
+            BuildTables(regPoly);
+            evbCrcInfo.builtPoly = regPoly;
+            evbCrcInfo.builtReflectIn = reflectIn;
+            evbCrcInfo.isBuilt = 1;
+        }
+        evbCrcInfo.pTable = (const uint32_t(*)[256])evbCrcInfo.table;
+    }
+}
+
+void BuildTables(uint32_t regPoly)
+{
+    uint32_t i;
+    uint32_t k;
+    uint32_t bit;
+    uint32_t crc;
+    uint32_t prev;
+
+    for (i = 0; i < 256; i++)
+    {
+        if (evbCrcInfo.reflectIn == 1)
+        {
+            crc = i;
+            for (bit = 0; bit < 8; bit++)
+            {
+                crc = ((crc & 1u) != 0) ? ((crc >> 1) ^ regPoly) : (crc >> 1);
+            }
+        }
+        else
+        {
+            crc = i << 24;
+            for (bit = 0; bit < 8; bit++)
+            {
+                crc = ((crc & 0x80000000u) != 0) ? ((crc << 1) ^ regPoly) : (crc << 1);
+            }
+        }
+        evbCrcInfo.table[0][i] = crc;
+    }
+    // Each further table appends a zero byte to the entries of the previous one
+    for (k = 1; k < SW_CRC_NUM_SLICES; k++)
+    {
+        for (i = 0; i < 256; i++)
+        {
+            prev = evbCrcInfo.table[k - 1][i];
+            if (evbCrcInfo.reflectIn == 1)
+            {
+                evbCrcInfo.table[k][i] = (prev >> 8) ^ evbCrcInfo.table[0][prev & 0xFFu];
+            }
+            else
+            {
+                evbCrcInfo.table[k][i] = (prev << 8) ^ evbCrcInfo.table[0][prev >> 24];
+            }
+        }
+    }
+}
+
+uint32_t UpdateReflected(uint32_t crc, const uint8_t *pData, uint32_t numBytes)
+{
+    const uint32_t(*pTable)[256] = evbCrcInfo.pTable;
+
+    while (numBytes >= SW_CRC_NUM_SLICES)
+    {
+        crc ^= (uint32_t)pData[0] | ((uint32_t)pData[1] << 8) | ((uint32_t)pData[2] << 16) |
+               ((uint32_t)pData[3] << 24);
+        crc = pTable[3][crc & 0xFFu] ^ pTable[2][(crc >> 8) & 0xFFu] ^
+              pTable[1][(crc >> 16) & 0xFFu] ^ pTable[0][crc >> 24];
+        pData += SW_CRC_NUM_SLICES;
+        numBytes -= SW_CRC_NUM_SLICES;
+    }
+    while (numBytes > 0)
+    {
+        crc = (crc >> 8) ^ pTable[0][(crc ^ *pData) & 0xFFu];
+        pData++;
+        numBytes--;
+    }
+
+    return crc;
+}
+
+uint32_t UpdateNormal(uint32_t crc, const uint8_t *pData, uint32_t numBytes)
+{
+    const uint32_t(*pTable)[256] = evbCrcInfo.pTable;
+
+    while (numBytes >= SW_CRC_NUM_SLICES)
+    {
+        crc ^= ((uint32_t)pData[0] << 24) | ((uint32_t)pData[1] << 16) |
+               ((uint32_t)pData[2] << 8) | (uint32_t)pData[3];
+        crc = pTable[3][crc >> 24] ^ pTable[2][(crc >> 16) & 0xFFu] ^
+              pTable[1][(crc >> 8) & 0xFFu] ^ pTable[0][crc & 0xFFu];
+        pData += SW_CRC_NUM_SLICES;
+        numBytes -= SW_CRC_NUM_SLICES;
+    }
+    while (numBytes > 0)
+    {
+        crc = (crc << 8) ^ pTable[0][(crc >> 24) ^ *pData];
+        pData++;
+        numBytes--;
+    }
+
+    return crc;
+}
+
+uint32_t ReflectBits(uint32_t value, uint32_t numBits)
+{
+    uint32_t reflected = 0;
+    uint32_t i;
+
+    for (i = 0; i < numBits; i++)
+    {
+        reflected = (reflected << 1) | ((value >> i) & 1u);
+    }
+
+    return reflected;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,764 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     sw_crc_tables.c
+ * @brief    Slice tables of the catalogue CRCs, in the register alignment of sw_crc.c.
+ *           Generated by generic/scripts/gen_sw_crc_tables.py, do not edit.
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+
+#include "sw_crc_tables.h"
+#include <stdint.h>
+
+/*=============  D A T A  =============*/
+
+/** Polynomial 0x04C11DB7, 32 bits, reflected form */
+static const uint32_t tableCrc32Reflected[SW_CRC_NUM_SLICES][256] = {
+    {
+        0x00000000u, 0x77073096u, 0xEE0E612Cu, 0x990951BAu, 0x076DC419u, 0x706AF48Fu,
+        0xE963A535u, 0x9E6495A3u, 0x0EDB8832u, 0x79DCB8A4u, 0xE0D5E91Eu, 0x97D2D988u,
+        0x09B64C2Bu, 0x7EB17CBDu, 0xE7B82D07u, 0x90BF1D91u, 0x1DB71064u, 0x6AB020F2u,
+        0xF3B97148u, 0x84BE41DEu, 0x1ADAD47Du, 0x6DDDE4EBu, 0xF4D4B551u, 0x83D385C7u,
+        0x136C9856u, 0x646BA8C0u, 0xFD62F97Au, 0x8A65C9ECu, 0x14015C4Fu, 0x63066CD9u,
+        0xFA0F3D63u, 0x8D080DF5u, 0x3B6E20C8u, 0x4C69105Eu, 0xD56041E4u, 0xA2677172u,
+        0x3C03E4D1u, 0x4B04D447u, 0xD20D85FDu, 0xA50AB56Bu, 0x35B5A8FAu, 0x42B2986Cu,
+        0xDBBBC9D6u, 0xACBCF940u, 0x32D86CE3u, 0x45DF5C75u, 0xDCD60DCFu, 0xABD13D59u,
+        0x26D930ACu, 0x51DE003Au, 0xC8D75180u, 0xBFD06116u, 0x21B4F4B5u, 0x56B3C423u,
+        0xCFBA9599u, 0xB8BDA50Fu, 0x2802B89Eu, 0x5F058808u, 0xC60CD9B2u, 0xB10BE924u,
+        0x2F6F7C87u, 0x58684C11u, 0xC1611DABu, 0xB6662D3Du, 0x76DC4190u, 0x01DB7106u,
+        0x98D220BCu, 0xEFD5102Au, 0x71B18589u, 0x06B6B51Fu, 0x9FBFE4A5u, 0xE8B8D433u,
+        0x7807C9A2u, 0x0F00F934u, 0x9609A88Eu, 0xE10E9818u, 0x7F6A0DBBu, 0x086D3D2Du,
+        0x91646C97u, 0xE6635C01u, 0x6B6B51F4u, 0x1C6C6162u, 0x856530D8u, 0xF262004Eu,
+        0x6C0695EDu, 0x1B01A57Bu, 0x8208F4C1u, 0xF50FC457u, 0x65B0D9C6u, 0x12B7E950u,
+        0x8BBEB8EAu, 0xFCB9887Cu, 0x62DD1DDFu, 0x15DA2D49u, 0x8CD37CF3u, 0xFBD44C65u,
+        0x4DB26158u, 0x3AB551CEu, 0xA3BC0074u, 0xD4BB30E2u, 0x4ADFA541u, 0x3DD895D7u,
+        0xA4D1C46Du, 0xD3D6F4FBu, 0x4369E96Au, 0x346ED9FCu, 0xAD678846u, 0xDA60B8D0u,
+        0x44042D73u, 0x33031DE5u, 0xAA0A4C5Fu, 0xDD0D7CC9u, 0x5005713Cu, 0x270241AAu,
+        0xBE0B1010u, 0xC90C2086u, 0x5768B525u, 0x206F85B3u, 0xB966D409u, 0xCE61E49Fu,
+        0x5EDEF90Eu, 0x29D9C998u, 0xB0D09822u, 0xC7D7A8B4u, 0x59B33D17u, 0x2EB40D81u,
+        0xB7BD5C3Bu, 0xC0BA6CADu, 0xEDB88320u, 0x9ABFB3B6u, 0x03B6E20Cu, 0x74B1D29Au,
+        0xEAD54739u, 0x9DD277AFu, 0x04DB2615u, 0x73DC1683u, 0xE3630B12u, 0x94643B84u,
+        0x0D6D6A3Eu, 0x7A6A5AA8u, 0xE40ECF0Bu, 0x9309FF9Du, 0x0A00AE27u, 0x7D079EB1u,
+        0xF00F9344u, 0x8708A3D2u, 0x1E01F268u, 0x6906C2FEu, 0xF762575Du, 0x806567CBu,
+        0x196C3671u, 0x6E6B06E7u, 0xFED41B76u, 0x89D32BE0u, 0x10DA7A5Au, 0x67DD4ACCu,
+        0xF9B9DF6Fu, 0x8EBEEFF9u, 0x17B7BE43u, 0x60B08ED5u, 0xD6D6A3E8u, 0xA1D1937Eu,
+        0x38D8C2C4u, 0x4FDFF252u, 0xD1BB67F1u, 0xA6BC5767u, 0x3FB506DDu, 0x48B2364Bu,
+        0xD80D2BDAu, 0xAF0A1B4Cu, 0x36034AF6u, 0x41047A60u, 0xDF60EFC3u, 0xA867DF55u,
+        0x316E8EEFu, 0x4669BE79u, 0xCB61B38Cu, 0xBC66831Au, 0x256FD2A0u, 0x5268E236u,
+        0xCC0C7795u, 0xBB0B4703u, 0x220216B9u, 0x5505262Fu, 0xC5BA3BBEu, 0xB2BD0B28u,
+        0x2BB45A92u, 0x5CB36A04u, 0xC2D7FFA7u, 0xB5D0CF31u, 0x2CD99E8Bu, 0x5BDEAE1Du,
+        0x9B64C2B0u, 0xEC63F226u, 0x756AA39Cu, 0x026D930Au, 0x9C0906A9u, 0xEB0E363Fu,
+        0x72076785u, 0x05005713u, 0x95BF4A82u, 0xE2B87A14u, 0x7BB12BAEu, 0x0CB61B38u,
+        0x92D28E9Bu, 0xE5D5BE0Du, 0x7CDCEFB7u, 0x0BDBDF21u, 0x86D3D2D4u, 0xF1D4E242u,
+        0x68DDB3F8u, 0x1FDA836Eu, 0x81BE16CDu, 0xF6B9265Bu, 0x6FB077E1u, 0x18B74777u,
+        0x88085AE6u, 0xFF0F6A70u, 0x66063BCAu, 0x11010B5Cu, 0x8F659EFFu, 0xF862AE69u,
+        0x616BFFD3u, 0x166CCF45u, 0xA00AE278u, 0xD70DD2EEu, 0x4E048354u, 0x3903B3C2u,
+        0xA7672661u, 0xD06016F7u, 0x4969474Du, 0x3E6E77DBu, 0xAED16A4Au, 0xD9D65ADCu,
+        0x40DF0B66u, 0x37D83BF0u, 0xA9BCAE53u, 0xDEBB9EC5u, 0x47B2CF7Fu, 0x30B5FFE9u,
+        0xBDBDF21Cu, 0xCABAC28Au, 0x53B39330u, 0x24B4A3A6u, 0xBAD03605u, 0xCDD70693u,
+        0x54DE5729u, 0x23D967BFu, 0xB3667A2Eu, 0xC4614AB8u, 0x5D681B02u, 0x2A6F2B94u,
+        0xB40BBE37u, 0xC30C8EA1u, 0x5A05DF1Bu, 0x2D02EF8Du,
+    },
+    {
+        0x00000000u, 0x191B3141u, 0x32366282u, 0x2B2D53C3u, 0x646CC504u, 0x7D77F445u,
+        0x565AA786u, 0x4F4196C7u, 0xC8D98A08u, 0xD1C2BB49u, 0xFAEFE88Au, 0xE3F4D9CBu,
+        0xACB54F0Cu, 0xB5AE7E4Du, 0x9E832D8Eu, 0x87981CCFu, 0x4AC21251u, 0x53D92310u,
+        0x78F470D3u, 0x61EF4192u, 0x2EAED755u, 0x37B5E614u, 0x1C98B5D7u, 0x05838496u,
+        0x821B9859u, 0x9B00A918u, 0xB02DFADBu, 0xA936CB9Au, 0xE6775D5Du, 0xFF6C6C1Cu,
+        0xD4413FDFu, 0xCD5A0E9Eu, 0x958424A2u, 0x8C9F15E3u, 0xA7B24620u, 0xBEA97761u,
+        0xF1E8E1A6u, 0xE8F3D0E7u, 0xC3DE8324u, 0xDAC5B265u, 0x5D5DAEAAu, 0x44469FEBu,
+        0x6F6BCC28u, 0x7670FD69u, 0x39316BAEu, 0x202A5AEFu, 0x0B07092Cu, 0x121C386Du,
+        0xDF4636F3u, 0xC65D07B2u, 0xED705471u, 0xF46B6530u, 0xBB2AF3F7u, 0xA231C2B6u,
+        0x891C9175u, 0x9007A034u, 0x179FBCFBu, 0x0E848DBAu, 0x25A9DE79u, 0x3CB2EF38u,
+        0x73F379FFu, 0x6AE848BEu, 0x41C51B7Du, 0x58DE2A3Cu, 0xF0794F05u, 0xE9627E44u,
+        0xC24F2D87u, 0xDB541CC6u, 0x94158A01u, 0x8D0EBB40u, 0xA623E883u, 0xBF38D9C2u,
+        0x38A0C50Du, 0x21BBF44Cu, 0x0A96A78Fu, 0x138D96CEu, 0x5CCC0009u, 0x45D73148u,
+        0x6EFA628Bu, 0x77E153CAu, 0xBABB5D54u, 0xA3A06C15u, 0x888D3FD6u, 0x91960E97u,
+        0xDED79850u, 0xC7CCA911u, 0xECE1FAD2u, 0xF5FACB93u, 0x7262D75Cu, 0x6B79E61Du,
+        0x4054B5DEu, 0x594F849Fu, 0x160E1258u, 0x0F152319u, 0x243870DAu, 0x3D23419Bu,
+        0x65FD6BA7u, 0x7CE65AE6u, 0x57CB0925u, 0x4ED03864u, 0x0191AEA3u, 0x188A9FE2u,
+        0x33A7CC21u, 0x2ABCFD60u, 0xAD24E1AFu, 0xB43FD0EEu, 0x9F12832Du, 0x8609B26Cu,
+        0xC94824ABu, 0xD05315EAu, 0xFB7E4629u, 0xE2657768u, 0x2F3F79F6u, 0x362448B7u,
+        0x1D091B74u, 0x04122A35u, 0x4B53BCF2u, 0x52488DB3u, 0x7965DE70u, 0x607EEF31u,
+        0xE7E6F3FEu, 0xFEFDC2BFu, 0xD5D0917Cu, 0xCCCBA03Du, 0x838A36FAu, 0x9A9107BBu,
+        0xB1BC5478u, 0xA8A76539u, 0x3B83984Bu, 0x2298A90Au, 0x09B5FAC9u, 0x10AECB88u,
+        0x5FEF5D4Fu, 0x46F46C0Eu, 0x6DD93FCDu, 0x74C20E8Cu, 0xF35A1243u, 0xEA412302u,
+        0xC16C70C1u, 0xD8774180u, 0x9736D747u, 0x8E2DE606u, 0xA500B5C5u, 0xBC1B8484u,
+        0x71418A1Au, 0x685ABB5Bu, 0x4377E898u, 0x5A6CD9D9u, 0x152D4F1Eu, 0x0C367E5Fu,
+        0x271B2D9Cu, 0x3E001CDDu, 0xB9980012u, 0xA0833153u, 0x8BAE6290u, 0x92B553D1u,
+        0xDDF4C516u, 0xC4EFF457u, 0xEFC2A794u, 0xF6D996D5u, 0xAE07BCE9u, 0xB71C8DA8u,
+        0x9C31DE6Bu, 0x852AEF2Au, 0xCA6B79EDu, 0xD37048ACu, 0xF85D1B6Fu, 0xE1462A2Eu,
+        0x66DE36E1u, 0x7FC507A0u, 0x54E85463u, 0x4DF36522u, 0x02B2F3E5u, 0x1BA9C2A4u,
+        0x30849167u, 0x299FA026u, 0xE4C5AEB8u, 0xFDDE9FF9u, 0xD6F3CC3Au, 0xCFE8FD7Bu,
+        0x80A96BBCu, 0x99B25AFDu, 0xB29F093Eu, 0xAB84387Fu, 0x2C1C24B0u, 0x350715F1u,
+        0x1E2A4632u, 0x07317773u, 0x4870E1B4u, 0x516BD0F5u, 0x7A468336u, 0x635DB277u,
+        0xCBFAD74Eu, 0xD2E1E60Fu, 0xF9CCB5CCu, 0xE0D7848Du, 0xAF96124Au, 0xB68D230Bu,
+        0x9DA070C8u, 0x84BB4189u, 0x03235D46u, 0x1A386C07u, 0x31153FC4u, 0x280E0E85u,
+        0x674F9842u, 0x7E54A903u, 0x5579FAC0u, 0x4C62CB81u, 0x8138C51Fu, 0x9823F45Eu,
+        0xB30EA79Du, 0xAA1596DCu, 0xE554001Bu, 0xFC4F315Au, 0xD7626299u, 0xCE7953D8u,
+        0x49E14F17u, 0x50FA7E56u, 0x7BD72D95u, 0x62CC1CD4u, 0x2D8D8A13u, 0x3496BB52u,
+        0x1FBBE891u, 0x06A0D9D0u, 0x5E7EF3ECu, 0x4765C2ADu, 0x6C48916Eu, 0x7553A02Fu,
+        0x3A1236E8u, 0x230907A9u, 0x0824546Au, 0x113F652Bu, 0x96A779E4u, 0x8FBC48A5u,
+        0xA4911B66u, 0xBD8A2A27u, 0xF2CBBCE0u, 0xEBD08DA1u, 0xC0FDDE62u, 0xD9E6EF23u,
+        0x14BCE1BDu, 0x0DA7D0FCu, 0x268A833Fu, 0x3F91B27Eu, 0x70D024B9u, 0x69CB15F8u,
+        0x42E6463Bu, 0x5BFD777Au, 0xDC656BB5u, 0xC57E5AF4u, 0xEE530937u, 0xF7483876u,
+        0xB809AEB1u, 0xA1129FF0u, 0x8A3FCC33u, 0x9324FD72u,
+    },
+    {
+        0x00000000u, 0x01C26A37u, 0x0384D46Eu, 0x0246BE59u, 0x0709A8DCu, 0x06CBC2EBu,
+        0x048D7CB2u, 0x054F1685u, 0x0E1351B8u, 0x0FD13B8Fu, 0x0D9785D6u, 0x0C55EFE1u,
+        0x091AF964u, 0x08D89353u, 0x0A9E2D0Au, 0x0B5C473Du, 0x1C26A370u, 0x1DE4C947u,
+        0x1FA2771Eu, 0x1E601D29u, 0x1B2F0BACu, 0x1AED619Bu, 0x18ABDFC2u, 0x1969B5F5u,
+        0x1235F2C8u, 0x13F798FFu, 0x11B126A6u, 0x10734C91u, 0x153C5A14u, 0x14FE3023u,
+        0x16B88E7Au, 0x177AE44Du, 0x384D46E0u, 0x398F2CD7u, 0x3BC9928Eu, 0x3A0BF8B9u,
+        0x3F44EE3Cu, 0x3E86840Bu, 0x3CC03A52u, 0x3D025065u, 0x365E1758u, 0x379C7D6Fu,
+        0x35DAC336u, 0x3418A901u, 0x3157BF84u, 0x3095D5B3u, 0x32D36BEAu, 0x331101DDu,
+        0x246BE590u, 0x25A98FA7u, 0x27EF31FEu, 0x262D5BC9u, 0x23624D4Cu, 0x22A0277Bu,
+        0x20E69922u, 0x2124F315u, 0x2A78B428u, 0x2BBADE1Fu, 0x29FC6046u, 0x283E0A71u,
+        0x2D711CF4u, 0x2CB376C3u, 0x2EF5C89Au, 0x2F37A2ADu, 0x709A8DC0u, 0x7158E7F7u,
+        0x731E59AEu, 0x72DC3399u, 0x7793251Cu, 0x76514F2Bu, 0x7417F172u, 0x75D59B45u,
+        0x7E89DC78u, 0x7F4BB64Fu, 0x7D0D0816u, 0x7CCF6221u, 0x798074A4u, 0x78421E93u,
+        0x7A04A0CAu, 0x7BC6CAFDu, 0x6CBC2EB0u, 0x6D7E4487u, 0x6F38FADEu, 0x6EFA90E9u,
+        0x6BB5866Cu, 0x6A77EC5Bu, 0x68315202u, 0x69F33835u, 0x62AF7F08u, 0x636D153Fu,
+        0x612BAB66u, 0x60E9C151u, 0x65A6D7D4u, 0x6464BDE3u, 0x662203BAu, 0x67E0698Du,
+        0x48D7CB20u, 0x4915A117u, 0x4B531F4Eu, 0x4A917579u, 0x4FDE63FCu, 0x4E1C09CBu,
+        0x4C5AB792u, 0x4D98DDA5u, 0x46C49A98u, 0x4706F0AFu, 0x45404EF6u, 0x448224C1u,
+        0x41CD3244u, 0x400F5873u, 0x4249E62Au, 0x438B8C1Du, 0x54F16850u, 0x55330267u,
+        0x5775BC3Eu, 0x56B7D609u, 0x53F8C08Cu, 0x523AAABBu, 0x507C14E2u, 0x51BE7ED5u,
+        0x5AE239E8u, 0x5B2053DFu, 0x5966ED86u, 0x58A487B1u, 0x5DEB9134u, 0x5C29FB03u,
+        0x5E6F455Au, 0x5FAD2F6Du, 0xE1351B80u, 0xE0F771B7u, 0xE2B1CFEEu, 0xE373A5D9u,
+        0xE63CB35Cu, 0xE7FED96Bu, 0xE5B86732u, 0xE47A0D05u, 0xEF264A38u, 0xEEE4200Fu,
+        0xECA29E56u, 0xED60F461u, 0xE82FE2E4u, 0xE9ED88D3u, 0xEBAB368Au, 0xEA695CBDu,
+        0xFD13B8F0u, 0xFCD1D2C7u, 0xFE976C9Eu, 0xFF5506A9u, 0xFA1A102Cu, 0xFBD87A1Bu,
+        0xF99EC442u, 0xF85CAE75u, 0xF300E948u, 0xF2C2837Fu, 0xF0843D26u, 0xF1465711u,
+        0xF4094194u, 0xF5CB2BA3u, 0xF78D95FAu, 0xF64FFFCDu, 0xD9785D60u, 0xD8BA3757u,
+        0xDAFC890Eu, 0xDB3EE339u, 0xDE71F5BCu, 0xDFB39F8Bu, 0xDDF521D2u, 0xDC374BE5u,
+        0xD76B0CD8u, 0xD6A966EFu, 0xD4EFD8B6u, 0xD52DB281u, 0xD062A404u, 0xD1A0CE33u,
+        0xD3E6706Au, 0xD2241A5Du, 0xC55EFE10u, 0xC49C9427u, 0xC6DA2A7Eu, 0xC7184049u,
+        0xC25756CCu, 0xC3953CFBu, 0xC1D382A2u, 0xC011E895u, 0xCB4DAFA8u, 0xCA8FC59Fu,
+        0xC8C97BC6u, 0xC90B11F1u, 0xCC440774u, 0xCD866D43u, 0xCFC0D31Au, 0xCE02B92Du,
+        0x91AF9640u, 0x906DFC77u, 0x922B422Eu, 0x93E92819u, 0x96A63E9Cu, 0x976454ABu,
+        0x9522EAF2u, 0x94E080C5u, 0x9FBCC7F8u, 0x9E7EADCFu, 0x9C381396u, 0x9DFA79A1u,
+        0x98B56F24u, 0x99770513u, 0x9B31BB4Au, 0x9AF3D17Du, 0x8D893530u, 0x8C4B5F07u,
+        0x8E0DE15Eu, 0x8FCF8B69u, 0x8A809DECu, 0x8B42F7DBu, 0x89044982u, 0x88C623B5u,
+        0x839A6488u, 0x82580EBFu, 0x801EB0E6u, 0x81DCDAD1u, 0x8493CC54u, 0x8551A663u,
+        0x8717183Au, 0x86D5720Du, 0xA9E2D0A0u, 0xA820BA97u, 0xAA6604CEu, 0xABA46EF9u,
+        0xAEEB787Cu, 0xAF29124Bu, 0xAD6FAC12u, 0xACADC625u, 0xA7F18118u, 0xA633EB2Fu,
+        0xA4755576u, 0xA5B73F41u, 0xA0F829C4u, 0xA13A43F3u, 0xA37CFDAAu, 0xA2BE979Du,
+        0xB5C473D0u, 0xB40619E7u, 0xB640A7BEu, 0xB782CD89u, 0xB2CDDB0Cu, 0xB30FB13Bu,
+        0xB1490F62u, 0xB08B6555u, 0xBBD72268u, 0xBA15485Fu, 0xB853F606u, 0xB9919C31u,
+        0xBCDE8AB4u, 0xBD1CE083u, 0xBF5A5EDAu, 0xBE9834EDu,
+    },
+    {
+        0x00000000u, 0xB8BC6765u, 0xAA09C88Bu, 0x12B5AFEEu, 0x8F629757u, 0x37DEF032u,
+        0x256B5FDCu, 0x9DD738B9u, 0xC5B428EFu, 0x7D084F8Au, 0x6FBDE064u, 0xD7018701u,
+        0x4AD6BFB8u, 0xF26AD8DDu, 0xE0DF7733u, 0x58631056u, 0x5019579Fu, 0xE8A530FAu,
+        0xFA109F14u, 0x42ACF871u, 0xDF7BC0C8u, 0x67C7A7ADu, 0x75720843u, 0xCDCE6F26u,
+        0x95AD7F70u, 0x2D111815u, 0x3FA4B7FBu, 0x8718D09Eu, 0x1ACFE827u, 0xA2738F42u,
+        0xB0C620ACu, 0x087A47C9u, 0xA032AF3Eu, 0x188EC85Bu, 0x0A3B67B5u, 0xB28700D0u,
+        0x2F503869u, 0x97EC5F0Cu, 0x8559F0E2u, 0x3DE59787u, 0x658687D1u, 0xDD3AE0B4u,
+        0xCF8F4F5Au, 0x7733283Fu, 0xEAE41086u, 0x525877E3u, 0x40EDD80Du, 0xF851BF68u,
+        0xF02BF8A1u, 0x48979FC4u, 0x5A22302Au, 0xE29E574Fu, 0x7F496FF6u, 0xC7F50893u,
+        0xD540A77Du, 0x6DFCC018u, 0x359FD04Eu, 0x8D23B72Bu, 0x9F9618C5u, 0x272A7FA0u,
+        0xBAFD4719u, 0x0241207Cu, 0x10F48F92u, 0xA848E8F7u, 0x9B14583Du, 0x23A83F58u,
+        0x311D90B6u, 0x89A1F7D3u, 0x1476CF6Au, 0xACCAA80Fu, 0xBE7F07E1u, 0x06C36084u,
+        0x5EA070D2u, 0xE61C17B7u, 0xF4A9B859u, 0x4C15DF3Cu, 0xD1C2E785u, 0x697E80E0u,
+        0x7BCB2F0Eu, 0xC377486Bu, 0xCB0D0FA2u, 0x73B168C7u, 0x6104C729u, 0xD9B8A04Cu,
+        0x446F98F5u, 0xFCD3FF90u, 0xEE66507Eu, 0x56DA371Bu, 0x0EB9274Du, 0xB6054028u,
+        0xA4B0EFC6u, 0x1C0C88A3u, 0x81DBB01Au, 0x3967D77Fu, 0x2BD27891u, 0x936E1FF4u,
+        0x3B26F703u, 0x839A9066u, 0x912F3F88u, 0x299358EDu, 0xB4446054u, 0x0CF80731u,
+        0x1E4DA8DFu, 0xA6F1CFBAu, 0xFE92DFECu, 0x462EB889u, 0x549B1767u, 0xEC277002u,
+        0x71F048BBu, 0xC94C2FDEu, 0xDBF98030u, 0x6345E755u, 0x6B3FA09Cu, 0xD383C7F9u,
+        0xC1366817u, 0x798A0F72u, 0xE45D37CBu, 0x5CE150AEu, 0x4E54FF40u, 0xF6E89825u,
+        0xAE8B8873u, 0x1637EF16u, 0x048240F8u, 0xBC3E279Du, 0x21E91F24u, 0x99557841u,
+        0x8BE0D7AFu, 0x335CB0CAu, 0xED59B63Bu, 0x55E5D15Eu, 0x47507EB0u, 0xFFEC19D5u,
+        0x623B216Cu, 0xDA874609u, 0xC832E9E7u, 0x708E8E82u, 0x28ED9ED4u, 0x9051F9B1u,
+        0x82E4565Fu, 0x3A58313Au, 0xA78F0983u, 0x1F336EE6u, 0x0D86C108u, 0xB53AA66Du,
+        0xBD40E1A4u, 0x05FC86C1u, 0x1749292Fu, 0xAFF54E4Au, 0x322276F3u, 0x8A9E1196u,
+        0x982BBE78u, 0x2097D91Du, 0x78F4C94Bu, 0xC048AE2Eu, 0xD2FD01C0u, 0x6A4166A5u,
+        0xF7965E1Cu, 0x4F2A3979u, 0x5D9F9697u, 0xE523F1F2u, 0x4D6B1905u, 0xF5D77E60u,
+        0xE762D18Eu, 0x5FDEB6EBu, 0xC2098E52u, 0x7AB5E937u, 0x680046D9u, 0xD0BC21BCu,
+        0x88DF31EAu, 0x3063568Fu, 0x22D6F961u, 0x9A6A9E04u, 0x07BDA6BDu, 0xBF01C1D8u,
+        0xADB46E36u, 0x15080953u, 0x1D724E9Au, 0xA5CE29FFu, 0xB77B8611u, 0x0FC7E174u,
+        0x9210D9CDu, 0x2AACBEA8u, 0x38191146u, 0x80A57623u, 0xD8C66675u, 0x607A0110u,
+        0x72CFAEFEu, 0xCA73C99Bu, 0x57A4F122u, 0xEF189647u, 0xFDAD39A9u, 0x45115ECCu,
+        0x764DEE06u, 0xCEF18963u, 0xDC44268Du, 0x64F841E8u, 0xF92F7951u, 0x41931E34u,
+        0x5326B1DAu, 0xEB9AD6BFu, 0xB3F9C6E9u, 0x0B45A18Cu, 0x19F00E62u, 0xA14C6907u,
+        0x3C9B51BEu, 0x842736DBu, 0x96929935u, 0x2E2EFE50u, 0x2654B999u, 0x9EE8DEFCu,
+        0x8C5D7112u, 0x34E11677u, 0xA9362ECEu, 0x118A49ABu, 0x033FE645u, 0xBB838120u,
+        0xE3E09176u, 0x5B5CF613u, 0x49E959FDu, 0xF1553E98u, 0x6C820621u, 0xD43E6144u,
+        0xC68BCEAAu, 0x7E37A9CFu, 0xD67F4138u, 0x6EC3265Du, 0x7C7689B3u, 0xC4CAEED6u,
+        0x591DD66Fu, 0xE1A1B10Au, 0xF3141EE4u, 0x4BA87981u, 0x13CB69D7u, 0xAB770EB2u,
+        0xB9C2A15Cu, 0x017EC639u, 0x9CA9FE80u, 0x241599E5u, 0x36A0360Bu, 0x8E1C516Eu,
+        0x866616A7u, 0x3EDA71C2u, 0x2C6FDE2Cu, 0x94D3B949u, 0x090481F0u, 0xB1B8E695u,
+        0xA30D497Bu, 0x1BB12E1Eu, 0x43D23E48u, 0xFB6E592Du, 0xE9DBF6C3u, 0x516791A6u,
+        0xCCB0A91Fu, 0x740CCE7Au, 0x66B96194u, 0xDE0506F1u,
+    },
+};
+
+/** Polynomial 0x1021, 16 bits, normal form */
+static const uint32_t tableCrc16Normal[SW_CRC_NUM_SLICES][256] = {
+    {
+        0x00000000u, 0x10210000u, 0x20420000u, 0x30630000u, 0x40840000u, 0x50A50000u,
+        0x60C60000u, 0x70E70000u, 0x81080000u, 0x91290000u, 0xA14A0000u, 0xB16B0000u,
+        0xC18C0000u, 0xD1AD0000u, 0xE1CE0000u, 0xF1EF0000u, 0x12310000u, 0x02100000u,
+        0x32730000u, 0x22520000u, 0x52B50000u, 0x42940000u, 0x72F70000u, 0x62D60000u,
+        0x93390000u, 0x83180000u, 0xB37B0000u, 0xA35A0000u, 0xD3BD0000u, 0xC39C0000u,
+        0xF3FF0000u, 0xE3DE0000u, 0x24620000u, 0x34430000u, 0x04200000u, 0x14010000u,
+        0x64E60000u, 0x74C70000u, 0x44A40000u, 0x54850000u, 0xA56A0000u, 0xB54B0000u,
+        0x85280000u, 0x95090000u, 0xE5EE0000u, 0xF5CF0000u, 0xC5AC0000u, 0xD58D0000u,
+        0x36530000u, 0x26720000u, 0x16110000u, 0x06300000u, 0x76D70000u, 0x66F60000u,
+        0x56950000u, 0x46B40000u, 0xB75B0000u, 0xA77A0000u, 0x97190000u, 0x87380000u,
+        0xF7DF0000u, 0xE7FE0000u, 0xD79D0000u, 0xC7BC0000u, 0x48C40000u, 0x58E50000u,
+        0x68860000u, 0x78A70000u, 0x08400000u, 0x18610000u, 0x28020000u, 0x38230000u,
+        0xC9CC0000u, 0xD9ED0000u, 0xE98E0000u, 0xF9AF0000u, 0x89480000u, 0x99690000u,
+        0xA90A0000u, 0xB92B0000u, 0x5AF50000u, 0x4AD40000u, 0x7AB70000u, 0x6A960000u,
+        0x1A710000u, 0x0A500000u, 0x3A330000u, 0x2A120000u, 0xDBFD0000u, 0xCBDC0000u,
+        0xFBBF0000u, 0xEB9E0000u, 0x9B790000u, 0x8B580000u, 0xBB3B0000u, 0xAB1A0000u,
+        0x6CA60000u, 0x7C870000u, 0x4CE40000u, 0x5CC50000u, 0x2C220000u, 0x3C030000u,
+        0x0C600000u, 0x1C410000u, 0xEDAE0000u, 0xFD8F0000u, 0xCDEC0000u, 0xDDCD0000u,
+        0xAD2A0000u, 0xBD0B0000u, 0x8D680000u, 0x9D490000u, 0x7E970000u, 0x6EB60000u,
+        0x5ED50000u, 0x4EF40000u, 0x3E130000u, 0x2E320000u, 0x1E510000u, 0x0E700000u,
+        0xFF9F0000u, 0xEFBE0000u, 0xDFDD0000u, 0xCFFC0000u, 0xBF1B0000u, 0xAF3A0000u,
+        0x9F590000u, 0x8F780000u, 0x91880000u, 0x81A90000u, 0xB1CA0000u, 0xA1EB0000u,
+        0xD10C0000u, 0xC12D0000u, 0xF14E0000u, 0xE16F0000u, 0x10800000u, 0x00A10000u,
+        0x30C20000u, 0x20E30000u, 0x50040000u, 0x40250000u, 0x70460000u, 0x60670000u,
+        0x83B90000u, 0x93980000u, 0xA3FB0000u, 0xB3DA0000u, 0xC33D0000u, 0xD31C0000u,
+        0xE37F0000u, 0xF35E0000u, 0x02B10000u, 0x12900000u, 0x22F30000u, 0x32D20000u,
+        0x42350000u, 0x52140000u, 0x62770000u, 0x72560000u, 0xB5EA0000u, 0xA5CB0000u,
+        0x95A80000u, 0x85890000u, 0xF56E0000u, 0xE54F0000u, 0xD52C0000u, 0xC50D0000u,
+        0x34E20000u, 0x24C30000u, 0x14A00000u, 0x04810000u, 0x74660000u, 0x64470000u,
+        0x54240000u, 0x44050000u, 0xA7DB0000u, 0xB7FA0000u, 0x87990000u, 0x97B80000u,
+        0xE75F0000u, 0xF77E0000u, 0xC71D0000u, 0xD73C0000u, 0x26D30000u, 0x36F20000u,
+        0x06910000u, 0x16B00000u, 0x66570000u, 0x76760000u, 0x46150000u, 0x56340000u,
+        0xD94C0000u, 0xC96D0000u, 0xF90E0000u, 0xE92F0000u, 0x99C80000u, 0x89E90000u,
+        0xB98A0000u, 0xA9AB0000u, 0x58440000u, 0x48650000u, 0x78060000u, 0x68270000u,
+        0x18C00000u, 0x08E10000u, 0x38820000u, 0x28A30000u, 0xCB7D0000u, 0xDB5C0000u,
+        0xEB3F0000u, 0xFB1E0000u, 0x8BF90000u, 0x9BD80000u, 0xABBB0000u, 0xBB9A0000u,
+        0x4A750000u, 0x5A540000u, 0x6A370000u, 0x7A160000u, 0x0AF10000u, 0x1AD00000u,
+        0x2AB30000u, 0x3A920000u, 0xFD2E0000u, 0xED0F0000u, 0xDD6C0000u, 0xCD4D0000u,
+        0xBDAA0000u, 0xAD8B0000u, 0x9DE80000u, 0x8DC90000u, 0x7C260000u, 0x6C070000u,
+        0x5C640000u, 0x4C450000u, 0x3CA20000u, 0x2C830000u, 0x1CE00000u, 0x0CC10000u,
+        0xEF1F0000u, 0xFF3E0000u, 0xCF5D0000u, 0xDF7C0000u, 0xAF9B0000u, 0xBFBA0000u,
+        0x8FD90000u, 0x9FF80000u, 0x6E170000u, 0x7E360000u, 0x4E550000u, 0x5E740000u,
+        0x2E930000u, 0x3EB20000u, 0x0ED10000u, 0x1EF00000u,
+    },
+    {
+        0x00000000u, 0x33310000u, 0x66620000u, 0x55530000u, 0xCCC40000u, 0xFFF50000u,
+        0xAAA60000u, 0x99970000u, 0x89A90000u, 0xBA980000u, 0xEFCB0000u, 0xDCFA0000u,
+        0x456D0000u, 0x765C0000u, 0x230F0000u, 0x103E0000u, 0x03730000u, 0x30420000u,
+        0x65110000u, 0x56200000u, 0xCFB70000u, 0xFC860000u, 0xA9D50000u, 0x9AE40000u,
+        0x8ADA0000u, 0xB9EB0000u, 0xECB80000u, 0xDF890000u, 0x461E0000u, 0x752F0000u,
+        0x207C0000u, 0x134D0000u, 0x06E60000u, 0x35D70000u, 0x60840000u, 0x53B50000u,
+        0xCA220000u, 0xF9130000u, 0xAC400000u, 0x9F710000u, 0x8F4F0000u, 0xBC7E0000u,
+        0xE92D0000u, 0xDA1C0000u, 0x438B0000u, 0x70BA0000u, 0x25E90000u, 0x16D80000u,
+        0x05950000u, 0x36A40000u, 0x63F70000u, 0x50C60000u, 0xC9510000u, 0xFA600000u,
+        0xAF330000u, 0x9C020000u, 0x8C3C0000u, 0xBF0D0000u, 0xEA5E0000u, 0xD96F0000u,
+        0x40F80000u, 0x73C90000u, 0x269A0000u, 0x15AB0000u, 0x0DCC0000u, 0x3EFD0000u,
+        0x6BAE0000u, 0x589F0000u, 0xC1080000u, 0xF2390000u, 0xA76A0000u, 0x945B0000u,
+        0x84650000u, 0xB7540000u, 0xE2070000u, 0xD1360000u, 0x48A10000u, 0x7B900000u,
+        0x2EC30000u, 0x1DF20000u, 0x0EBF0000u, 0x3D8E0000u, 0x68DD0000u, 0x5BEC0000u,
+        0xC27B0000u, 0xF14A0000u, 0xA4190000u, 0x97280000u, 0x87160000u, 0xB4270000u,
+        0xE1740000u, 0xD2450000u, 0x4BD20000u, 0x78E30000u, 0x2DB00000u, 0x1E810000u,
+        0x0B2A0000u, 0x381B0000u, 0x6D480000u, 0x5E790000u, 0xC7EE0000u, 0xF4DF0000u,
+        0xA18C0000u, 0x92BD0000u, 0x82830000u, 0xB1B20000u, 0xE4E10000u, 0xD7D00000u,
+        0x4E470000u, 0x7D760000u, 0x28250000u, 0x1B140000u, 0x08590000u, 0x3B680000u,
+        0x6E3B0000u, 0x5D0A0000u, 0xC49D0000u, 0xF7AC0000u, 0xA2FF0000u, 0x91CE0000u,
+        0x81F00000u, 0xB2C10000u, 0xE7920000u, 0xD4A30000u, 0x4D340000u, 0x7E050000u,
+        0x2B560000u, 0x18670000u, 0x1B980000u, 0x28A90000u, 0x7DFA0000u, 0x4ECB0000u,
+        0xD75C0000u, 0xE46D0000u, 0xB13E0000u, 0x820F0000u, 0x92310000u, 0xA1000000u,
+        0xF4530000u, 0xC7620000u, 0x5EF50000u, 0x6DC40000u, 0x38970000u, 0x0BA60000u,
+        0x18EB0000u, 0x2BDA0000u, 0x7E890000u, 0x4DB80000u, 0xD42F0000u, 0xE71E0000u,
+        0xB24D0000u, 0x817C0000u, 0x91420000u, 0xA2730000u, 0xF7200000u, 0xC4110000u,
+        0x5D860000u, 0x6EB70000u, 0x3BE40000u, 0x08D50000u, 0x1D7E0000u, 0x2E4F0000u,
+        0x7B1C0000u, 0x482D0000u, 0xD1BA0000u, 0xE28B0000u, 0xB7D80000u, 0x84E90000u,
+        0x94D70000u, 0xA7E60000u, 0xF2B50000u, 0xC1840000u, 0x58130000u, 0x6B220000u,
+        0x3E710000u, 0x0D400000u, 0x1E0D0000u, 0x2D3C0000u, 0x786F0000u, 0x4B5E0000u,
+        0xD2C90000u, 0xE1F80000u, 0xB4AB0000u, 0x879A0000u, 0x97A40000u, 0xA4950000u,
+        0xF1C60000u, 0xC2F70000u, 0x5B600000u, 0x68510000u, 0x3D020000u, 0x0E330000u,
+        0x16540000u, 0x25650000u, 0x70360000u, 0x43070000u, 0xDA900000u, 0xE9A10000u,
+        0xBCF20000u, 0x8FC30000u, 0x9FFD0000u, 0xACCC0000u, 0xF99F0000u, 0xCAAE0000u,
+        0x53390000u, 0x60080000u, 0x355B0000u, 0x066A0000u, 0x15270000u, 0x26160000u,
+        0x73450000u, 0x40740000u, 0xD9E30000u, 0xEAD20000u, 0xBF810000u, 0x8CB00000u,
+        0x9C8E0000u, 0xAFBF0000u, 0xFAEC0000u, 0xC9DD0000u, 0x504A0000u, 0x637B0000u,
+        0x36280000u, 0x05190000u, 0x10B20000u, 0x23830000u, 0x76D00000u, 0x45E10000u,
+        0xDC760000u, 0xEF470000u, 0xBA140000u, 0x89250000u, 0x991B0000u, 0xAA2A0000u,
+        0xFF790000u, 0xCC480000u, 0x55DF0000u, 0x66EE0000u, 0x33BD0000u, 0x008C0000u,
+        0x13C10000u, 0x20F00000u, 0x75A30000u, 0x46920000u, 0xDF050000u, 0xEC340000u,
+        0xB9670000u, 0x8A560000u, 0x9A680000u, 0xA9590000u, 0xFC0A0000u, 0xCF3B0000u,
+        0x56AC0000u, 0x659D0000u, 0x30CE0000u, 0x03FF0000u,
+    },
+    {
+        0x00000000u, 0x37300000u, 0x6E600000u, 0x59500000u, 0xDCC00000u, 0xEBF00000u,
+        0xB2A00000u, 0x85900000u, 0xA9A10000u, 0x9E910000u, 0xC7C10000u, 0xF0F10000u,
+        0x75610000u, 0x42510000u, 0x1B010000u, 0x2C310000u, 0x43630000u, 0x74530000u,
+        0x2D030000u, 0x1A330000u, 0x9FA30000u, 0xA8930000u, 0xF1C30000u, 0xC6F30000u,
+        0xEAC20000u, 0xDDF20000u, 0x84A20000u, 0xB3920000u, 0x36020000u, 0x01320000u,
+        0x58620000u, 0x6F520000u, 0x86C60000u, 0xB1F60000u, 0xE8A60000u, 0xDF960000u,
+        0x5A060000u, 0x6D360000u, 0x34660000u, 0x03560000u, 0x2F670000u, 0x18570000u,
+        0x41070000u, 0x76370000u, 0xF3A70000u, 0xC4970000u, 0x9DC70000u, 0xAAF70000u,
+        0xC5A50000u, 0xF2950000u, 0xABC50000u, 0x9CF50000u, 0x19650000u, 0x2E550000u,
+        0x77050000u, 0x40350000u, 0x6C040000u, 0x5B340000u, 0x02640000u, 0x35540000u,
+        0xB0C40000u, 0x87F40000u, 0xDEA40000u, 0xE9940000u, 0x1DAD0000u, 0x2A9D0000u,
+        0x73CD0000u, 0x44FD0000u, 0xC16D0000u, 0xF65D0000u, 0xAF0D0000u, 0x983D0000u,
+        0xB40C0000u, 0x833C0000u, 0xDA6C0000u, 0xED5C0000u, 0x68CC0000u, 0x5FFC0000u,
+        0x06AC0000u, 0x319C0000u, 0x5ECE0000u, 0x69FE0000u, 0x30AE0000u, 0x079E0000u,
+        0x820E0000u, 0xB53E0000u, 0xEC6E0000u, 0xDB5E0000u, 0xF76F0000u, 0xC05F0000u,
+        0x990F0000u, 0xAE3F0000u, 0x2BAF0000u, 0x1C9F0000u, 0x45CF0000u, 0x72FF0000u,
+        0x9B6B0000u, 0xAC5B0000u, 0xF50B0000u, 0xC23B0000u, 0x47AB0000u, 0x709B0000u,
+        0x29CB0000u, 0x1EFB0000u, 0x32CA0000u, 0x05FA0000u, 0x5CAA0000u, 0x6B9A0000u,
+        0xEE0A0000u, 0xD93A0000u, 0x806A0000u, 0xB75A0000u, 0xD8080000u, 0xEF380000u,
+        0xB6680000u, 0x81580000u, 0x04C80000u, 0x33F80000u, 0x6AA80000u, 0x5D980000u,
+        0x71A90000u, 0x46990000u, 0x1FC90000u, 0x28F90000u, 0xAD690000u, 0x9A590000u,
+        0xC3090000u, 0xF4390000u, 0x3B5A0000u, 0x0C6A0000u, 0x553A0000u, 0x620A0000u,
+        0xE79A0000u, 0xD0AA0000u, 0x89FA0000u, 0xBECA0000u, 0x92FB0000u, 0xA5CB0000u,
+        0xFC9B0000u, 0xCBAB0000u, 0x4E3B0000u, 0x790B0000u, 0x205B0000u, 0x176B0000u,
+        0x78390000u, 0x4F090000u, 0x16590000u, 0x21690000u, 0xA4F90000u, 0x93C90000u,
+        0xCA990000u, 0xFDA90000u, 0xD1980000u, 0xE6A80000u, 0xBFF80000u, 0x88C80000u,
+        0x0D580000u, 0x3A680000u, 0x63380000u, 0x54080000u, 0xBD9C0000u, 0x8AAC0000u,
+        0xD3FC0000u, 0xE4CC0000u, 0x615C0000u, 0x566C0000u, 0x0F3C0000u, 0x380C0000u,
+        0x143D0000u, 0x230D0000u, 0x7A5D0000u, 0x4D6D0000u, 0xC8FD0000u, 0xFFCD0000u,
+        0xA69D0000u, 0x91AD0000u, 0xFEFF0000u, 0xC9CF0000u, 0x909F0000u, 0xA7AF0000u,
+        0x223F0000u, 0x150F0000u, 0x4C5F0000u, 0x7B6F0000u, 0x575E0000u, 0x606E0000u,
+        0x393E0000u, 0x0E0E0000u, 0x8B9E0000u, 0xBCAE0000u, 0xE5FE0000u, 0xD2CE0000u,
+        0x26F70000u, 0x11C70000u, 0x48970000u, 0x7FA70000u, 0xFA370000u, 0xCD070000u,
+        0x94570000u, 0xA3670000u, 0x8F560000u, 0xB8660000u, 0xE1360000u, 0xD6060000u,
+        0x53960000u, 0x64A60000u, 0x3DF60000u, 0x0AC60000u, 0x65940000u, 0x52A40000u,
+        0x0BF40000u, 0x3CC40000u, 0xB9540000u, 0x8E640000u, 0xD7340000u, 0xE0040000u,
+        0xCC350000u, 0xFB050000u, 0xA2550000u, 0x95650000u, 0x10F50000u, 0x27C50000u,
+        0x7E950000u, 0x49A50000u, 0xA0310000u, 0x97010000u, 0xCE510000u, 0xF9610000u,
+        0x7CF10000u, 0x4BC10000u, 0x12910000u, 0x25A10000u, 0x09900000u, 0x3EA00000u,
+        0x67F00000u, 0x50C00000u, 0xD5500000u, 0xE2600000u, 0xBB300000u, 0x8C000000u,
+        0xE3520000u, 0xD4620000u, 0x8D320000u, 0xBA020000u, 0x3F920000u, 0x08A20000u,
+        0x51F20000u, 0x66C20000u, 0x4AF30000u, 0x7DC30000u, 0x24930000u, 0x13A30000u,
+        0x96330000u, 0xA1030000u, 0xF8530000u, 0xCF630000u,
+    },
+    {
+        0x00000000u, 0x76B40000u, 0xED680000u, 0x9BDC0000u, 0xCAF10000u, 0xBC450000u,
+        0x27990000u, 0x512D0000u, 0x85C30000u, 0xF3770000u, 0x68AB0000u, 0x1E1F0000u,
+        0x4F320000u, 0x39860000u, 0xA25A0000u, 0xD4EE0000u, 0x1BA70000u, 0x6D130000u,
+        0xF6CF0000u, 0x807B0000u, 0xD1560000u, 0xA7E20000u, 0x3C3E0000u, 0x4A8A0000u,
+        0x9E640000u, 0xE8D00000u, 0x730C0000u, 0x05B80000u, 0x54950000u, 0x22210000u,
+        0xB9FD0000u, 0xCF490000u, 0x374E0000u, 0x41FA0000u, 0xDA260000u, 0xAC920000u,
+        0xFDBF0000u, 0x8B0B0000u, 0x10D70000u, 0x66630000u, 0xB28D0000u, 0xC4390000u,
+        0x5FE50000u, 0x29510000u, 0x787C0000u, 0x0EC80000u, 0x95140000u, 0xE3A00000u,
+        0x2CE90000u, 0x5A5D0000u, 0xC1810000u, 0xB7350000u, 0xE6180000u, 0x90AC0000u,
+        0x0B700000u, 0x7DC40000u, 0xA92A0000u, 0xDF9E0000u, 0x44420000u, 0x32F60000u,
+        0x63DB0000u, 0x156F0000u, 0x8EB30000u, 0xF8070000u, 0x6E9C0000u, 0x18280000u,
+        0x83F40000u, 0xF5400000u, 0xA46D0000u, 0xD2D90000u, 0x49050000u, 0x3FB10000u,
+        0xEB5F0000u, 0x9DEB0000u, 0x06370000u, 0x70830000u, 0x21AE0000u, 0x571A0000u,
+        0xCCC60000u, 0xBA720000u, 0x753B0000u, 0x038F0000u, 0x98530000u, 0xEEE70000u,
+        0xBFCA0000u, 0xC97E0000u, 0x52A20000u, 0x24160000u, 0xF0F80000u, 0x864C0000u,
+        0x1D900000u, 0x6B240000u, 0x3A090000u, 0x4CBD0000u, 0xD7610000u, 0xA1D50000u,
+        0x59D20000u, 0x2F660000u, 0xB4BA0000u, 0xC20E0000u, 0x93230000u, 0xE5970000u,
+        0x7E4B0000u, 0x08FF0000u, 0xDC110000u, 0xAAA50000u, 0x31790000u, 0x47CD0000u,
+        0x16E00000u, 0x60540000u, 0xFB880000u, 0x8D3C0000u, 0x42750000u, 0x34C10000u,
+        0xAF1D0000u, 0xD9A90000u, 0x88840000u, 0xFE300000u, 0x65EC0000u, 0x13580000u,
+        0xC7B60000u, 0xB1020000u, 0x2ADE0000u, 0x5C6A0000u, 0x0D470000u, 0x7BF30000u,
+        0xE02F0000u, 0x969B0000u, 0xDD380000u, 0xAB8C0000u, 0x30500000u, 0x46E40000u,
+        0x17C90000u, 0x617D0000u, 0xFAA10000u, 0x8C150000u, 0x58FB0000u, 0x2E4F0000u,
+        0xB5930000u, 0xC3270000u, 0x920A0000u, 0xE4BE0000u, 0x7F620000u, 0x09D60000u,
+        0xC69F0000u, 0xB02B0000u, 0x2BF70000u, 0x5D430000u, 0x0C6E0000u, 0x7ADA0000u,
+        0xE1060000u, 0x97B20000u, 0x435C0000u, 0x35E80000u, 0xAE340000u, 0xD8800000u,
+        0x89AD0000u, 0xFF190000u, 0x64C50000u, 0x12710000u, 0xEA760000u, 0x9CC20000u,
+        0x071E0000u, 0x71AA0000u, 0x20870000u, 0x56330000u, 0xCDEF0000u, 0xBB5B0000u,
+        0x6FB50000u, 0x19010000u, 0x82DD0000u, 0xF4690000u, 0xA5440000u, 0xD3F00000u,
+        0x482C0000u, 0x3E980000u, 0xF1D10000u, 0x87650000u, 0x1CB90000u, 0x6A0D0000u,
+        0x3B200000u, 0x4D940000u, 0xD6480000u, 0xA0FC0000u, 0x74120000u, 0x02A60000u,
+        0x997A0000u, 0xEFCE0000u, 0xBEE30000u, 0xC8570000u, 0x538B0000u, 0x253F0000u,
+        0xB3A40000u, 0xC5100000u, 0x5ECC0000u, 0x28780000u, 0x79550000u, 0x0FE10000u,
+        0x943D0000u, 0xE2890000u, 0x36670000u, 0x40D30000u, 0xDB0F0000u, 0xADBB0000u,
+        0xFC960000u, 0x8A220000u, 0x11FE0000u, 0x674A0000u, 0xA8030000u, 0xDEB70000u,
+        0x456B0000u, 0x33DF0000u, 0x62F20000u, 0x14460000u, 0x8F9A0000u, 0xF92E0000u,
+        0x2DC00000u, 0x5B740000u, 0xC0A80000u, 0xB61C0000u, 0xE7310000u, 0x91850000u,
+        0x0A590000u, 0x7CED0000u, 0x84EA0000u, 0xF25E0000u, 0x69820000u, 0x1F360000u,
+        0x4E1B0000u, 0x38AF0000u, 0xA3730000u, 0xD5C70000u, 0x01290000u, 0x779D0000u,
+        0xEC410000u, 0x9AF50000u, 0xCBD80000u, 0xBD6C0000u, 0x26B00000u, 0x50040000u,
+        0x9F4D0000u, 0xE9F90000u, 0x72250000u, 0x04910000u, 0x55BC0000u, 0x23080000u,
+        0xB8D40000u, 0xCE600000u, 0x1A8E0000u, 0x6C3A0000u, 0xF7E60000u, 0x81520000u,
+        0xD07F0000u, 0xA6CB0000u, 0x3D170000u, 0x4BA30000u,
+    },
+};
+
+/** Polynomial 0x1021, 16 bits, reflected form */
+static const uint32_t tableCrc16Reflected[SW_CRC_NUM_SLICES][256] = {
+    {
+        0x00000000u, 0x00001189u, 0x00002312u, 0x0000329Bu, 0x00004624u, 0x000057ADu,
+        0x00006536u, 0x000074BFu, 0x00008C48u, 0x00009DC1u, 0x0000AF5Au, 0x0000BED3u,
+        0x0000CA6Cu, 0x0000DBE5u, 0x0000E97Eu, 0x0000F8F7u, 0x00001081u, 0x00000108u,
+        0x00003393u, 0x0000221Au, 0x000056A5u, 0x0000472Cu, 0x000075B7u, 0x0000643Eu,
+        0x00009CC9u, 0x00008D40u, 0x0000BFDBu, 0x0000AE52u, 0x0000DAEDu, 0x0000CB64u,
+        0x0000F9FFu, 0x0000E876u, 0x00002102u, 0x0000308Bu, 0x00000210u, 0x00001399u,
+        0x00006726u, 0x000076AFu, 0x00004434u, 0x000055BDu, 0x0000AD4Au, 0x0000BCC3u,
+        0x00008E58u, 0x00009FD1u, 0x0000EB6Eu, 0x0000FAE7u, 0x0000C87Cu, 0x0000D9F5u,
+        0x00003183u, 0x0000200Au, 0x00001291u, 0x00000318u, 0x000077A7u, 0x0000662Eu,
+        0x000054B5u, 0x0000453Cu, 0x0000BDCBu, 0x0000AC42u, 0x00009ED9u, 0x00008F50u,
+        0x0000FBEFu, 0x0000EA66u, 0x0000D8FDu, 0x0000C974u, 0x00004204u, 0x0000538Du,
+        0x00006116u, 0x0000709Fu, 0x00000420u, 0x000015A9u, 0x00002732u, 0x000036BBu,
+        0x0000CE4Cu, 0x0000DFC5u, 0x0000ED5Eu, 0x0000FCD7u, 0x00008868u, 0x000099E1u,
+        0x0000AB7Au, 0x0000BAF3u, 0x00005285u, 0x0000430Cu, 0x00007197u, 0x0000601Eu,
+        0x000014A1u, 0x00000528u, 0x000037B3u, 0x0000263Au, 0x0000DECDu, 0x0000CF44u,
+        0x0000FDDFu, 0x0000EC56u, 0x000098E9u, 0x00008960u, 0x0000BBFBu, 0x0000AA72u,
+        0x00006306u, 0x0000728Fu, 0x00004014u, 0x0000519Du, 0x00002522u, 0x000034ABu,
+        0x00000630u, 0x000017B9u, 0x0000EF4Eu, 0x0000FEC7u, 0x0000CC5Cu, 0x0000DDD5u,
+        0x0000A96Au, 0x0000B8E3u, 0x00008A78u, 0x00009BF1u, 0x00007387u, 0x0000620Eu,
+        0x00005095u, 0x0000411Cu, 0x000035A3u, 0x0000242Au, 0x000016B1u, 0x00000738u,
+        0x0000FFCFu, 0x0000EE46u, 0x0000DCDDu, 0x0000CD54u, 0x0000B9EBu, 0x0000A862u,
+        0x00009AF9u, 0x00008B70u, 0x00008408u, 0x00009581u, 0x0000A71Au, 0x0000B693u,
+        0x0000C22Cu, 0x0000D3A5u, 0x0000E13Eu, 0x0000F0B7u, 0x00000840u, 0x000019C9u,
+        0x00002B52u, 0x00003ADBu, 0x00004E64u, 0x00005FEDu, 0x00006D76u, 0x00007CFFu,
+        0x00009489u, 0x00008500u, 0x0000B79Bu, 0x0000A612u, 0x0000D2ADu, 0x0000C324u,
+        0x0000F1BFu, 0x0000E036u, 0x000018C1u, 0x00000948u, 0x00003BD3u, 0x00002A5Au,
+        0x00005EE5u, 0x00004F6Cu, 0x00007DF7u, 0x00006C7Eu, 0x0000A50Au, 0x0000B483u,
+        0x00008618u, 0x00009791u, 0x0000E32Eu, 0x0000F2A7u, 0x0000C03Cu, 0x0000D1B5u,
+        0x00002942u, 0x000038CBu, 0x00000A50u, 0x00001BD9u, 0x00006F66u, 0x00007EEFu,
+        0x00004C74u, 0x00005DFDu, 0x0000B58Bu, 0x0000A402u, 0x00009699u, 0x00008710u,
+        0x0000F3AFu, 0x0000E226u, 0x0000D0BDu, 0x0000C134u, 0x000039C3u, 0x0000284Au,
+        0x00001AD1u, 0x00000B58u, 0x00007FE7u, 0x00006E6Eu, 0x00005CF5u, 0x00004D7Cu,
+        0x0000C60Cu, 0x0000D785u, 0x0000E51Eu, 0x0000F497u, 0x00008028u, 0x000091A1u,
+        0x0000A33Au, 0x0000B2B3u, 0x00004A44u, 0x00005BCDu, 0x00006956u, 0x000078DFu,
+        0x00000C60u, 0x00001DE9u, 0x00002F72u, 0x00003EFBu, 0x0000D68Du, 0x0000C704u,
+        0x0000F59Fu, 0x0000E416u, 0x000090A9u, 0x00008120u, 0x0000B3BBu, 0x0000A232u,
+        0x00005AC5u, 0x00004B4Cu, 0x000079D7u, 0x0000685Eu, 0x00001CE1u, 0x00000D68u,
+        0x00003FF3u, 0x00002E7Au, 0x0000E70Eu, 0x0000F687u, 0x0000C41Cu, 0x0000D595u,
+        0x0000A12Au, 0x0000B0A3u, 0x00008238u, 0x000093B1u, 0x00006B46u, 0x00007ACFu,
+        0x00004854u, 0x000059DDu, 0x00002D62u, 0x00003CEBu, 0x00000E70u, 0x00001FF9u,
+        0x0000F78Fu, 0x0000E606u, 0x0000D49Du, 0x0000C514u, 0x0000B1ABu, 0x0000A022u,
+        0x000092B9u, 0x00008330u, 0x00007BC7u, 0x00006A4Eu, 0x000058D5u, 0x0000495Cu,
+        0x00003DE3u, 0x00002C6Au, 0x00001EF1u, 0x00000F78u,
+    },
+    {
+        0x00000000u, 0x000019D8u, 0x000033B0u, 0x00002A68u, 0x00006760u, 0x00007EB8u,
+        0x000054D0u, 0x00004D08u, 0x0000CEC0u, 0x0000D718u, 0x0000FD70u, 0x0000E4A8u,
+        0x0000A9A0u, 0x0000B078u, 0x00009A10u, 0x000083C8u, 0x00009591u, 0x00008C49u,
+        0x0000A621u, 0x0000BFF9u, 0x0000F2F1u, 0x0000EB29u, 0x0000C141u, 0x0000D899u,
+        0x00005B51u, 0x00004289u, 0x000068E1u, 0x00007139u, 0x00003C31u, 0x000025E9u,
+        0x00000F81u, 0x00001659u, 0x00002333u, 0x00003AEBu, 0x00001083u, 0x0000095Bu,
+        0x00004453u, 0x00005D8Bu, 0x000077E3u, 0x00006E3Bu, 0x0000EDF3u, 0x0000F42Bu,
+        0x0000DE43u, 0x0000C79Bu, 0x00008A93u, 0x0000934Bu, 0x0000B923u, 0x0000A0FBu,
+        0x0000B6A2u, 0x0000AF7Au, 0x00008512u, 0x00009CCAu, 0x0000D1C2u, 0x0000C81Au,
+        0x0000E272u, 0x0000FBAAu, 0x00007862u, 0x000061BAu, 0x00004BD2u, 0x0000520Au,
+        0x00001F02u, 0x000006DAu, 0x00002CB2u, 0x0000356Au, 0x00004666u, 0x00005FBEu,
+        0x000075D6u, 0x00006C0Eu, 0x00002106u, 0x000038DEu, 0x000012B6u, 0x00000B6Eu,
+        0x000088A6u, 0x0000917Eu, 0x0000BB16u, 0x0000A2CEu, 0x0000EFC6u, 0x0000F61Eu,
+        0x0000DC76u, 0x0000C5AEu, 0x0000D3F7u, 0x0000CA2Fu, 0x0000E047u, 0x0000F99Fu,
+        0x0000B497u, 0x0000AD4Fu, 0x00008727u, 0x00009EFFu, 0x00001D37u, 0x000004EFu,
+        0x00002E87u, 0x0000375Fu, 0x00007A57u, 0x0000638Fu, 0x000049E7u, 0x0000503Fu,
+        0x00006555u, 0x00007C8Du, 0x000056E5u, 0x00004F3Du, 0x00000235u, 0x00001BEDu,
+        0x00003185u, 0x0000285Du, 0x0000AB95u, 0x0000B24Du, 0x00009825u, 0x000081FDu,
+        0x0000CCF5u, 0x0000D52Du, 0x0000FF45u, 0x0000E69Du, 0x0000F0C4u, 0x0000E91Cu,
+        0x0000C374u, 0x0000DAACu, 0x000097A4u, 0x00008E7Cu, 0x0000A414u, 0x0000BDCCu,
+        0x00003E04u, 0x000027DCu, 0x00000DB4u, 0x0000146Cu, 0x00005964u, 0x000040BCu,
+        0x00006AD4u, 0x0000730Cu, 0x00008CCCu, 0x00009514u, 0x0000BF7Cu, 0x0000A6A4u,
+        0x0000EBACu, 0x0000F274u, 0x0000D81Cu, 0x0000C1C4u, 0x0000420Cu, 0x00005BD4u,
+        0x000071BCu, 0x00006864u, 0x0000256Cu, 0x00003CB4u, 0x000016DCu, 0x00000F04u,
+        0x0000195Du, 0x00000085u, 0x00002AEDu, 0x00003335u, 0x00007E3Du, 0x000067E5u,
+        0x00004D8Du, 0x00005455u, 0x0000D79Du, 0x0000CE45u, 0x0000E42Du, 0x0000FDF5u,
+        0x0000B0FDu, 0x0000A925u, 0x0000834Du, 0x00009A95u, 0x0000AFFFu, 0x0000B627u,
+        0x00009C4Fu, 0x00008597u, 0x0000C89Fu, 0x0000D147u, 0x0000FB2Fu, 0x0000E2F7u,
+        0x0000613Fu, 0x000078E7u, 0x0000528Fu, 0x00004B57u, 0x0000065Fu, 0x00001F87u,
+        0x000035EFu, 0x00002C37u, 0x00003A6Eu, 0x000023B6u, 0x000009DEu, 0x00001006u,
+        0x00005D0Eu, 0x000044D6u, 0x00006EBEu, 0x00007766u, 0x0000F4AEu, 0x0000ED76u,
+        0x0000C71Eu, 0x0000DEC6u, 0x000093CEu, 0x00008A16u, 0x0000A07Eu, 0x0000B9A6u,
+        0x0000CAAAu, 0x0000D372u, 0x0000F91Au, 0x0000E0C2u, 0x0000ADCAu, 0x0000B412u,
+        0x00009E7Au, 0x000087A2u, 0x0000046Au, 0x00001DB2u, 0x000037DAu, 0x00002E02u,
+        0x0000630Au, 0x00007AD2u, 0x000050BAu, 0x00004962u, 0x00005F3Bu, 0x000046E3u,
+        0x00006C8Bu, 0x00007553u, 0x0000385Bu, 0x00002183u, 0x00000BEBu, 0x00001233u,
+        0x000091FBu, 0x00008823u, 0x0000A24Bu, 0x0000BB93u, 0x0000F69Bu, 0x0000EF43u,
+        0x0000C52Bu, 0x0000DCF3u, 0x0000E999u, 0x0000F041u, 0x0000DA29u, 0x0000C3F1u,
+        0x00008EF9u, 0x00009721u, 0x0000BD49u, 0x0000A491u, 0x00002759u, 0x00003E81u,
+        0x000014E9u, 0x00000D31u, 0x00004039u, 0x000059E1u, 0x00007389u, 0x00006A51u,
+        0x00007C08u, 0x000065D0u, 0x00004FB8u, 0x00005660u, 0x00001B68u, 0x000002B0u,
+        0x000028D8u, 0x00003100u, 0x0000B2C8u, 0x0000AB10u, 0x00008178u, 0x000098A0u,
+        0x0000D5A8u, 0x0000CC70u, 0x0000E618u, 0x0000FFC0u,
+    },
+    {
+        0x00000000u, 0x00005ADCu, 0x0000B5B8u, 0x0000EF64u, 0x00006361u, 0x000039BDu,
+        0x0000D6D9u, 0x00008C05u, 0x0000C6C2u, 0x00009C1Eu, 0x0000737Au, 0x000029A6u,
+        0x0000A5A3u, 0x0000FF7Fu, 0x0000101Bu, 0x00004AC7u, 0x00008595u, 0x0000DF49u,
+        0x0000302Du, 0x00006AF1u, 0x0000E6F4u, 0x0000BC28u, 0x0000534Cu, 0x00000990u,
+        0x00004357u, 0x0000198Bu, 0x0000F6EFu, 0x0000AC33u, 0x00002036u, 0x00007AEAu,
+        0x0000958Eu, 0x0000CF52u, 0x0000033Bu, 0x000059E7u, 0x0000B683u, 0x0000EC5Fu,
+        0x0000605Au, 0x00003A86u, 0x0000D5E2u, 0x00008F3Eu, 0x0000C5F9u, 0x00009F25u,
+        0x00007041u, 0x00002A9Du, 0x0000A698u, 0x0000FC44u, 0x00001320u, 0x000049FCu,
+        0x000086AEu, 0x0000DC72u, 0x00003316u, 0x000069CAu, 0x0000E5CFu, 0x0000BF13u,
+        0x00005077u, 0x00000AABu, 0x0000406Cu, 0x00001AB0u, 0x0000F5D4u, 0x0000AF08u,
+        0x0000230Du, 0x000079D1u, 0x000096B5u, 0x0000CC69u, 0x00000676u, 0x00005CAAu,
+        0x0000B3CEu, 0x0000E912u, 0x00006517u, 0x00003FCBu, 0x0000D0AFu, 0x00008A73u,
+        0x0000C0B4u, 0x00009A68u, 0x0000750Cu, 0x00002FD0u, 0x0000A3D5u, 0x0000F909u,
+        0x0000166Du, 0x00004CB1u, 0x000083E3u, 0x0000D93Fu, 0x0000365Bu, 0x00006C87u,
+        0x0000E082u, 0x0000BA5Eu, 0x0000553Au, 0x00000FE6u, 0x00004521u, 0x00001FFDu,
+        0x0000F099u, 0x0000AA45u, 0x00002640u, 0x00007C9Cu, 0x000093F8u, 0x0000C924u,
+        0x0000054Du, 0x00005F91u, 0x0000B0F5u, 0x0000EA29u, 0x0000662Cu, 0x00003CF0u,
+        0x0000D394u, 0x00008948u, 0x0000C38Fu, 0x00009953u, 0x00007637u, 0x00002CEBu,
+        0x0000A0EEu, 0x0000FA32u, 0x00001556u, 0x00004F8Au, 0x000080D8u, 0x0000DA04u,
+        0x00003560u, 0x00006FBCu, 0x0000E3B9u, 0x0000B965u, 0x00005601u, 0x00000CDDu,
+        0x0000461Au, 0x00001CC6u, 0x0000F3A2u, 0x0000A97Eu, 0x0000257Bu, 0x00007FA7u,
+        0x000090C3u, 0x0000CA1Fu, 0x00000CECu, 0x00005630u, 0x0000B954u, 0x0000E388u,
+        0x00006F8Du, 0x00003551u, 0x0000DA35u, 0x000080E9u, 0x0000CA2Eu, 0x000090F2u,
+        0x00007F96u, 0x0000254Au, 0x0000A94Fu, 0x0000F393u, 0x00001CF7u, 0x0000462Bu,
+        0x00008979u, 0x0000D3A5u, 0x00003CC1u, 0x0000661Du, 0x0000EA18u, 0x0000B0C4u,
+        0x00005FA0u, 0x0000057Cu, 0x00004FBBu, 0x00001567u, 0x0000FA03u, 0x0000A0DFu,
+        0x00002CDAu, 0x00007606u, 0x00009962u, 0x0000C3BEu, 0x00000FD7u, 0x0000550Bu,
+        0x0000BA6Fu, 0x0000E0B3u, 0x00006CB6u, 0x0000366Au, 0x0000D90Eu, 0x000083D2u,
+        0x0000C915u, 0x000093C9u, 0x00007CADu, 0x00002671u, 0x0000AA74u, 0x0000F0A8u,
+        0x00001FCCu, 0x00004510u, 0x00008A42u, 0x0000D09Eu, 0x00003FFAu, 0x00006526u,
+        0x0000E923u, 0x0000B3FFu, 0x00005C9Bu, 0x00000647u, 0x00004C80u, 0x0000165Cu,
+        0x0000F938u, 0x0000A3E4u, 0x00002FE1u, 0x0000753Du, 0x00009A59u, 0x0000C085u,
+        0x00000A9Au, 0x00005046u, 0x0000BF22u, 0x0000E5FEu, 0x000069FBu, 0x00003327u,
+        0x0000DC43u, 0x0000869Fu, 0x0000CC58u, 0x00009684u, 0x000079E0u, 0x0000233Cu,
+        0x0000AF39u, 0x0000F5E5u, 0x00001A81u, 0x0000405Du, 0x00008F0Fu, 0x0000D5D3u,
+        0x00003AB7u, 0x0000606Bu, 0x0000EC6Eu, 0x0000B6B2u, 0x000059D6u, 0x0000030Au,
+        0x000049CDu, 0x00001311u, 0x0000FC75u, 0x0000A6A9u, 0x00002AACu, 0x00007070u,
+        0x00009F14u, 0x0000C5C8u, 0x000009A1u, 0x0000537Du, 0x0000BC19u, 0x0000E6C5u,
+        0x00006AC0u, 0x0000301Cu, 0x0000DF78u, 0x000085A4u, 0x0000CF63u, 0x000095BFu,
+        0x00007ADBu, 0x00002007u, 0x0000AC02u, 0x0000F6DEu, 0x000019BAu, 0x00004366u,
+        0x00008C34u, 0x0000D6E8u, 0x0000398Cu, 0x00006350u, 0x0000EF55u, 0x0000B589u,
+        0x00005AEDu, 0x00000031u, 0x00004AF6u, 0x0000102Au, 0x0000FF4Eu, 0x0000A592u,
+        0x00002997u, 0x0000734Bu, 0x00009C2Fu, 0x0000C6F3u,
+    },
+    {
+        0x00000000u, 0x00001CBBu, 0x00003976u, 0x000025CDu, 0x000072ECu, 0x00006E57u,
+        0x00004B9Au, 0x00005721u, 0x0000E5D8u, 0x0000F963u, 0x0000DCAEu, 0x0000C015u,
+        0x00009734u, 0x00008B8Fu, 0x0000AE42u, 0x0000B2F9u, 0x0000C3A1u, 0x0000DF1Au,
+        0x0000FAD7u, 0x0000E66Cu, 0x0000B14Du, 0x0000ADF6u, 0x0000883Bu, 0x00009480u,
+        0x00002679u, 0x00003AC2u, 0x00001F0Fu, 0x000003B4u, 0x00005495u, 0x0000482Eu,
+        0x00006DE3u, 0x00007158u, 0x00008F53u, 0x000093E8u, 0x0000B625u, 0x0000AA9Eu,
+        0x0000FDBFu, 0x0000E104u, 0x0000C4C9u, 0x0000D872u, 0x00006A8Bu, 0x00007630u,
+        0x000053FDu, 0x00004F46u, 0x00001867u, 0x000004DCu, 0x00002111u, 0x00003DAAu,
+        0x00004CF2u, 0x00005049u, 0x00007584u, 0x0000693Fu, 0x00003E1Eu, 0x000022A5u,
+        0x00000768u, 0x00001BD3u, 0x0000A92Au, 0x0000B591u, 0x0000905Cu, 0x00008CE7u,
+        0x0000DBC6u, 0x0000C77Du, 0x0000E2B0u, 0x0000FE0Bu, 0x000016B7u, 0x00000A0Cu,
+        0x00002FC1u, 0x0000337Au, 0x0000645Bu, 0x000078E0u, 0x00005D2Du, 0x00004196u,
+        0x0000F36Fu, 0x0000EFD4u, 0x0000CA19u, 0x0000D6A2u, 0x00008183u, 0x00009D38u,
+        0x0000B8F5u, 0x0000A44Eu, 0x0000D516u, 0x0000C9ADu, 0x0000EC60u, 0x0000F0DBu,
+        0x0000A7FAu, 0x0000BB41u, 0x00009E8Cu, 0x00008237u, 0x000030CEu, 0x00002C75u,
+        0x000009B8u, 0x00001503u, 0x00004222u, 0x00005E99u, 0x00007B54u, 0x000067EFu,
+        0x000099E4u, 0x0000855Fu, 0x0000A092u, 0x0000BC29u, 0x0000EB08u, 0x0000F7B3u,
+        0x0000D27Eu, 0x0000CEC5u, 0x00007C3Cu, 0x00006087u, 0x0000454Au, 0x000059F1u,
+        0x00000ED0u, 0x0000126Bu, 0x000037A6u, 0x00002B1Du, 0x00005A45u, 0x000046FEu,
+        0x00006333u, 0x00007F88u, 0x000028A9u, 0x00003412u, 0x000011DFu, 0x00000D64u,
+        0x0000BF9Du, 0x0000A326u, 0x000086EBu, 0x00009A50u, 0x0000CD71u, 0x0000D1CAu,
+        0x0000F407u, 0x0000E8BCu, 0x00002D6Eu, 0x000031D5u, 0x00001418u, 0x000008A3u,
+        0x00005F82u, 0x00004339u, 0x000066F4u, 0x00007A4Fu, 0x0000C8B6u, 0x0000D40Du,
+        0x0000F1C0u, 0x0000ED7Bu, 0x0000BA5Au, 0x0000A6E1u, 0x0000832Cu, 0x00009F97u,
+        0x0000EECFu, 0x0000F274u, 0x0000D7B9u, 0x0000CB02u, 0x00009C23u, 0x00008098u,
+        0x0000A555u, 0x0000B9EEu, 0x00000B17u, 0x000017ACu, 0x00003261u, 0x00002EDAu,
+        0x000079FBu, 0x00006540u, 0x0000408Du, 0x00005C36u, 0x0000A23Du, 0x0000BE86u,
+        0x00009B4Bu, 0x000087F0u, 0x0000D0D1u, 0x0000CC6Au, 0x0000E9A7u, 0x0000F51Cu,
+        0x000047E5u, 0x00005B5Eu, 0x00007E93u, 0x00006228u, 0x00003509u, 0x000029B2u,
+        0x00000C7Fu, 0x000010C4u, 0x0000619Cu, 0x00007D27u, 0x000058EAu, 0x00004451u,
+        0x00001370u, 0x00000FCBu, 0x00002A06u, 0x000036BDu, 0x00008444u, 0x000098FFu,
+        0x0000BD32u, 0x0000A189u, 0x0000F6A8u, 0x0000EA13u, 0x0000CFDEu, 0x0000D365u,
+        0x00003BD9u, 0x00002762u, 0x000002AFu, 0x00001E14u, 0x00004935u, 0x0000558Eu,
+        0x00007043u, 0x00006CF8u, 0x0000DE01u, 0x0000C2BAu, 0x0000E777u, 0x0000FBCCu,
+        0x0000ACEDu, 0x0000B056u, 0x0000959Bu, 0x00008920u, 0x0000F878u, 0x0000E4C3u,
+        0x0000C10Eu, 0x0000DDB5u, 0x00008A94u, 0x0000962Fu, 0x0000B3E2u, 0x0000AF59u,
+        0x00001DA0u, 0x0000011Bu, 0x000024D6u, 0x0000386Du, 0x00006F4Cu, 0x000073F7u,
+        0x0000563Au, 0x00004A81u, 0x0000B48Au, 0x0000A831u, 0x00008DFCu, 0x00009147u,
+        0x0000C666u, 0x0000DADDu, 0x0000FF10u, 0x0000E3ABu, 0x00005152u, 0x00004DE9u,
+        0x00006824u, 0x0000749Fu, 0x000023BEu, 0x00003F05u, 0x00001AC8u, 0x00000673u,
+        0x0000772Bu, 0x00006B90u, 0x00004E5Du, 0x000052E6u, 0x000005C7u, 0x0000197Cu,
+        0x00003CB1u, 0x0000200Au, 0x000092F3u, 0x00008E48u, 0x0000AB85u, 0x0000B73Eu,
+        0x0000E01Fu, 0x0000FCA4u, 0x0000D969u, 0x0000C5D2u,
+    },
+};
+
+/** Polynomial 0x07, 8 bits, normal form */
+static const uint32_t tableCrc8Normal[SW_CRC_NUM_SLICES][256] = {
+    {
+        0x00000000u, 0x07000000u, 0x0E000000u, 0x09000000u, 0x1C000000u, 0x1B000000u,
+        0x12000000u, 0x15000000u, 0x38000000u, 0x3F000000u, 0x36000000u, 0x31000000u,
+        0x24000000u, 0x23000000u, 0x2A000000u, 0x2D000000u, 0x70000000u, 0x77000000u,
+        0x7E000000u, 0x79000000u, 0x6C000000u, 0x6B000000u, 0x62000000u, 0x65000000u,
+        0x48000000u, 0x4F000000u, 0x46000000u, 0x41000000u, 0x54000000u, 0x53000000u,
+        0x5A000000u, 0x5D000000u, 0xE0000000u, 0xE7000000u, 0xEE000000u, 0xE9000000u,
+        0xFC000000u, 0xFB000000u, 0xF2000000u, 0xF5000000u, 0xD8000000u, 0xDF000000u,
+        0xD6000000u, 0xD1000000u, 0xC4000000u, 0xC3000000u, 0xCA000000u, 0xCD000000u,
+        0x90000000u, 0x97000000u, 0x9E000000u, 0x99000000u, 0x8C000000u, 0x8B000000u,
+        0x82000000u, 0x85000000u, 0xA8000000u, 0xAF000000u, 0xA6000000u, 0xA1000000u,
+        0xB4000000u, 0xB3000000u, 0xBA000000u, 0xBD000000u, 0xC7000000u, 0xC0000000u,
+        0xC9000000u, 0xCE000000u, 0xDB000000u, 0xDC000000u, 0xD5000000u, 0xD2000000u,
+        0xFF000000u, 0xF8000000u, 0xF1000000u, 0xF6000000u, 0xE3000000u, 0xE4000000u,
+        0xED000000u, 0xEA000000u, 0xB7000000u, 0xB0000000u, 0xB9000000u, 0xBE000000u,
+        0xAB000000u, 0xAC000000u, 0xA5000000u, 0xA2000000u, 0x8F000000u, 0x88000000u,
+        0x81000000u, 0x86000000u, 0x93000000u, 0x94000000u, 0x9D000000u, 0x9A000000u,
+        0x27000000u, 0x20000000u, 0x29000000u, 0x2E000000u, 0x3B000000u, 0x3C000000u,
+        0x35000000u, 0x32000000u, 0x1F000000u, 0x18000000u, 0x11000000u, 0x16000000u,
+        0x03000000u, 0x04000000u, 0x0D000000u, 0x0A000000u, 0x57000000u, 0x50000000u,
+        0x59000000u, 0x5E000000u, 0x4B000000u, 0x4C000000u, 0x45000000u, 0x42000000u,
+        0x6F000000u, 0x68000000u, 0x61000000u, 0x66000000u, 0x73000000u, 0x74000000u,
+        0x7D000000u, 0x7A000000u, 0x89000000u, 0x8E000000u, 0x87000000u, 0x80000000u,
+        0x95000000u, 0x92000000u, 0x9B000000u, 0x9C000000u, 0xB1000000u, 0xB6000000u,
+        0xBF000000u, 0xB8000000u, 0xAD000000u, 0xAA000000u, 0xA3000000u, 0xA4000000u,
+        0xF9000000u, 0xFE000000u, 0xF7000000u, 0xF0000000u, 0xE5000000u, 0xE2000000u,
+        0xEB000000u, 0xEC000000u, 0xC1000000u, 0xC6000000u, 0xCF000000u, 0xC8000000u,
+        0xDD000000u, 0xDA000000u, 0xD3000000u, 0xD4000000u, 0x69000000u, 0x6E000000u,
+        0x67000000u, 0x60000000u, 0x75000000u, 0x72000000u, 0x7B000000u, 0x7C000000u,
+        0x51000000u, 0x56000000u, 0x5F000000u, 0x58000000u, 0x4D000000u, 0x4A000000u,
+        0x43000000u, 0x44000000u, 0x19000000u, 0x1E000000u, 0x17000000u, 0x10000000u,
+        0x05000000u, 0x02000000u, 0x0B000000u, 0x0C000000u, 0x21000000u, 0x26000000u,
+        0x2F000000u, 0x28000000u, 0x3D000000u, 0x3A000000u, 0x33000000u, 0x34000000u,
+        0x4E000000u, 0x49000000u, 0x40000000u, 0x47000000u, 0x52000000u, 0x55000000u,
+        0x5C000000u, 0x5B000000u, 0x76000000u, 0x71000000u, 0x78000000u, 0x7F000000u,
+        0x6A000000u, 0x6D000000u, 0x64000000u, 0x63000000u, 0x3E000000u, 0x39000000u,
+        0x30000000u, 0x37000000u, 0x22000000u, 0x25000000u, 0x2C000000u, 0x2B000000u,
+        0x06000000u, 0x01000000u, 0x08000000u, 0x0F000000u, 0x1A000000u, 0x1D000000u,
+        0x14000000u, 0x13000000u, 0xAE000000u, 0xA9000000u, 0xA0000000u, 0xA7000000u,
+        0xB2000000u, 0xB5000000u, 0xBC000000u, 0xBB000000u, 0x96000000u, 0x91000000u,
+        0x98000000u, 0x9F000000u, 0x8A000000u, 0x8D000000u, 0x84000000u, 0x83000000u,
+        0xDE000000u, 0xD9000000u, 0xD0000000u, 0xD7000000u, 0xC2000000u, 0xC5000000u,
+        0xCC000000u, 0xCB000000u, 0xE6000000u, 0xE1000000u, 0xE8000000u, 0xEF000000u,
+        0xFA000000u, 0xFD000000u, 0xF4000000u, 0xF3000000u,
+    },
+    {
+        0x00000000u, 0x15000000u, 0x2A000000u, 0x3F000000u, 0x54000000u, 0x41000000u,
+        0x7E000000u, 0x6B000000u, 0xA8000000u, 0xBD000000u, 0x82000000u, 0x97000000u,
+        0xFC000000u, 0xE9000000u, 0xD6000000u, 0xC3000000u, 0x57000000u, 0x42000000u,
+        0x7D000000u, 0x68000000u, 0x03000000u, 0x16000000u, 0x29000000u, 0x3C000000u,
+        0xFF000000u, 0xEA000000u, 0xD5000000u, 0xC0000000u, 0xAB000000u, 0xBE000000u,
+        0x81000000u, 0x94000000u, 0xAE000000u, 0xBB000000u, 0x84000000u, 0x91000000u,
+        0xFA000000u, 0xEF000000u, 0xD0000000u, 0xC5000000u, 0x06000000u, 0x13000000u,
+        0x2C000000u, 0x39000000u, 0x52000000u, 0x47000000u, 0x78000000u, 0x6D000000u,
+        0xF9000000u, 0xEC000000u, 0xD3000000u, 0xC6000000u, 0xAD000000u, 0xB8000000u,
+        0x87000000u, 0x92000000u, 0x51000000u, 0x44000000u, 0x7B000000u, 0x6E000000u,
+        0x05000000u, 0x10000000u, 0x2F000000u, 0x3A000000u, 0x5B000000u, 0x4E000000u,
+        0x71000000u, 0x64000000u, 0x0F000000u, 0x1A000000u, 0x25000000u, 0x30000000u,
+        0xF3000000u, 0xE6000000u, 0xD9000000u, 0xCC000000u, 0xA7000000u, 0xB2000000u,
+        0x8D000000u, 0x98000000u, 0x0C000000u, 0x19000000u, 0x26000000u, 0x33000000u,
+        0x58000000u, 0x4D000000u, 0x72000000u, 0x67000000u, 0xA4000000u, 0xB1000000u,
+        0x8E000000u, 0x9B000000u, 0xF0000000u, 0xE5000000u, 0xDA000000u, 0xCF000000u,
+        0xF5000000u, 0xE0000000u, 0xDF000000u, 0xCA000000u, 0xA1000000u, 0xB4000000u,
+        0x8B000000u, 0x9E000000u, 0x5D000000u, 0x48000000u, 0x77000000u, 0x62000000u,
+        0x09000000u, 0x1C000000u, 0x23000000u, 0x36000000u, 0xA2000000u, 0xB7000000u,
+        0x88000000u, 0x9D000000u, 0xF6000000u, 0xE3000000u, 0xDC000000u, 0xC9000000u,
+        0x0A000000u, 0x1F000000u, 0x20000000u, 0x35000000u, 0x5E000000u, 0x4B000000u,
+        0x74000000u, 0x61000000u, 0xB6000000u, 0xA3000000u, 0x9C000000u, 0x89000000u,
+        0xE2000000u, 0xF7000000u, 0xC8000000u, 0xDD000000u, 0x1E000000u, 0x0B000000u,
+        0x34000000u, 0x21000000u, 0x4A000000u, 0x5F000000u, 0x60000000u, 0x75000000u,
+        0xE1000000u, 0xF4000000u, 0xCB000000u, 0xDE000000u, 0xB5000000u, 0xA0000000u,
+        0x9F000000u, 0x8A000000u, 0x49000000u, 0x5C000000u, 0x63000000u, 0x76000000u,
+        0x1D000000u, 0x08000000u, 0x37000000u, 0x22000000u, 0x18000000u, 0x0D000000u,
+        0x32000000u, 0x27000000u, 0x4C000000u, 0x59000000u, 0x66000000u, 0x73000000u,
+        0xB0000000u, 0xA5000000u, 0x9A000000u, 0x8F000000u, 0xE4000000u, 0xF1000000u,
+        0xCE000000u, 0xDB000000u, 0x4F000000u, 0x5A000000u, 0x65000000u, 0x70000000u,
+        0x1B000000u, 0x0E000000u, 0x31000000u, 0x24000000u, 0xE7000000u, 0xF2000000u,
+        0xCD000000u, 0xD8000000u, 0xB3000000u, 0xA6000000u, 0x99000000u, 0x8C000000u,
+        0xED000000u, 0xF8000000u, 0xC7000000u, 0xD2000000u, 0xB9000000u, 0xAC000000u,
+        0x93000000u, 0x86000000u, 0x45000000u, 0x50000000u, 0x6F000000u, 0x7A000000u,
+        0x11000000u, 0x04000000u, 0x3B000000u, 0x2E000000u, 0xBA000000u, 0xAF000000u,
+        0x90000000u, 0x85000000u, 0xEE000000u, 0xFB000000u, 0xC4000000u, 0xD1000000u,
+        0x12000000u, 0x07000000u, 0x38000000u, 0x2D000000u, 0x46000000u, 0x53000000u,
+        0x6C000000u, 0x79000000u, 0x43000000u, 0x56000000u, 0x69000000u, 0x7C000000u,
+        0x17000000u, 0x02000000u, 0x3D000000u, 0x28000000u, 0xEB000000u, 0xFE000000u,
+        0xC1000000u, 0xD4000000u, 0xBF000000u, 0xAA000000u, 0x95000000u, 0x80000000u,
+        0x14000000u, 0x01000000u, 0x3E000000u, 0x2B000000u, 0x40000000u, 0x55000000u,
+        0x6A000000u, 0x7F000000u, 0xBC000000u, 0xA9000000u, 0x96000000u, 0x83000000u,
+        0xE8000000u, 0xFD000000u, 0xC2000000u, 0xD7000000u,
+    },
+    {
+        0x00000000u, 0x6B000000u, 0xD6000000u, 0xBD000000u, 0xAB000000u, 0xC0000000u,
+        0x7D000000u, 0x16000000u, 0x51000000u, 0x3A000000u, 0x87000000u, 0xEC000000u,
+        0xFA000000u, 0x91000000u, 0x2C000000u, 0x47000000u, 0xA2000000u, 0xC9000000u,
+        0x74000000u, 0x1F000000u, 0x09000000u, 0x62000000u, 0xDF000000u, 0xB4000000u,
+        0xF3000000u, 0x98000000u, 0x25000000u, 0x4E000000u, 0x58000000u, 0x33000000u,
+        0x8E000000u, 0xE5000000u, 0x43000000u, 0x28000000u, 0x95000000u, 0xFE000000u,
+        0xE8000000u, 0x83000000u, 0x3E000000u, 0x55000000u, 0x12000000u, 0x79000000u,
+        0xC4000000u, 0xAF000000u, 0xB9000000u, 0xD2000000u, 0x6F000000u, 0x04000000u,
+        0xE1000000u, 0x8A000000u, 0x37000000u, 0x5C000000u, 0x4A000000u, 0x21000000u,
+        0x9C000000u, 0xF7000000u, 0xB0000000u, 0xDB000000u, 0x66000000u, 0x0D000000u,
+        0x1B000000u, 0x70000000u, 0xCD000000u, 0xA6000000u, 0x86000000u, 0xED000000u,
+        0x50000000u, 0x3B000000u, 0x2D000000u, 0x46000000u, 0xFB000000u, 0x90000000u,
+        0xD7000000u, 0xBC000000u, 0x01000000u, 0x6A000000u, 0x7C000000u, 0x17000000u,
+        0xAA000000u, 0xC1000000u, 0x24000000u, 0x4F000000u, 0xF2000000u, 0x99000000u,
+        0x8F000000u, 0xE4000000u, 0x59000000u, 0x32000000u, 0x75000000u, 0x1E000000u,
+        0xA3000000u, 0xC8000000u, 0xDE000000u, 0xB5000000u, 0x08000000u, 0x63000000u,
+        0xC5000000u, 0xAE000000u, 0x13000000u, 0x78000000u, 0x6E000000u, 0x05000000u,
+        0xB8000000u, 0xD3000000u, 0x94000000u, 0xFF000000u, 0x42000000u, 0x29000000u,
+        0x3F000000u, 0x54000000u, 0xE9000000u, 0x82000000u, 0x67000000u, 0x0C000000u,
+        0xB1000000u, 0xDA000000u, 0xCC000000u, 0xA7000000u, 0x1A000000u, 0x71000000u,
+        0x36000000u, 0x5D000000u, 0xE0000000u, 0x8B000000u, 0x9D000000u, 0xF6000000u,
+        0x4B000000u, 0x20000000u, 0x0B000000u, 0x60000000u, 0xDD000000u, 0xB6000000u,
+        0xA0000000u, 0xCB000000u, 0x76000000u, 0x1D000000u, 0x5A000000u, 0x31000000u,
+        0x8C000000u, 0xE7000000u, 0xF1000000u, 0x9A000000u, 0x27000000u, 0x4C000000u,
+        0xA9000000u, 0xC2000000u, 0x7F000000u, 0x14000000u, 0x02000000u, 0x69000000u,
+        0xD4000000u, 0xBF000000u, 0xF8000000u, 0x93000000u, 0x2E000000u, 0x45000000u,
+        0x53000000u, 0x38000000u, 0x85000000u, 0xEE000000u, 0x48000000u, 0x23000000u,
+        0x9E000000u, 0xF5000000u, 0xE3000000u, 0x88000000u, 0x35000000u, 0x5E000000u,
+        0x19000000u, 0x72000000u, 0xCF000000u, 0xA4000000u, 0xB2000000u, 0xD9000000u,
+        0x64000000u, 0x0F000000u, 0xEA000000u, 0x81000000u, 0x3C000000u, 0x57000000u,
+        0x41000000u, 0x2A000000u, 0x97000000u, 0xFC000000u, 0xBB000000u, 0xD0000000u,
+        0x6D000000u, 0x06000000u, 0x10000000u, 0x7B000000u, 0xC6000000u, 0xAD000000u,
+        0x8D000000u, 0xE6000000u, 0x5B000000u, 0x30000000u, 0x26000000u, 0x4D000000u,
+        0xF0000000u, 0x9B000000u, 0xDC000000u, 0xB7000000u, 0x0A000000u, 0x61000000u,
+        0x77000000u, 0x1C000000u, 0xA1000000u, 0xCA000000u, 0x2F000000u, 0x44000000u,
+        0xF9000000u, 0x92000000u, 0x84000000u, 0xEF000000u, 0x52000000u, 0x39000000u,
+        0x7E000000u, 0x15000000u, 0xA8000000u, 0xC3000000u, 0xD5000000u, 0xBE000000u,
+        0x03000000u, 0x68000000u, 0xCE000000u, 0xA5000000u, 0x18000000u, 0x73000000u,
+        0x65000000u, 0x0E000000u, 0xB3000000u, 0xD8000000u, 0x9F000000u, 0xF4000000u,
+        0x49000000u, 0x22000000u, 0x34000000u, 0x5F000000u, 0xE2000000u, 0x89000000u,
+        0x6C000000u, 0x07000000u, 0xBA000000u, 0xD1000000u, 0xC7000000u, 0xAC000000u,
+        0x11000000u, 0x7A000000u, 0x3D000000u, 0x56000000u, 0xEB000000u, 0x80000000u,
+        0x96000000u, 0xFD000000u, 0x40000000u, 0x2B000000u,
+    },
+    {
+        0x00000000u, 0x16000000u, 0x2C000000u, 0x3A000000u, 0x58000000u, 0x4E000000u,
+        0x74000000u, 0x62000000u, 0xB0000000u, 0xA6000000u, 0x9C000000u, 0x8A000000u,
+        0xE8000000u, 0xFE000000u, 0xC4000000u, 0xD2000000u, 0x67000000u, 0x71000000u,
+        0x4B000000u, 0x5D000000u, 0x3F000000u, 0x29000000u, 0x13000000u, 0x05000000u,
+        0xD7000000u, 0xC1000000u, 0xFB000000u, 0xED000000u, 0x8F000000u, 0x99000000u,
+        0xA3000000u, 0xB5000000u, 0xCE000000u, 0xD8000000u, 0xE2000000u, 0xF4000000u,
+        0x96000000u, 0x80000000u, 0xBA000000u, 0xAC000000u, 0x7E000000u, 0x68000000u,
+        0x52000000u, 0x44000000u, 0x26000000u, 0x30000000u, 0x0A000000u, 0x1C000000u,
+        0xA9000000u, 0xBF000000u, 0x85000000u, 0x93000000u, 0xF1000000u, 0xE7000000u,
+        0xDD000000u, 0xCB000000u, 0x19000000u, 0x0F000000u, 0x35000000u, 0x23000000u,
+        0x41000000u, 0x57000000u, 0x6D000000u, 0x7B000000u, 0x9B000000u, 0x8D000000u,
+        0xB7000000u, 0xA1000000u, 0xC3000000u, 0xD5000000u, 0xEF000000u, 0xF9000000u,
+        0x2B000000u, 0x3D000000u, 0x07000000u, 0x11000000u, 0x73000000u, 0x65000000u,
+        0x5F000000u, 0x49000000u, 0xFC000000u, 0xEA000000u, 0xD0000000u, 0xC6000000u,
+        0xA4000000u, 0xB2000000u, 0x88000000u, 0x9E000000u, 0x4C000000u, 0x5A000000u,
+        0x60000000u, 0x76000000u, 0x14000000u, 0x02000000u, 0x38000000u, 0x2E000000u,
+        0x55000000u, 0x43000000u, 0x79000000u, 0x6F000000u, 0x0D000000u, 0x1B000000u,
+        0x21000000u, 0x37000000u, 0xE5000000u, 0xF3000000u, 0xC9000000u, 0xDF000000u,
+        0xBD000000u, 0xAB000000u, 0x91000000u, 0x87000000u, 0x32000000u, 0x24000000u,
+        0x1E000000u, 0x08000000u, 0x6A000000u, 0x7C000000u, 0x46000000u, 0x50000000u,
+        0x82000000u, 0x94000000u, 0xAE000000u, 0xB8000000u, 0xDA000000u, 0xCC000000u,
+        0xF6000000u, 0xE0000000u, 0x31000000u, 0x27000000u, 0x1D000000u, 0x0B000000u,
+        0x69000000u, 0x7F000000u, 0x45000000u, 0x53000000u, 0x81000000u, 0x97000000u,
+        0xAD000000u, 0xBB000000u, 0xD9000000u, 0xCF000000u, 0xF5000000u, 0xE3000000u,
+        0x56000000u, 0x40000000u, 0x7A000000u, 0x6C000000u, 0x0E000000u, 0x18000000u,
+        0x22000000u, 0x34000000u, 0xE6000000u, 0xF0000000u, 0xCA000000u, 0xDC000000u,
+        0xBE000000u, 0xA8000000u, 0x92000000u, 0x84000000u, 0xFF000000u, 0xE9000000u,
+        0xD3000000u, 0xC5000000u, 0xA7000000u, 0xB1000000u, 0x8B000000u, 0x9D000000u,
+        0x4F000000u, 0x59000000u, 0x63000000u, 0x75000000u, 0x17000000u, 0x01000000u,
+        0x3B000000u, 0x2D000000u, 0x98000000u, 0x8E000000u, 0xB4000000u, 0xA2000000u,
+        0xC0000000u, 0xD6000000u, 0xEC000000u, 0xFA000000u, 0x28000000u, 0x3E000000u,
+        0x04000000u, 0x12000000u, 0x70000000u, 0x66000000u, 0x5C000000u, 0x4A000000u,
+        0xAA000000u, 0xBC000000u, 0x86000000u, 0x90000000u, 0xF2000000u, 0xE4000000u,
+        0xDE000000u, 0xC8000000u, 0x1A000000u, 0x0C000000u, 0x36000000u, 0x20000000u,
+        0x42000000u, 0x54000000u, 0x6E000000u, 0x78000000u, 0xCD000000u, 0xDB000000u,
+        0xE1000000u, 0xF7000000u, 0x95000000u, 0x83000000u, 0xB9000000u, 0xAF000000u,
+        0x7D000000u, 0x6B000000u, 0x51000000u, 0x47000000u, 0x25000000u, 0x33000000u,
+        0x09000000u, 0x1F000000u, 0x64000000u, 0x72000000u, 0x48000000u, 0x5E000000u,
+        0x3C000000u, 0x2A000000u, 0x10000000u, 0x06000000u, 0xD4000000u, 0xC2000000u,
+        0xF8000000u, 0xEE000000u, 0x8C000000u, 0x9A000000u, 0xA0000000u, 0xB6000000u,
+        0x03000000u, 0x15000000u, 0x2F000000u, 0x39000000u, 0x5B000000u, 0x4D000000u,
+        0x77000000u, 0x61000000u, 0xB3000000u, 0xA5000000u, 0x9F000000u, 0x89000000u,
+        0xEB000000u, 0xFD000000u, 0xC7000000u, 0xD1000000u,
+    },
+};
+
+const SW_CRC_TABLE swCrcTables[SW_CRC_NUM_TABLES] = {
+    {0xEDB88320u, 1, tableCrc32Reflected},
+    {0x10210000u, 0, tableCrc16Normal},
+    {0x00008408u, 1, tableCrc16Reflected},
+    {0x07000000u, 0, tableCrc8Normal},
+};
+
+/**
+ * @}
+ */
@@ -57,10 +57,28 @@ extern "C" {
 #define BOARD_CFG_WFS_UART MXC_UART1
 /** ADE9178 Host UART */
 #define BOARD_CFG_HOST_UART MXC_UART0
+/** ADE9178 SPI character size in bits */
+#define BOARD_CFG_ADE9178_SPI_DATA_SIZE 8
+/** ADE9178 SPI characters moved per DMA request */
+#define BOARD_CFG_ADE9178_SPI_DMA_BURST 1
+/** Number of prepared ADE9178 SPI transactions */
+#define BOARD_CFG_ADE9178_SPI_NUM_XFERS 4
 /** Number of SPI0 slaves  */
 #define BOARD_CFG_ADE9178_SPI_NUM_SLAVES 1
 /** Slave index */
 #define BOARD_CFG_ADE9178_SS_INDEX 0
+/** DMA arbitration priority of the ADE9178 SPI rx, 0 is the highest */
+#define BOARD_CFG_ADE9178_SPI_RX_DMA_PRIORITY 0
+/** DMA arbitration priority of the ADE9178 SPI tx */
+#define BOARD_CFG_ADE9178_SPI_TX_DMA_PRIORITY 1
+/** DMA arbitration priority of the waveform UART rx */
+#define BOARD_CFG_WFS_UART_DMA_PRIORITY 2
+/** DMA arbitration priority of the host UART tx */
+#define BOARD_CFG_HOST_UART_DMA_PRIORITY 3
+/** DMA arbitration priority of the CRC */
+#define BOARD_CFG_CRC_DMA_PRIORITY 3
+/** DMA arbitration priority of the memory copy and fill */
+#define BOARD_CFG_MEM_DMA_PRIORITY 3
 /**  Pin -  ADC reset */
 #define BOARD_CFG_ADC_RESET_PIN MXC_GPIO_PIN_18
 /**  Pin -  ADE reset */
@@ -75,6 +93,12 @@ extern "C" {
 #define BOARD_CFG_SYSTEM_TIMER_CLOCK_TYPE 0
 /**  Timer */
 #define BOARD_CFG_SYSTEM_TIMER MXC_TMR0
+/** Timer of the 1 ms software timer tick */
+#define BOARD_CFG_TICK_TIMER MXC_TMR1
+/** Timer counting the CF1 pulses, CF1 is wired to its input pin */
+#define BOARD_CFG_CF1_COUNT_TIMER MXC_TMR2
+/** Timer counting the CF2 pulses, CF2 is wired to its input pin */
+#define BOARD_CFG_CF2_COUNT_TIMER MXC_TMR3
 
 /** Empty define - The EVK doesn't require a section attribute */
 #define SECTION(SECTION_NAME)
@@ -25,6 +25,9 @@
 static int32_t MemInit(void);
 /** evb info */
 static ADI_EVB_INFO evbInfo;
+/** timers counting the CF1 and CF2 pulses */
+static mxc_tmr_regs_t *const pulseTimers[ADI_EVB_NUM_PULSE_INPUTS] = {
+    BOARD_CFG_CF1_COUNT_TIMER, BOARD_CFG_CF2_COUNT_TIMER};
 
 /*=============  C O D E  =============*/
 int32_t EvbInit(void **phEvb, ADI_EVB_CONFIG *pConfig)
@@ -40,7 +43,7 @@ int32_t EvbInit(void **phEvb, ADI_EVB_CONFIG *pConfig)
     MemInit();
     MXC_DMA_Init();
 
-#if APP_CFG_ENABLE_ADE9178_SPI == 1
+#if (APP_CFG_ENABLE_ADE9178_SPI == 1) || (APP_CFG_ENABLE_HOST_SPI == 1)
 
     status = EvbInitSpi(&pEvb->hSpi, &pConfig->spiConfig);
 #endif
@@ -61,6 +64,12 @@ int32_t EvbInit(void **phEvb, ADI_EVB_CONFIG *pConfig)
         status = EvbInitCrc(&pEvb->hCrc, &pConfig->crcConfig);
     }
 #endif
+#if APP_CFG_ENABLE_MEM_DMA == 1
+    if (status == 0)
+    {
+        status = EvbInitMem();
+    }
+#endif
 
 #if APP_CFG_ENABLE_NVM == 1
     if (status == 0)
@@ -98,11 +107,30 @@ int32_t MemInit(void)
     return status;
 }
 
+uint32_t EvbGetTimerFrequency(void)
+{
+    return MaxGetTimerFrequency();
+}
+
+void EvbStartTickTimer(void)
+{
+    MaxStartTickTimer();
+}
+
+void EvbStopTickTimer(void)
+{
+    MaxStopTickTimer();
+}
+
 #if APP_CFG_ENABLE_SYSTEM_TIMER == 1
 uint32_t EvbTimerInit()
 {
     int32_t status;
     status = MaxTimerInit(BOARD_CFG_SYSTEM_TIMER);
+    if (status == 0)
+    {
+        status = MaxTickTimerInit(BOARD_CFG_TICK_TIMER);
+    }
     return status;
 }
 
@@ -111,6 +139,11 @@ uint32_t EvbGetTime()
     return MaxGetTime(BOARD_CFG_SYSTEM_TIMER);
 }
 
+uint64_t EvbGetTime64(void)
+{
+    return MaxGetTime64(BOARD_CFG_SYSTEM_TIMER);
+}
+
 uint32_t EvbGetMaxTime()
 {
     return MaxGetMaximumTime();
@@ -125,8 +158,51 @@ void EvbStopTimer()
 {
     MaxStopTimer(BOARD_CFG_SYSTEM_TIMER);
 }
+
+int32_t EvbStartDreadyCapture(uint32_t *pRing, uint32_t numEntries)
+{
+    /* DREADY is not routed to a capture input of the system timer on this board */
+    (void)pRing;
+    (void)numEntries;
+    return -1;
+}
+
+void EvbStopDreadyCapture(void)
+{
+}
+
+uint32_t EvbGetDreadyCaptureCount(void)
+{
+    return 0;
+}
+
+uint64_t EvbCaptureToTime64(uint32_t count)
+{
+    (void)count;
+    return 0;
+}
 #endif
 
+int32_t EvbStartPulseCount(uint32_t idx, uint32_t threshold, ADI_EVB_PULSE_CALLBACK pfCallback)
+{
+    int32_t status = ADI_EVB_STATUS_INVALID_INDEX;
+    if (idx < ADI_EVB_NUM_PULSE_INPUTS)
+    {
+        status = MaxStartPulseCount(pulseTimers[idx], idx, threshold, pfCallback);
+    }
+    return status;
+}
+
+void EvbStopPulseCount(uint32_t idx)
+{
+    MaxStopPulseCount(idx);
+}
+
+uint32_t EvbGetPulseCount(uint32_t idx)
+{
+    return MaxGetPulseCount(idx);
+}
+
 /**
  * @}
  */
@@ -13,6 +13,7 @@
 #include "adi_evb.h"
 #include "gpio.h"
 #include "mxc_delay.h"
+#include "mxc_device.h"
 #include <stdint.h>
 
 /*=============  D E F I N I T I O N S  =============*/
@@ -76,11 +77,55 @@ int32_t EvbDelayMs(uint32_t delayMs)
     return ADI_EVB_STATUS_SUCCESS;
 }
 
+uint32_t EvbEnterCritical(void)
+{
+    uint32_t state = __get_PRIMASK();
+    __disable_irq();
+    return state;
+}
+
+void EvbExitCritical(uint32_t state)
+{
+    __set_PRIMASK(state);
+}
+
+int32_t EvbEnterLowPower(ADI_EVB_POWER_MODE mode, uint32_t sleepUs)
+{
+    int32_t wake = -1;
+    /* No wake timer is used, the tick timer or the next interrupt ends the sleep */
+    (void)sleepUs;
+    if (mode == ADI_EVB_POWER_MODE_SLEEP)
+    {
+        SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+        __WFI();
+        wake = 0;
+    }
+    return wake;
+}
+
+int32_t EvbInitCycleCounter(void)
+{
+    int32_t status = -1;
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    /* Cores without the cycle counter report it in the control register */
+    if ((DWT->CTRL & DWT_CTRL_NOCYCCNT_Msk) == 0)
+    {
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        status = 0;
+    }
+    return status;
+}
+
+uint32_t EvbGetCycleCount(void)
+{
+    return DWT->CYCCNT;
+}
+
 int32_t EvbResetAde(void)
 {
     int32_t status = ADI_EVB_STATUS_SUCCESS;
     status = ToggleResetB(1, RESET_PULSE_MSEC, RESET_WAIT_MSEC);
-    EvbDelayMs(RESET_WAIT_MSEC);
     return status;
 }
 
@@ -148,6 +193,27 @@ int32_t EvbLedFlash(uint32_t idx, uint32_t numFlashes, uint32_t flashMs)
     return status;
 }
 
+int32_t EvbSetResetPin(uint32_t idx, uint8_t level)
+{
+    int32_t status = ADI_EVB_STATUS_SUCCESS;
+    if (idx < numReset)
+    {
+        if (level == 0)
+        {
+            MXC_GPIO_OutClr(resetPins[idx].port, resetPins[idx].mask);
+        }
+        else
+        {
+            MXC_GPIO_OutSet(resetPins[idx].port, resetPins[idx].mask);
+        }
+    }
+    else
+    {
+        status = ADI_EVB_STATUS_INVALID_INDEX;
+    }
+    return status;
+}
+
 int32_t ToggleResetB(uint32_t idx, uint32_t pulseMs, uint32_t waitMs)
 {
     int32_t status = ADI_EVB_STATUS_SUCCESS;
@@ -25,10 +25,18 @@ typedef struct
 } EVB_GPIO_INFO;
 
 /** irq pins */
+#if APP_CFG_ENABLE_CF_PULSE_COUNT == 1
+/* CF1 and CF2 are counted by timers, see EvbStartPulseCount */
+static uint32_t inputPinsIrqFalling[] = {BOARD_CFG_IRQ0_PIN, BOARD_CFG_IRQ1_PIN, BOARD_CFG_IRQ2_PIN,
+                                         BOARD_CFG_IRQ3_PIN};
+#else
 static uint32_t inputPinsIrqFalling[] = {BOARD_CFG_IRQ0_PIN, BOARD_CFG_IRQ1_PIN, BOARD_CFG_IRQ2_PIN,
                                          BOARD_CFG_IRQ3_PIN, BOARD_CFG_CF1_PIN,  BOARD_CFG_CF2_PIN};
+#endif
 
+#if BOARD_CFG_HOST_SPI_SLAVE != 1
 static uint32_t inputPinsIrqBoth[] = {BOARD_CFG_HOST_RDY_PIN, BOARD_CFG_HOST_ERR_PIN};
+#endif
 
 static uint32_t outputPins[] = {BOARD_CFG_ADC_RESET_PIN, BOARD_CFG_ADE_RESET_PIN,
                                 BOARD_CFG_LED1_PIN, BOARD_CFG_LED2_PIN};
@@ -62,6 +70,8 @@ int32_t EvbInitGpio(void **phGpio, ADI_EVB_GPIO_CONFIG *pConfig)
         MXC_GPIO_IntConfig(&config, MXC_GPIO_INT_FALLING);
     }
 
+#if BOARD_CFG_HOST_SPI_SLAVE != 1
+    /* HOST_RDY and HOST_ERR are outputs owned by the host spi in slave mode */
     numPins = sizeof(inputPinsIrqBoth) / sizeof(inputPinsIrqBoth[0]);
     for (i = 0; i < numPins; i++)
     {
@@ -69,16 +79,19 @@ int32_t EvbInitGpio(void **phGpio, ADI_EVB_GPIO_CONFIG *pConfig)
         MXC_GPIO_Config(&config);
         MXC_GPIO_IntConfig(&config, MXC_GPIO_INT_BOTH);
     }
+#endif
 
     config.func = MXC_GPIO_FUNC_OUT;
     config.vssel = MXC_GPIO_VSSEL_VDDIO;
 
     numPins = sizeof(outputPins) / sizeof(outputPins[0]);
+    config.mask = 0;
     for (i = 0; i < numPins; i++)
     {
-        config.mask = outputPins[i];
-        EvbConfigureOutPin(BOARD_CFG_ADECOMM_PORT, outputPins[i]);
+        config.mask |= outputPins[i];
     }
+    /* All the outputs are enabled and driven high together */
+    EvbConfigureOutPin(BOARD_CFG_ADECOMM_PORT, config.mask);
 
     irqn = MXC_GPIO_GET_IRQ(MXC_GPIO_GET_IDX(BOARD_CFG_ADECOMM_PORT));
     NVIC_SetPriority(irqn, APP_CFG_PORT0_GPIO_INT_PRIO);
@@ -94,17 +107,18 @@ int32_t EvbInitGpio(void **phGpio, ADI_EVB_GPIO_CONFIG *pConfig)
 void EvbEnableAllGPIOIrq(void)
 {
     int32_t idx;
+    int32_t numPins = sizeof(inputPinsIrqFalling) / sizeof(inputPinsIrqFalling[0]);
+#if BOARD_CFG_HOST_SPI_SLAVE != 1
     uint32_t pins[2] = {BOARD_CFG_HOST_RDY_PIN, BOARD_CFG_HOST_ERR_PIN};
-    uint32_t irqPins[6] = {BOARD_CFG_IRQ0_PIN, BOARD_CFG_IRQ1_PIN, BOARD_CFG_IRQ2_PIN,
-                           BOARD_CFG_IRQ3_PIN, BOARD_CFG_CF1_PIN,  BOARD_CFG_CF2_PIN};
     for (idx = 0; idx < 2; idx++)
     {
         EvbEnableGPIOIrq((uint32_t)BOARD_CFG_ADECOMM_PORT, pins[idx]);
     }
+#endif
 
-    for (idx = 0; idx < 6; idx++)
+    for (idx = 0; idx < numPins; idx++)
     {
-        EvbEnableGPIOIrq((uint32_t)BOARD_CFG_ADEIRQ_PORT, irqPins[idx]);
+        EvbEnableGPIOIrq((uint32_t)BOARD_CFG_ADEIRQ_PORT, inputPinsIrqFalling[idx]);
     }
 }
 
@@ -125,13 +139,52 @@ void EvbDisableGPIOIrq(uint32_t port, uint32_t pin)
     MXC_GPIO_DisableInt((mxc_gpio_regs_t *)port, pin);
 }
 
+int32_t EvbGpioWriteMask(uint32_t port, uint32_t setMask, uint32_t clearMask)
+{
+    int32_t status = -1;
+    uint32_t state;
+    mxc_gpio_regs_t *pGpio = (mxc_gpio_regs_t *)port;
+    if ((pGpio != NULL) && ((setMask & clearMask) == 0))
+    {
+        if (clearMask == 0)
+        {
+            pGpio->out_set = setMask;
+        }
+        else if (setMask == 0)
+        {
+            pGpio->out_clr = clearMask;
+        }
+        else
+        {
+            /* out_set and out_clr would be two writes, the out register takes both in one */
+            state = EvbEnterCritical();
+            pGpio->out = (pGpio->out & ~clearMask) | setMask;
+            EvbExitCritical(state);
+        }
+        status = 0;
+    }
+    return status;
+}
+
 void GpioIrqHandler(void)
 {
     uint32_t stat;
+    uint32_t unhandled = 0;
     stat = BOARD_CFG_ADECOMM_PORT->intfl;
-    if (gpioInfo.pfGpioCallback != NULL)
+#if BOARD_CFG_HOST_SPI_SLAVE != 1
+    /* HOST_RDY is checked first and called without a table walk */
+    if ((stat & BOARD_CFG_HOST_RDY_PIN) != 0)
+    {
+        unhandled = EvbGpioDispatchPin((uint32_t)BOARD_CFG_ADECOMM_PORT, BOARD_CFG_HOST_RDY_PIN);
+    }
+    unhandled |=
+        EvbGpioDispatch((uint32_t)BOARD_CFG_ADECOMM_PORT, stat & ~BOARD_CFG_HOST_RDY_PIN);
+#else
+    unhandled = EvbGpioDispatch((uint32_t)BOARD_CFG_ADECOMM_PORT, stat);
+#endif
+    if ((unhandled != 0) && (gpioInfo.pfGpioCallback != NULL))
     {
-        gpioInfo.pfGpioCallback((uint32_t)BOARD_CFG_ADECOMM_PORT, stat);
+        gpioInfo.pfGpioCallback((uint32_t)BOARD_CFG_ADECOMM_PORT, unhandled);
     }
     BOARD_CFG_ADECOMM_PORT->intfl_clr = stat;
 }
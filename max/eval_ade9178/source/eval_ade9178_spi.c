@@ -29,23 +29,45 @@ typedef struct
 {
     /** maxim spi instance info */
     MAX_SPI_INSTANCE adeSpiInfo;
+    /** prepared transactions */
+    MAX_SPI_XFER adeSpiXfer[BOARD_CFG_ADE9178_SPI_NUM_XFERS];
+    /** segments of the burst in progress, NULL when no burst is active */
+    ADI_EVB_SPI_SEGMENT *pSegments;
+    /** num of segments in the burst */
+    uint32_t numSegments;
+    /** index of the segment in progress */
+    volatile uint32_t segmentIndex;
     /** callback */
     ADI_EVB_CALLBACK pfAdeSpiRxCallback;
     /** callback */
     ADI_EVB_CALLBACK pfAdeSpiTxCallback;
+    /** CRC job submitted at the end of each reception */
+    ADI_EVB_CRC_JOB rxCrcJob;
+    /** Evb handle passed to the CRC driver */
+    void *hRxCrcEvb;
+    /** callback of the chained CRC, NULL when no CRC is chained */
+    ADI_EVB_SPI_CRC_CALLBACK pfRxCrcCallback;
+    /** 1 while the CRC of a reception is queued or in progress */
+    volatile uint8_t isRxCrcPending;
 
 } EVB_SPI_INFO;
 
 /** Spi irq handler */
 static void SpiIrqHandler(void);
-/** Tx dma irq handler */
-static void SpiTxIrqHandler(void);
-/** Rx dma irq handler */
-static void SpiRxIrqHandler(void);
+/** Tx dma callback */
+static void SpiTxDmaCallBack(int32_t channel, uint8_t error);
+/** Rx dma callback */
+static void SpiRxDmaCallBack(int32_t channel, uint8_t error);
 /** Setup ISRs */
 static void SetupSpiIsr(void);
 /** Evb spi init */
 static int32_t InitAdeSpi(ADI_EVB_SPI_CONFIG *pConfig);
+/** Starts a segment of the burst in progress */
+static void StartBurstSegment(void);
+/** Submits the CRC of the completed reception */
+static void StartRxCrc(void);
+/** End of the CRC of a reception */
+static void RxCrcCallBack(ADI_EVB_CRC_JOB *pJob, int32_t status);
 
 /*=============  D A T A  =============*/
 /** Evb spi info */
@@ -92,6 +114,69 @@ int32_t EvbAdeSpiReceiveAsync(void *hEvb, uint8_t *pData, uint32_t numBytes)
 
     return status;
 }
+int32_t EvbAdeSpiPrepareTransceive(void *hEvb, uint8_t *pTxData, uint8_t *pRxData,
+                                   uint32_t numBytes, uint32_t xferIndex)
+{
+    int32_t status = -1;
+    MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adeSpiInfo;
+    if ((hEvb != NULL) && (xferIndex < BOARD_CFG_ADE9178_SPI_NUM_XFERS))
+    {
+        status = MaxPrepareSpiTxRxDMA(pSpiInfo, &evbSpiInfo.adeSpiXfer[xferIndex], pTxData,
+                                      pRxData, numBytes);
+    }
+
+    return status;
+}
+
+int32_t EvbAdeSpiStartPrepared(void *hEvb, uint32_t xferIndex)
+{
+    int32_t status = -1;
+    MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adeSpiInfo;
+    if ((hEvb != NULL) && (xferIndex < BOARD_CFG_ADE9178_SPI_NUM_XFERS))
+    {
+        status = MaxStartSpiXfer(pSpiInfo, &evbSpiInfo.adeSpiXfer[xferIndex]);
+    }
+
+    return status;
+}
+
+int32_t EvbAdeSpiTransceiveBurst(void *hEvb, ADI_EVB_SPI_SEGMENT *pSegments, uint32_t numSegments)
+{
+    int32_t status = -1;
+    uint32_t i;
+    if ((hEvb != NULL) && (pSegments != NULL) && (numSegments > 0) &&
+        (evbSpiInfo.pSegments == NULL))
+    {
+        status = 0;
+        /* Segments are started from the dma interrupt, their lengths are checked here */
+        for (i = 0; (i < numSegments) && (status == 0); i++)
+        {
+            status = MaxCheckSpiLength(&evbSpiInfo.adeSpiInfo, pSegments[i].numBytes);
+        }
+    }
+    if (status == 0)
+    {
+        evbSpiInfo.pSegments = pSegments;
+        evbSpiInfo.numSegments = numSegments;
+        evbSpiInfo.segmentIndex = 0;
+        StartBurstSegment();
+    }
+
+    return status;
+}
+
+int32_t EvbAdeSpiGetXferStatus(void *hEvb)
+{
+    int32_t status = -1;
+    MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adeSpiInfo;
+    if ((hEvb != NULL) && (pSpiInfo->txError == 0) && (pSpiInfo->rxError == 0))
+    {
+        status = ADI_EVB_STATUS_SUCCESS;
+    }
+
+    return status;
+}
+
 int32_t EvbAdeSpiSetFrequency(void *hEvb, uint32_t spiFrequency)
 {
     int32_t status = -1;
@@ -104,6 +189,58 @@ int32_t EvbAdeSpiSetFrequency(void *hEvb, uint32_t spiFrequency)
     return status;
 }
 
+int32_t EvbAdeSpiSetDataSize(void *hEvb, uint32_t dataSize, uint32_t burstLength)
+{
+    int32_t status = -1;
+    MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adeSpiInfo;
+    if ((hEvb != NULL) && ((dataSize == 8u) || (dataSize == 16u)))
+    {
+        status = MaxSetSpiDataSize(pSpiInfo, dataSize, burstLength);
+    }
+
+    return status;
+}
+
+int32_t EvbAdeSpiSetRxStride(void *hEvb, uint32_t rxStride)
+{
+    int32_t status = -1;
+    /* The dma has no destination address offset, only contiguous reception is supported */
+    if ((hEvb != NULL) && (rxStride == 0))
+    {
+        status = 0;
+    }
+
+    return status;
+}
+
+int32_t EvbAdeSpiSetRxCrc(void *hEvb, ADI_EVB_CRC_CONTEXT *pContext, uint8_t *pData,
+                          uint32_t numBytes, ADI_EVB_SPI_CRC_CALLBACK pfCallback)
+{
+    int32_t status = -1;
+#if APP_CFG_ENABLE_HW_CRC == 1
+    if ((hEvb != NULL) && (evbSpiInfo.isRxCrcPending == 0) &&
+        ((pfCallback == NULL) || ((pContext != NULL) && (pData != NULL) && (numBytes > 0))))
+    {
+        evbSpiInfo.pfRxCrcCallback = NULL;
+        evbSpiInfo.hRxCrcEvb = hEvb;
+        evbSpiInfo.rxCrcJob.pContext = pContext;
+        evbSpiInfo.rxCrcJob.pData = pData;
+        evbSpiInfo.rxCrcJob.numBytes = numBytes;
+        evbSpiInfo.rxCrcJob.pfCallback = RxCrcCallBack;
+        evbSpiInfo.pfRxCrcCallback = pfCallback;
+        status = 0;
+    }
+#else
+    (void)hEvb;
+    (void)pContext;
+    (void)pData;
+    (void)numBytes;
+    (void)pfCallback;
+#endif /* APP_CFG_ENABLE_HW_CRC */
+
+    return status;
+}
+
 int32_t InitAdeSpi(ADI_EVB_SPI_CONFIG *pConfig)
 {
     int32_t status = 0;
@@ -113,8 +250,11 @@ int32_t InitAdeSpi(ADI_EVB_SPI_CONFIG *pConfig)
     int32_t rxChannel;
     evbSpiInfo.pfAdeSpiRxCallback = pConfig->pfAdeSpiRxCallback;
     evbSpiInfo.pfAdeSpiTxCallback = pConfig->pfAdeSpiTxCallback;
-    txChannel = MXC_DMA_AcquireChannel();
-    rxChannel = MXC_DMA_AcquireChannel();
+    /* Rx is served first so that the rx fifo does not overflow */
+    txChannel = MaxAcquireDMAChannel(BOARD_CFG_ADE9178_SPI_TX_DMA_PRIORITY,
+                                     APP_CFG_ADE9178_SPI_TX_INT_PRIORITY, SpiTxDmaCallBack);
+    rxChannel = MaxAcquireDMAChannel(BOARD_CFG_ADE9178_SPI_RX_DMA_PRIORITY,
+                                     APP_CFG_ADE9178_SPI_RX_INT_PRIORITY, SpiRxDmaCallBack);
     if ((txChannel < 0) || ((rxChannel < 0)))
     {
         status = ADI_EVB_STATUS_DMA_CHANNEL_ACQUIRE_ERROR;
@@ -130,6 +270,8 @@ int32_t InitAdeSpi(ADI_EVB_SPI_CONFIG *pConfig)
         pSpiInfo->spiSpeed = APP_CFG_ADE9178_SPI_SPEED;
         pSpiInfo->pSpi = BOARD_CFG_ADE9178_SPI;
         pSpiInfo->spiMode = APP_CFG_ADE9178_SPI_MODE;
+        pSpiInfo->dataSize = BOARD_CFG_ADE9178_SPI_DATA_SIZE;
+        pSpiInfo->dmaBurst = BOARD_CFG_ADE9178_SPI_DMA_BURST;
         pSpiInfo->master = 1;
         status = MaxInitSpi(pSpiInfo);
     }
@@ -142,25 +284,12 @@ int32_t InitAdeSpi(ADI_EVB_SPI_CONFIG *pConfig)
 void SetupSpiIsr(void)
 {
     IRQn_Type irqn;
-    MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adeSpiInfo;
 
-    /* SPI Isr */
+    /* SPI Isr, dma interrupts are routed when the channels are acquired */
     irqn = MXC_SPI_GET_IRQ(MXC_SPI_GET_IDX(BOARD_CFG_ADE9178_SPI));
     NVIC_EnableIRQ(irqn);
     NVIC_SetVector(irqn, (uint32_t)SpiIrqHandler);
     NVIC_SetPriority(irqn, APP_CFG_ADE9178_SPI_INT_PRIORITY);
-
-    /* Spi DMA Tx ISR*/
-    irqn = MaxGetDMAIRQn(pSpiInfo->txDmaDesc.channel);
-    NVIC_EnableIRQ(irqn);
-    NVIC_SetPriority(irqn, APP_CFG_ADE9178_SPI_TX_INT_PRIORITY);
-    NVIC_SetVector(irqn, (uint32_t)SpiTxIrqHandler);
-
-    /* Spi DMA Rx ISR*/
-    irqn = MaxGetDMAIRQn(pSpiInfo->rxDmaDesc.channel);
-    NVIC_EnableIRQ(irqn);
-    NVIC_SetVector(irqn, (uint32_t)SpiRxIrqHandler);
-    NVIC_SetPriority(irqn, APP_CFG_ADE9178_SPI_RX_INT_PRIORITY);
 }
 
 void SpiIrqHandler(void)
@@ -172,39 +301,101 @@ void SpiIrqHandler(void)
     pSpiInfo->pSpi->intfl = intStatus; // clearing all pending interrupts(write 1 to clear)
 }
 
-void SpiTxIrqHandler(void)
+void SpiTxDmaCallBack(int32_t channel, uint8_t error)
 {
     MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adeSpiInfo;
 
-    pSpiInfo->txError = 0;
-    /* 0x50 is the mask for timeout and Bus Error bits */
-    if (MXC_DMA->ch[pSpiInfo->txDmaDesc.channel].status & 0x50)
+    (void)channel;
+    pSpiInfo->txError = error;
+    /* Tx of a burst is reported once, with the last segment */
+    if ((evbSpiInfo.pfAdeSpiTxCallback != NULL) &&
+        ((evbSpiInfo.pSegments == NULL) ||
+         (evbSpiInfo.segmentIndex + 1 >= evbSpiInfo.numSegments)))
     {
-        pSpiInfo->txError = 1;
+        evbSpiInfo.pfAdeSpiTxCallback();
     }
-    /* 0x5C is the mask for status register */
-    MXC_DMA->ch[pSpiInfo->txDmaDesc.channel].status |= 0x5C;
-    if (evbSpiInfo.pfAdeSpiTxCallback != NULL)
+}
+void SpiRxDmaCallBack(int32_t channel, uint8_t error)
+{
+    MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adeSpiInfo;
+
+    (void)channel;
+    pSpiInfo->rxError = error;
+    if (evbSpiInfo.pSegments != NULL)
     {
-        evbSpiInfo.pfAdeSpiTxCallback();
+        evbSpiInfo.segmentIndex++;
+        if ((pSpiInfo->rxError == 0) && (pSpiInfo->txError == 0) &&
+            (evbSpiInfo.segmentIndex < evbSpiInfo.numSegments))
+        {
+            StartBurstSegment();
+        }
+        else
+        {
+            MaxSetSpiSlaveSelectHold(pSpiInfo, 0);
+            evbSpiInfo.pSegments = NULL;
+        }
+    }
+    if (evbSpiInfo.pSegments == NULL)
+    {
+        if (evbSpiInfo.pfRxCrcCallback != NULL)
+        {
+            StartRxCrc();
+        }
+        else if (evbSpiInfo.pfAdeSpiRxCallback != NULL)
+        {
+            evbSpiInfo.pfAdeSpiRxCallback();
+        }
     }
 }
-void SpiRxIrqHandler(void)
+
+void StartBurstSegment(void)
+{
+    MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adeSpiInfo;
+    ADI_EVB_SPI_SEGMENT *pSegment = &evbSpiInfo.pSegments[evbSpiInfo.segmentIndex];
+
+    /* Slave select is released at the end of the last segment only */
+    MaxSetSpiSlaveSelectHold(pSpiInfo, evbSpiInfo.segmentIndex + 1 < evbSpiInfo.numSegments);
+    MaxStartSpiTxRxDMA(pSpiInfo, pSegment->pTxData, pSegment->pRxData, pSegment->numBytes);
+}
+
+void StartRxCrc(void)
 {
+    int32_t status = -1;
     MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adeSpiInfo;
 
-    pSpiInfo->rxError = 0;
-    /* 0x50 is the mask for timeout and Bus Error bits */
-    if (MXC_DMA->ch[pSpiInfo->rxDmaDesc.channel].status & 0x50)
+    /* The CRC dma is started from this interrupt, the data is not touched by the cpu */
+    if ((pSpiInfo->rxError == 0) && (evbSpiInfo.isRxCrcPending == 0))
     {
-        pSpiInfo->rxError = 1;
+        evbSpiInfo.isRxCrcPending = 1;
+#if APP_CFG_ENABLE_HW_CRC == 1
+        /* Each reception gets its own CRC, the job starts again from the seed */
+        status = EvbCrcContextInit(evbSpiInfo.rxCrcJob.pContext,
+                                   &evbSpiInfo.rxCrcJob.pContext->params);
+        if (status == 0)
+        {
+            status = EvbCrcSubmit(evbSpiInfo.hRxCrcEvb, &evbSpiInfo.rxCrcJob);
+        }
+#endif /* APP_CFG_ENABLE_HW_CRC */
+        if (status != 0)
+        {
+            evbSpiInfo.isRxCrcPending = 0;
+        }
     }
-    if (evbSpiInfo.pfAdeSpiRxCallback != NULL)
+    if (status != 0)
+    {
+        evbSpiInfo.pfRxCrcCallback(status, 0);
+    }
+}
+
+void RxCrcCallBack(ADI_EVB_CRC_JOB *pJob, int32_t status)
+{
+    ADI_EVB_SPI_CRC_CALLBACK pfCallback = evbSpiInfo.pfRxCrcCallback;
+
+    evbSpiInfo.isRxCrcPending = 0;
+    if (pfCallback != NULL)
     {
-        evbSpiInfo.pfAdeSpiRxCallback();
+        pfCallback(status, pJob->pContext->value);
     }
-    /* 0x5C is the mask for status register */
-    MXC_DMA->ch[pSpiInfo->rxDmaDesc.channel].status |= 0x5C;
 }
 
 /**
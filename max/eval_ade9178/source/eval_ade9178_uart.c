@@ -51,8 +51,8 @@ static ADI_EVB_CALLBACK pUartRxCallBack;
 static int32_t InitWfsUart(ADI_EVB_UART_CONFIG *pConfig);
 /** Set up uart isr */
 static void SetupWfsUartIsr(void);
-/** Uart rx dma handler */
-static void WfsUartRxDmaIrqHandler(void);
+/** Uart rx dma callback */
+static void WfsUartRxDmaCallBack(int32_t channel, uint8_t error);
 /** Uart irq handler */
 static void WfsUartIrqHandler(void);
 #endif /* APP_CFG_ENABLE_HOST_UART */
@@ -60,8 +60,8 @@ static void WfsUartIrqHandler(void);
 #if APP_CFG_ENABLE_HOST_UART == 1
 /** Uart rx dma handler */
 static void HostUartRxIrqHandler(void);
-/** Uart tx dma handler */
-static void HostUartTxIrqHandler(void);
+/** Uart tx dma callback */
+static void HostUartTxDmaCallBack(int32_t channel, uint8_t error);
 /** Initialse uart for host */
 static int32_t InitHostUart(ADI_EVB_UART_CONFIG *pConfig);
 /** Set up uart isr */
@@ -229,7 +229,8 @@ int32_t InitHostUart(ADI_EVB_UART_CONFIG *pConfig)
     evbUartInfo.pfHostRxCallback = pConfig->pfHostUartRxCallback;
     evbUartInfo.pfHostTxCallback = pConfig->pfHostUartTxCallback;
 
-    channel = MXC_DMA_AcquireChannel();
+    channel = MaxAcquireDMAChannel(BOARD_CFG_HOST_UART_DMA_PRIORITY, APP_CFG_UART_INTR_PRIORITY,
+                                   HostUartTxDmaCallBack);
     if (channel < 0)
     {
         status = ADI_EVB_STATUS_DMA_CHANNEL_ACQUIRE_ERROR;
@@ -254,19 +255,12 @@ int32_t InitHostUart(ADI_EVB_UART_CONFIG *pConfig)
 void SetupHostUartIsr(void)
 {
     IRQn_Type irqn;
-    MAX_UART_INSTANCE *pUartInfo = &evbUartInfo.hostUartInfo;
 
-    /* uart Isr */
+    /* uart Isr, the dma interrupt is routed when the channel is acquired */
     irqn = MXC_UART_GET_IRQ(MXC_UART_GET_IDX(BOARD_CFG_HOST_UART));
     NVIC_SetVector(irqn, (uint32_t)HostUartRxIrqHandler);
     NVIC_SetPriority(irqn, APP_CFG_UART_INTR_PRIORITY);
     NVIC_EnableIRQ(irqn);
-
-    /* uart DMA Tx ISR*/
-    irqn = MaxGetDMAIRQn(pUartInfo->txDmaDesc.channel);
-    NVIC_SetPriority(irqn, APP_CFG_UART_INTR_PRIORITY);
-    NVIC_SetVector(irqn, (uint32_t)HostUartTxIrqHandler);
-    NVIC_EnableIRQ(irqn);
 }
 
 void HostUartRxIrqHandler(void)
@@ -274,10 +268,11 @@ void HostUartRxIrqHandler(void)
     MXC_UART_AsyncHandler(BOARD_CFG_HOST_UART);
 }
 
-void HostUartTxIrqHandler(void)
+void HostUartTxDmaCallBack(int32_t channel, uint8_t error)
 {
     MAX_UART_INSTANCE *pUartInfo = &evbUartInfo.hostUartInfo;
-    MXC_DMA_Handler();
+    (void)channel;
+    pUartInfo->txError = error;
     pUartInfo->isTxComplete = 1;
     if (evbUartInfo.pfHostTxCallback != NULL)
     {
@@ -306,7 +301,8 @@ int32_t InitWfsUart(ADI_EVB_UART_CONFIG *pConfig)
 
     MAX_UART_INSTANCE *pUartInfo = &evbUartInfo.wfsUartInfo;
     evbUartInfo.pfWfsRxCallback = pConfig->pfWfsUartRxCallback;
-    channel = MXC_DMA_AcquireChannel();
+    channel = MaxAcquireDMAChannel(BOARD_CFG_WFS_UART_DMA_PRIORITY, APP_CFG_WFS_UART_INT_PRIORITY,
+                                   WfsUartRxDmaCallBack);
     if (channel < 0)
     {
         status = ADI_EVB_STATUS_DMA_CHANNEL_ACQUIRE_ERROR;
@@ -339,11 +335,6 @@ void SetupWfsUartIsr(void)
     NVIC_SetPriority(irqn, APP_CFG_WFS_ERROR_INT_PRIORITY);
     NVIC_EnableIRQ(irqn);
 
-    /* Spi DMA Tx ISR*/
-    irqn = MaxGetDMAIRQn(pUartInfo->rxDmaDesc.channel);
-    NVIC_SetPriority(irqn, APP_CFG_WFS_UART_INT_PRIORITY);
-    NVIC_SetVector(irqn, (uint32_t)WfsUartRxDmaIrqHandler);
-    NVIC_EnableIRQ(irqn);
 }
 
 void WfsUartIrqHandler(void)
@@ -356,19 +347,12 @@ void WfsUartIrqHandler(void)
     pUartInfo->pUart->int_fl = intrpStatus; // clearing all pending interrupts(write 1 to clear)
 }
 
-void WfsUartRxDmaIrqHandler(void)
+void WfsUartRxDmaCallBack(int32_t channel, uint8_t error)
 {
     MAX_UART_INSTANCE *pUartInfo = &evbUartInfo.wfsUartInfo;
-    MAX_DMA_DESC *pDesc = &pUartInfo->rxDmaDesc;
+    (void)channel;
     pUartInfo->isRxComplete = 1;
-    pUartInfo->rxError = 0;
-    /* 0x50 is the mask for timeout and Bus Error bits */
-    if (MXC_DMA->ch[pDesc->channel].status & 0x50)
-    {
-        pUartInfo->rxError = 1;
-    }
-    /* 0x5C is the mask for status register */
-    MXC_DMA->ch[pDesc->channel].status |= 0x5C;
+    pUartInfo->rxError = error;
     if (evbUartInfo.pfWfsRxCallback != NULL)
     {
         evbUartInfo.pfWfsRxCallback();
@@ -0,0 +1,268 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     eval_ade9178_slave_spi.c
+ * @brief    Host SPI interface with the MAX32670 as SPI slave
+ * @{
+ */
+
+/*============= I N C L U D E S =============*/
+
+#include "adi_evb.h"
+#include "app_cfg.h"
+#include "dma.h"
+#include "max3267x_dma_config.h"
+#include "max3267x_spi_config.h"
+#include "mxc_device.h"
+#include "nvic_table.h"
+#include <stdint.h>
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Evb spi info */
+typedef struct
+{
+    /** maxim spi instance info */
+    MAX_SPI_INSTANCE hostSpiInfo;
+    /** prepared transactions */
+    MAX_SPI_XFER hostSpiXfer[BOARD_CFG_HOST_SPI_NUM_XFERS];
+    /** 1 while a transaction is armed and waiting for the host */
+    volatile uint8_t isArmed;
+    /** callback */
+    ADI_EVB_CALLBACK pfHostSpiRxCallback;
+    /** callback */
+    ADI_EVB_CALLBACK pfHostSpiTxCallback;
+
+} EVB_SPI_INFO;
+
+/** Spi irq handler */
+static void SpiIrqHandler(void);
+/** Tx dma callback */
+static void SpiTxDmaCallBack(int32_t channel, uint8_t error);
+/** Rx dma callback */
+static void SpiRxDmaCallBack(int32_t channel, uint8_t error);
+/** Setup ISRs */
+static void SetupSpiIsr(void);
+/** Evb spi init */
+static int32_t InitHostSpi(ADI_EVB_SPI_CONFIG *pConfig);
+/** Configures HOST_RDY and HOST_ERR as outputs */
+static void InitHostPins(void);
+/** Drives HOST_RDY or HOST_ERR, active high */
+static void SetHostPin(uint32_t pin, uint8_t active);
+
+/*=============  D A T A  =============*/
+/** Evb spi info */
+static EVB_SPI_INFO evbSpiInfo;
+
+/*=============  C O D E  =============*/
+
+int32_t EvbInitSpi(void **phSpi, ADI_EVB_SPI_CONFIG *pConfig)
+{
+    int32_t status = 0;
+
+    status = InitHostSpi(pConfig);
+
+    if (status == 0)
+    {
+        /* Just a keeping a API provision to support multiple SPIs later*/
+        *phSpi = &evbSpiInfo.hostSpiInfo;
+    }
+
+    SetupSpiIsr();
+
+    return status;
+}
+
+int32_t EvbHostSpiPrepare(void *hEvb, uint8_t *pTxData, uint8_t *pRxData, uint32_t numBytes,
+                          uint32_t xferIndex)
+{
+    int32_t status = -1;
+    MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.hostSpiInfo;
+    if ((hEvb != NULL) && (xferIndex < BOARD_CFG_HOST_SPI_NUM_XFERS))
+    {
+        status = MaxPrepareSpiTxRxDMA(pSpiInfo, &evbSpiInfo.hostSpiXfer[xferIndex], pTxData,
+                                      pRxData, numBytes);
+    }
+
+    return status;
+}
+
+int32_t EvbHostSpiArm(void *hEvb, uint32_t xferIndex)
+{
+    int32_t status = -1;
+    MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.hostSpiInfo;
+    if ((hEvb != NULL) && (xferIndex < BOARD_CFG_HOST_SPI_NUM_XFERS) &&
+        (evbSpiInfo.isArmed == 0))
+    {
+        pSpiInfo->txError = 0;
+        pSpiInfo->rxError = 0;
+        evbSpiInfo.isArmed = 1;
+        MaxStartSpiXfer(pSpiInfo, &evbSpiInfo.hostSpiXfer[xferIndex]);
+        /* Host may clock the transaction once the tx fifo is loaded */
+        SetHostPin(BOARD_CFG_HOST_ERR_PIN, 0);
+        SetHostPin(BOARD_CFG_HOST_RDY_PIN, 1);
+        status = 0;
+    }
+
+    return status;
+}
+
+int32_t EvbHostSpiSetError(void *hEvb, uint8_t error)
+{
+    int32_t status = -1;
+    if (hEvb != NULL)
+    {
+        SetHostPin(BOARD_CFG_HOST_ERR_PIN, error);
+        status = 0;
+    }
+
+    return status;
+}
+
+int32_t EvbAbortHostSpi(void)
+{
+    int32_t status = 0;
+    MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.hostSpiInfo;
+
+    SetHostPin(BOARD_CFG_HOST_RDY_PIN, 0);
+    MaxAbortSpiDMA(pSpiInfo);
+    if (evbSpiInfo.isArmed == 1)
+    {
+        evbSpiInfo.isArmed = 0;
+        EvbHostSpiIrqCallback(1);
+    }
+
+    return status;
+}
+
+int32_t InitHostSpi(ADI_EVB_SPI_CONFIG *pConfig)
+{
+    int32_t status = 0;
+#if APP_CFG_ENABLE_HOST_SPI == 1
+    MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.hostSpiInfo;
+    int32_t txChannel;
+    int32_t rxChannel;
+    evbSpiInfo.pfHostSpiRxCallback = pConfig->pfHostSpiRxCallback;
+    evbSpiInfo.pfHostSpiTxCallback = pConfig->pfHostSpiTxCallback;
+    evbSpiInfo.isArmed = 0;
+    InitHostPins();
+    txChannel = MaxAcquireDMAChannel(BOARD_CFG_HOST_SPI_TX_DMA_PRIORITY,
+                                     APP_CFG_HOST_SPI_TX_INT_PRIORITY, SpiTxDmaCallBack);
+    rxChannel = MaxAcquireDMAChannel(BOARD_CFG_HOST_SPI_RX_DMA_PRIORITY,
+                                     APP_CFG_HOST_SPI_RX_INT_PRIORITY, SpiRxDmaCallBack);
+    if ((txChannel < 0) || ((rxChannel < 0)))
+    {
+        status = ADI_EVB_STATUS_DMA_CHANNEL_ACQUIRE_ERROR;
+    }
+    else
+    {
+        pSpiInfo->txDmaDesc.channel = txChannel;
+        pSpiInfo->rxDmaDesc.channel = rxChannel;
+        pSpiInfo->numSlaves = 1;
+        pSpiInfo->rxDmaDesc.source = MaxGetSpiDMAReqSelRx(BOARD_CFG_HOST_SPI);
+        pSpiInfo->txDmaDesc.source = MaxGetSpiDMAReqSelTx(BOARD_CFG_HOST_SPI);
+        pSpiInfo->spiSpeed = APP_CFG_HOST_SPI_SPEED;
+        pSpiInfo->pSpi = BOARD_CFG_HOST_SPI;
+        pSpiInfo->spiMode = APP_CFG_HOST_SPI_MODE;
+        pSpiInfo->dataSize = BOARD_CFG_HOST_SPI_DATA_SIZE;
+        pSpiInfo->dmaBurst = BOARD_CFG_HOST_SPI_DMA_BURST;
+        pSpiInfo->master = 0;
+        status = MaxSlaveInitSpi(pSpiInfo);
+    }
+
+#endif /* APP_CFG_ENABLE_HOST_SPI */
+
+    return status;
+}
+
+void InitHostPins(void)
+{
+    mxc_gpio_regs_t *pGpio = BOARD_CFG_ADECOMM_PORT;
+    uint32_t mask = BOARD_CFG_HOST_RDY_PIN | BOARD_CFG_HOST_ERR_PIN;
+
+    pGpio->en0_set = mask;
+    pGpio->en1_clr = mask;
+    pGpio->en2_clr = mask;
+    pGpio->out_clr = mask;
+    pGpio->outen_set = mask;
+}
+
+void SetHostPin(uint32_t pin, uint8_t active)
+{
+    if (active == 1)
+    {
+        BOARD_CFG_ADECOMM_PORT->out_set = pin;
+    }
+    else
+    {
+        BOARD_CFG_ADECOMM_PORT->out_clr = pin;
+    }
+}
+
+void SetupSpiIsr(void)
+{
+#if APP_CFG_ENABLE_HOST_SPI == 1
+    IRQn_Type irqn;
+
+    /* SPI Isr, dma interrupts are routed when the channels are acquired */
+    irqn = MXC_SPI_GET_IRQ(MXC_SPI_GET_IDX(BOARD_CFG_HOST_SPI));
+    NVIC_EnableIRQ(irqn);
+    NVIC_SetVector(irqn, (uint32_t)SpiIrqHandler);
+    NVIC_SetPriority(irqn, APP_CFG_HOST_SPI_INT_PRIORITY);
+#endif /* APP_CFG_ENABLE_HOST_SPI */
+}
+
+void SpiIrqHandler(void)
+{
+    uint32_t intStatus;
+    uint8_t aborted = 0;
+    MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.hostSpiInfo;
+
+    intStatus = pSpiInfo->pSpi->intfl;
+    pSpiInfo->pSpi->intfl = intStatus; // clearing all pending interrupts(write 1 to clear)
+    /* Slave select released by the host ends the armed transaction */
+    if (((intStatus & MXC_F_SPI_INTFL_SSD) != 0) && (evbSpiInfo.isArmed == 1))
+    {
+        SetHostPin(BOARD_CFG_HOST_RDY_PIN, 0);
+        evbSpiInfo.isArmed = 0;
+        /* A transaction cut short by the host leaves characters in the dma channels */
+        if ((MXC_DMA->ch[pSpiInfo->rxDmaDesc.channel].cnt != 0) || (pSpiInfo->txError == 1) ||
+            (pSpiInfo->rxError == 1))
+        {
+            MaxAbortSpiDMA(pSpiInfo);
+            SetHostPin(BOARD_CFG_HOST_ERR_PIN, 1);
+            aborted = 1;
+        }
+        EvbHostSpiIrqCallback(aborted);
+    }
+}
+
+void SpiTxDmaCallBack(int32_t channel, uint8_t error)
+{
+    MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.hostSpiInfo;
+
+    (void)channel;
+    pSpiInfo->txError |= error;
+    if (evbSpiInfo.pfHostSpiTxCallback != NULL)
+    {
+        evbSpiInfo.pfHostSpiTxCallback();
+    }
+}
+
+void SpiRxDmaCallBack(int32_t channel, uint8_t error)
+{
+    MAX_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.hostSpiInfo;
+
+    (void)channel;
+    pSpiInfo->rxError |= error;
+    if (evbSpiInfo.pfHostSpiRxCallback != NULL)
+    {
+        evbSpiInfo.pfHostSpiRxCallback();
+    }
+}
+
+/**
+ * @}
+ */
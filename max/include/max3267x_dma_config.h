@@ -23,6 +23,39 @@ extern "C" {
 #include <stdint.h>
 
 /*=============  D E F I N I T I O N S  =============*/
+/** Timeout and bus error bits of the channel status register */
+#define MAX_DMA_STATUS_ERROR_MASK (MXC_F_DMA_STATUS_BUS_ERR | MXC_F_DMA_STATUS_TO_IF)
+/** Interrupt flags of the channel status register, write 1 to clear */
+#define MAX_DMA_STATUS_FLAGS_MASK                                                                  \
+    (MXC_F_DMA_STATUS_CTZ_IF | MXC_F_DMA_STATUS_RLD_IF | MAX_DMA_STATUS_ERROR_MASK)
+/** Lowest arbitration priority, counted from 0, that may use the reserved channels */
+#define MAX_DMA_RESERVED_PRIORITY 1u
+/** Num of channels that only clients up to #MAX_DMA_RESERVED_PRIORITY can acquire */
+#define MAX_DMA_NUM_RESERVED_CHANNELS 2u
+
+/**
+ * @brief DMA channel event callback
+ * @param channel - DMA channel that raised the interrupt
+ * @param error - 1 if a bus error or timeout was flagged, 0 otherwise
+ */
+typedef void (*MAX_DMA_CALLBACK)(int32_t channel, uint8_t error);
+
+/** DMA channel usage info */
+typedef struct
+{
+    /** callback for channel events */
+    MAX_DMA_CALLBACK pfCallback;
+    /** num of interrupts dispatched */
+    uint32_t numEvents;
+    /** num of interrupts with a bus error or timeout */
+    uint32_t numErrors;
+    /** arbitration priority, 0 is the highest */
+    uint8_t priority;
+    /** 1 if the channel is acquired */
+    uint8_t isAcquired;
+
+} MAX_DMA_CHANNEL_INFO;
+
 /** DMA channel info */
 typedef struct
 {
@@ -40,6 +73,49 @@ typedef struct
 } MAX_DMA_DESC;
 
 /*======= P U B L I C   P R O T O T Y P E S ========*/
+/**
+ * @brief Acquires a free DMA channel and routes its interrupt to the callback.
+ * Channels are allocated by priority: a client whose priority value is above
+ * #MAX_DMA_RESERVED_PRIORITY only gets a channel while more than
+ * #MAX_DMA_NUM_RESERVED_CHANNELS are free, so the last channels stay available to the
+ * high priority streams. The arbitration priority is kept in the channel control register,
+ * so a channel with a higher priority is served first when several requests are pending.
+ * @param priority - arbitration priority, 0 (highest) to 3 (lowest)
+ * @param irqPriority - NVIC priority of the channel interrupt
+ * @param pfCallback - callback for completion and error events, may be NULL
+ * @return channel number or -1 if no channel is free
+ */
+int32_t MaxAcquireDMAChannel(uint32_t priority, uint32_t irqPriority, MAX_DMA_CALLBACK pfCallback);
+
+/**
+ * @brief Disables a channel and returns it to the free pool
+ * @param channel - DMA channel obtained from #MaxAcquireDMAChannel
+ */
+void MaxReleaseDMAChannel(int32_t channel);
+
+/**
+ * @brief Clears the interrupt flags of a channel
+ * @param channel - DMA channel
+ * @return 1 if a bus error or timeout was flagged, 0 otherwise
+ */
+uint8_t MaxClearDMAStatus(int32_t channel);
+
+/**
+ * @brief Gets the usage info of a channel
+ * @param channel - DMA channel
+ * @param pInfo - pointer to store the info
+ * @return 0 on success, -1 if the channel is out of range
+ */
+int32_t MaxGetDMAChannelInfo(int32_t channel, MAX_DMA_CHANNEL_INFO *pInfo);
+
+/**
+ * @brief Gets the arbitration priority saved when the channel was acquired.
+ * It is ORed into every write of the channel control register so the priority is kept.
+ * @param channel - DMA channel obtained from #MaxAcquireDMAChannel
+ * @return priority field of the channel control register
+ */
+uint32_t MaxGetDMAPriority(int32_t channel);
+
 /**
  * @brief Gets the IRQn for a DMA channel
  * @param channel - DMA channel
@@ -48,7 +124,7 @@ typedef struct
 IRQn_Type MaxGetDMAIRQn(int channel);
 
 /**
- * @brief Enables dma channel
+ * @brief Enables dma channel, the arbitration priority of the channel is kept
  * @param pDesc - pointer to dma channel info struct
  */
 void MaxEnableDMAChannel(MAX_DMA_DESC *pDesc);
@@ -37,6 +37,14 @@ typedef struct
     mxc_spi_regs_t *pSpi;
     /** spi speed */
     uint32_t spiSpeed;
+    /** character size in bits */
+    uint32_t dataSize;
+    /** characters moved per dma request */
+    uint32_t dmaBurst;
+    /** dma width and burst size bits of the channel ctrl register */
+    uint32_t dmaCtrl;
+    /** changed by every configuration that prepared transactions depend on */
+    uint32_t configId;
     /** no of slaves */
     uint8_t numSlaves;
     /** master or slave mode */
@@ -58,6 +66,27 @@ typedef struct
 
 } MAX_SPI_INSTANCE;
 
+/**
+ * @brief Prepared spi dma transaction. Register values are computed once by
+ * #MaxPrepareSpiTxRxDMA so that #MaxStartSpiXfer only writes them.
+ */
+typedef struct
+{
+    /** rx dma channel */
+    MAX_DMA_DESC rxDmaDesc;
+    /** tx dma channel */
+    MAX_DMA_DESC txDmaDesc;
+    /** spi ctrl0 with slave select set and start cleared */
+    uint32_t spiCtrl0;
+    /** spi ctrl1 with the number of characters */
+    uint32_t spiCtrl1;
+    /** spi dma register with dma requests disabled */
+    uint32_t spiDma;
+    /** configId of the spi when the transaction was prepared */
+    uint32_t configId;
+
+} MAX_SPI_XFER;
+
 /*======= P U B L I C   P R O T O T Y P E S ========*/
 /**
  * @brief Initialses Master SPI
@@ -92,6 +121,40 @@ int32_t MaxStartSpiRxDMA(MAX_SPI_INSTANCE *pSpiInfo, uint8_t *pData, uint32_t nu
  */
 int32_t MaxSetSpiFrequency(MAX_SPI_INSTANCE *pSpiInfo, uint32_t spiFrequency);
 
+/**
+ * @brief SPI Set character size and DMA packet size
+ * @param[in]  pSpiInfo  - pointer to the spi info
+ * @param[in]  dataSize  - character size in bits (1 to 16)
+ * @param[in]  burstLength  - characters moved per DMA request
+ * Characters wider than 8 bits occupy 2 bytes in memory. The DMA width is the widest
+ * beat that divides the packet. Transfers whose length is not a multiple of the packet
+ * size are rejected.
+ * @return  error or success
+ */
+int32_t MaxSetSpiDataSize(MAX_SPI_INSTANCE *pSpiInfo, uint32_t dataSize, uint32_t burstLength);
+
+/**
+ * @brief Checks a transfer length against the DMA packet size
+ * @param[in]  pSpiInfo  - pointer to the spi info
+ * @param[in]  numBytes  - num of bytes of the transfer
+ * @return  0 if the length is a non zero multiple of the packet size, error otherwise
+ */
+int32_t MaxCheckSpiLength(MAX_SPI_INSTANCE *pSpiInfo, uint32_t numBytes);
+
+/**
+ * @brief Keeps slave select asserted at the end of a transaction
+ * @param[in]  pSpiInfo  - pointer to the spi info
+ * @param[in]  hold  - 1 to keep slave select asserted, 0 to release it at the end
+ */
+void MaxSetSpiSlaveSelectHold(MAX_SPI_INSTANCE *pSpiInfo, uint8_t hold);
+
+/**
+ * @brief Stops the dma channels of the spi and flushes the fifos.
+ * No dma interrupt is raised for the stopped transaction.
+ * @param[in]  pSpiInfo  - pointer to the spi info
+ */
+void MaxAbortSpiDMA(MAX_SPI_INSTANCE *pSpiInfo);
+
 /**
  * @brief SPI clear interrupt
  * @param[in]  pSpiInfo  - pointer to the spi info
@@ -134,6 +197,30 @@ int32_t MaxSlaveStartSpiRxDMA(MAX_SPI_INSTANCE *pSpiInfo, uint8_t *pData, uint32
 int32_t MaxStartSpiTxRxDMA(MAX_SPI_INSTANCE *pSpiInfo, uint8_t *pTxData, uint8_t *pRxData,
                            uint32_t numBytes);
 
+/**
+ * @brief Prepares a SPI Master Tx Rx transaction for repeated use
+ * @param[in]  pSpiInfo  - pointer to the spi info
+ * @param[out] pXfer  - pointer to the transaction to prepare
+ * @param[in]  pTxData  - pointer to Tx data
+ * @param[in]  pRxData  - pointer to Rx data
+ * @param[in]  numBytes  - num of bytes to send
+ * The transaction copies the frame size, DMA burst and slave select configuration. It is
+ * invalidated by #MaxSetSpiDataSize and #MaxSetSpiFrequency and must be prepared again.
+ * @return  error or success
+ */
+int32_t MaxPrepareSpiTxRxDMA(MAX_SPI_INSTANCE *pSpiInfo, MAX_SPI_XFER *pXfer, uint8_t *pTxData,
+                             uint8_t *pRxData, uint32_t numBytes);
+
+/**
+ * @brief Starts a transaction prepared with #MaxPrepareSpiTxRxDMA.
+ * Status flags left by the previous transaction are cleared before the start.
+ * @param[in]  pSpiInfo  - pointer to the spi info
+ * @param[in]  pXfer  - pointer to the prepared transaction
+ * @return  error if the transaction was invalidated by a configuration change or a
+ * transaction is still in progress, success otherwise
+ */
+int32_t MaxStartSpiXfer(MAX_SPI_INSTANCE *pSpiInfo, MAX_SPI_XFER *pXfer);
+
 #ifdef __cplusplus
 }
 #endif
@@ -17,6 +17,7 @@ extern "C" {
 #endif
 
 /*============= I N C L U D E S =============*/
+#include "adi_evb_timer.h"
 #include "tmr.h"
 #include <stdint.h>
 
@@ -28,16 +29,46 @@ extern "C" {
 int32_t MaxTimerInit(mxc_tmr_regs_t *pTmr);
 
 /**
- * @brief Gets Timer valu
+ * @brief Gets Timer value in us
  * @param[in]  pTmr  - pointer to timer registers
- * @return  error or success
+ * @return  time in us
  */
 uint32_t MaxGetTime(mxc_tmr_regs_t *pTmr);
 
 /**
- * @brief Gets Maximum Timer value
+ * @brief Initialses the timer of the 1 ms software timer tick
+ * @param[in]  pTmr  - pointer to timer registers
  * @return  error or success
  */
+int32_t MaxTickTimerInit(mxc_tmr_regs_t *pTmr);
+
+/**
+ * @brief Starts the software timer tick
+ */
+void MaxStartTickTimer(void);
+
+/**
+ * @brief Stops the software timer tick
+ */
+void MaxStopTickTimer(void);
+
+/**
+ * @brief Gets Timer value in ticks, extended with the counted overflows
+ * @param[in]  pTmr  - pointer to timer registers
+ * @return  ticks since the timer was started
+ */
+uint64_t MaxGetTime64(mxc_tmr_regs_t *pTmr);
+
+/**
+ * @brief Gets the tick rate of the timer
+ * @return  frequency in Hz
+ */
+uint32_t MaxGetTimerFrequency(void);
+
+/**
+ * @brief Gets Maximum Timer value
+ * @return  largest value of #MaxGetTime
+ */
 uint32_t MaxGetMaximumTime();
 
 /**
@@ -52,6 +83,30 @@ void MaxStartTimer(mxc_tmr_regs_t *pTmr);
  */
 void MaxStopTimer(mxc_tmr_regs_t *pTmr);
 
+/**
+ * @brief Starts counting the falling edges on the input pin of a timer
+ * @param[in]  pTmr        - pointer to timer registers
+ * @param[in]  idx         - pulse input index
+ * @param[in]  threshold   - num of pulses between interrupts
+ * @param[in]  pfCallback  - called every threshold pulses
+ * @return  error or success
+ */
+int32_t MaxStartPulseCount(mxc_tmr_regs_t *pTmr, uint32_t idx, uint32_t threshold,
+                           ADI_EVB_PULSE_CALLBACK pfCallback);
+
+/**
+ * @brief Stops a pulse counter
+ * @param[in]  idx  - pulse input index
+ */
+void MaxStopPulseCount(uint32_t idx);
+
+/**
+ * @brief Gets the num of pulses counted since the start
+ * @param[in]  idx  - pulse input index
+ * @return  num of pulses
+ */
+uint32_t MaxGetPulseCount(uint32_t idx);
+
 #ifdef __cplusplus
 }
 #endif
@@ -39,18 +39,22 @@ typedef struct
     uint8_t dmaError;
     /** variable to check status of CRC transaction*/
     volatile bool isComplete;
+    /** set while a calculation is in progress */
+    volatile uint8_t isBusy;
     /** CRC output */
     volatile uint32_t crc;
     /** crc request struct */
     mxc_crc_req_t crcReq;
-    /** Seed value */
+    /** Seed value, aligned as the CRC register expects it */
     uint32_t seed;
-    /** big endian flag */
-    bool isBigEndian;
-    /** CRC type */
-    uint8_t crcType;
-    /** isReversed flag */
-    uint8_t isReversed;
+    /** CRC width in bits */
+    uint32_t numBits;
+    /** 1 when input bytes are reflected, the unit then runs LSB first */
+    uint8_t reflectIn;
+    /** 1 when the CRC is reflected before the final XOR */
+    uint8_t reflectOut;
+    /** Value XORed with the CRC at the end */
+    uint32_t finalXor;
 } EVB_CRC_INFO;
 
 /*=============  D A T A  =============*/
@@ -61,59 +65,89 @@ static EVB_CRC_INFO evbCrcInfo;
 
 static int32_t ConfigCrcDma(mxc_crc_reva_req_t *pReq);
 
-static int32_t SetupCrcDma(uint8_t dmaChannel);
+static void CrcDmaCallBack(int32_t channel, uint8_t error);
 
-static void CrcDmaIrqHandler(void);
+static uint32_t FormatSeed(uint32_t seed);
 
-static void CrcDmaCallBack(int ch, int error);
+static uint32_t FormatPolynomial(uint32_t polynomial);
 
-static int32_t FormatSeed(uint8_t crcType, uint8_t isBigEndian, uint32_t seed);
+static int32_t FormatResult(volatile uint32_t *pData);
 
-static int32_t FormatResult(uint8_t crcType, uint8_t isBigEndian, volatile uint32_t *pData);
-
-/**
- * Enums of CRC type.
- */
-typedef enum
-{
-    /** CRC-8. */
-    ADI_CRC_TYPE_CRC8 = 0u,
-    /** CRC-16. */
-    ADI_CRC_TYPE_CRC16,
-    /** CRC-32. */
-    ADI_CRC_TYPE_CRC32,
-
-} ADI_CRC_TYPE;
+static uint32_t ReflectBits(uint32_t value, uint32_t numBits);
 
 /*=============  C O D E  =============*/
 
 int32_t EvbInitCrc(void **phCrc, ADI_EVB_CRC_CONFIG *pConfig)
 {
     int32_t status = 0;
+    int32_t channel;
     uint32_t crcBuff = 0x00;
-    evbCrcInfo.isBigEndian = 1;
-    uint32_t polynomial = 0x1021;
-    evbCrcInfo.crcType = ADI_CRC_TYPE_CRC16;
-    evbCrcInfo.seed = 0xFFFF;
-    evbCrcInfo.dmaChannel = (uint8_t)MXC_DMA_AcquireChannel();
-    status = SetupCrcDma(evbCrcInfo.dmaChannel);
-    MXC_CRC_Init();
-    status = FormatSeed(evbCrcInfo.crcType, evbCrcInfo.isBigEndian, evbCrcInfo.seed);
+    ADI_EVB_CRC_PARAMS params = {ADI_EVB_CRC_TYPE_CRC16, 0x1021, 0xFFFF, 0, 0, 0};
     evbCrcInfo.pfCallback = pConfig->pfCallback;
+    channel = MaxAcquireDMAChannel(BOARD_CFG_CRC_DMA_PRIORITY, APP_CFG_CRC_DMA_INT_PRIORITY,
+                                   CrcDmaCallBack);
+    if (channel < 0)
+    {
+        status = ADI_EVB_STATUS_DMA_CHANNEL_ACQUIRE_ERROR;
+    }
+    else
+    {
+        evbCrcInfo.dmaChannel = (uint8_t)channel;
+        MXC_CRC_Init();
+        *phCrc = &evbCrcInfo;
+        status = EvbCrcConfigure(&evbCrcInfo, &params);
+    }
     if (status == 0)
     {
-        MXC_CRC->ctrl |= (uint32_t)((evbCrcInfo.isReversed << 3) | (evbCrcInfo.isBigEndian << 2));
-        // Load CRC polynomial into crc polynomial register
-        MXC_CRC_SetPoly(polynomial << 16);
         evbCrcInfo.crcReq.dataBuffer = &crcBuff;
         evbCrcInfo.crcReq.dataLen = 1;
         // Initialises the DMA and CRC. Refer section 15.5 of MAX32670 user
         // guide.
         status = ConfigCrcDma((mxc_crc_reva_req_t *)&evbCrcInfo.crcReq);
     }
-    else
+
+    return status;
+}
+
+int32_t EvbCrcConfigure(void *hEvb, ADI_EVB_CRC_PARAMS *pParams)
+{
+    int32_t status = -1;
+    uint32_t numBits = 0;
+
+    if ((hEvb != NULL) && (pParams != NULL) && (evbCrcInfo.isBusy == 0))
     {
-        status = -1;
+        if (pParams->crcType == ADI_EVB_CRC_TYPE_CRC8)
+        {
+            numBits = 8;
+        }
+        else if (pParams->crcType == ADI_EVB_CRC_TYPE_CRC16)
+        {
+            numBits = 16;
+        }
+        else if (pParams->crcType == ADI_EVB_CRC_TYPE_CRC32)
+        {
+            numBits = 32;
+        }
+    }
+    if (numBits != 0)
+    {
+        evbCrcInfo.numBits = numBits;
+        evbCrcInfo.reflectIn = pParams->reflectIn;
+        evbCrcInfo.reflectOut = pParams->reflectOut;
+        evbCrcInfo.finalXor = pParams->finalXor;
+        evbCrcInfo.seed = FormatSeed(pParams->seed);
+        // MSB first for the normal algorithms, LSB first for the reflected ones
+        if (pParams->reflectIn == 1)
+        {
+            MXC_CRC->ctrl &= ~(MXC_F_CRC_CTRL_MSB | MXC_F_CRC_CTRL_BYTE_SWAP_IN);
+        }
+        else
+        {
+            MXC_CRC->ctrl = (MXC_CRC->ctrl & ~MXC_F_CRC_CTRL_BYTE_SWAP_IN) | MXC_F_CRC_CTRL_MSB;
+        }
+        // Load CRC polynomial into crc polynomial register
+        MXC_CRC_SetPoly(FormatPolynomial(pParams->polynomial));
+        status = 0;
     }
 
     return status;
@@ -121,87 +155,112 @@ int32_t EvbInitCrc(void **phCrc, ADI_EVB_CRC_CONFIG *pConfig)
 
 int32_t EvbCrcCalculate(void *hEvb, uint8_t *pData, uint32_t numBytes)
 {
-    (void)hEvb; /* Dummy use of argument */
-    evbCrcInfo.isComplete = false;
-    /* 0x5C is the mask for status register */
-    MXC_DMA->ch[evbCrcInfo.dmaChannel].status |= 0x5C;
-    MXC_CRC->ctrl |= MXC_F_CRC_CTRL_EN;
-    MXC_CRC->val = evbCrcInfo.seed;
-    /* Set start address and initiate DMA*/
-    MXC_DMA->ch[evbCrcInfo.dmaChannel].src = (unsigned int)pData;
-    MXC_DMA->ch[evbCrcInfo.dmaChannel].cnt = numBytes;
-    MXC_DMA->ch[evbCrcInfo.dmaChannel].ctrl |= (MXC_F_DMA_CTRL_EN | MXC_F_DMA_CTRL_CTZ_IE);
-    return 0;
+    int32_t status;
+
+    status = EvbCrcStart(hEvb);
+    if (status == 0)
+    {
+        status = EvbCrcAccumulate(hEvb, pData, numBytes);
+    }
+    return status;
 }
 
-int32_t EvbCrcGetValue(void *hEvb, uint32_t *pData)
+int32_t EvbCrcStart(void *hEvb)
 {
-    int32_t status = 0;
-    (void)hEvb; /* Dummy use of argument */
-    if (evbCrcInfo.dmaError == 1)
+    int32_t status = -1;
+    if ((hEvb != NULL) && (evbCrcInfo.isBusy == 0))
     {
-        status = -1;
+        evbCrcInfo.crc = evbCrcInfo.seed;
         evbCrcInfo.dmaError = 0;
+        evbCrcInfo.isComplete = true;
+        status = 0;
     }
-    else if (evbCrcInfo.isComplete == true)
-    {
-        *pData = evbCrcInfo.crc;
-        status = FormatResult(evbCrcInfo.crcType, evbCrcInfo.isBigEndian, pData);
-    }
-    else
+    return status;
+}
+
+int32_t EvbCrcAccumulate(void *hEvb, uint8_t *pData, uint32_t numBytes)
+{
+    int32_t status = -1;
+    if ((hEvb != NULL) && (pData != NULL) && (numBytes > 0) && (evbCrcInfo.isBusy == 0))
     {
-        *pData = 0xFFFFFFFF;
-        status = -1;
+        evbCrcInfo.isComplete = false;
+        evbCrcInfo.isBusy = 1;
+        MaxClearDMAStatus(evbCrcInfo.dmaChannel);
+        MXC_CRC->ctrl |= MXC_F_CRC_CTRL_EN;
+        /* Resume from the value left by the previous chunk */
+        MXC_CRC->val = evbCrcInfo.crc;
+        /* Set start address and initiate DMA*/
+        MXC_DMA->ch[evbCrcInfo.dmaChannel].src = (unsigned int)pData;
+        MXC_DMA->ch[evbCrcInfo.dmaChannel].cnt = numBytes;
+        MXC_DMA->ch[evbCrcInfo.dmaChannel].ctrl |= (MXC_F_DMA_CTRL_EN | MXC_F_DMA_CTRL_CTZ_IE);
+        status = 0;
     }
     return status;
 }
 
-static int32_t SetupCrcDma(uint8_t dmaChannel)
+int32_t EvbCrcSaveState(void *hEvb, uint32_t *pState)
 {
-    int32_t status = 0;
-    IRQn_Type dmaChannelIRQn;
-
-    dmaChannelIRQn = MaxGetDMAIRQn(dmaChannel);
-    if (dmaChannelIRQn != MXC_IRQ_EXT_COUNT)
+    int32_t status = -1;
+    if ((hEvb != NULL) && (pState != NULL) && (evbCrcInfo.isBusy == 0))
     {
-        NVIC_SetPriority(dmaChannelIRQn, APP_CFG_CRC_DMA_INT_PRIORITY);
-        NVIC_SetVector(dmaChannelIRQn, (uint32_t)CrcDmaIrqHandler);
-        NVIC_EnableIRQ(dmaChannelIRQn);
+        *pState = evbCrcInfo.crc;
+        status = 0;
     }
-    else
+    return status;
+}
+
+int32_t EvbCrcRestoreState(void *hEvb, uint32_t state)
+{
+    int32_t status = -1;
+    if ((hEvb != NULL) && (evbCrcInfo.isBusy == 0))
     {
-        /* Acquired DMA Channel is not in the range of 0 to 8*/
-        status = -1;
+        /* Loaded into the unit by the next EvbCrcAccumulate */
+        evbCrcInfo.crc = state;
+        evbCrcInfo.dmaError = 0;
+        evbCrcInfo.isComplete = true;
+        status = 0;
     }
     return status;
 }
 
-static void CrcDmaIrqHandler(void)
+int32_t EvbCrcGetValue(void *hEvb, uint32_t *pData)
 {
+    return EvbCrcFinalise(hEvb, pData);
+}
 
-    /* 0x50 is the mask for timeout and Bus Error bits */
-    if (MXC_DMA->ch[evbCrcInfo.dmaChannel].status & 0x50)
+int32_t EvbCrcFinalise(void *hEvb, uint32_t *pData)
+{
+    int32_t status = 0;
+    (void)hEvb; /* Dummy use of argument */
+    if (evbCrcInfo.dmaError == 1)
+    {
+        status = -1;
+        evbCrcInfo.dmaError = 0;
+    }
+    else if (evbCrcInfo.isComplete == true)
     {
-        evbCrcInfo.dmaError = true;
+        *pData = evbCrcInfo.crc;
+        status = FormatResult(pData);
+    }
+    else
+    {
+        *pData = 0xFFFFFFFF;
+        status = -1;
     }
-    /* 0x5C is the mask for status register */
-    MXC_DMA->ch[evbCrcInfo.dmaChannel].status |= 0x5C;
-    CrcDmaCallBack(evbCrcInfo.dmaChannel, 0);
+    return status;
 }
 
 void EvbCrcReset(void)
 {
 
     MXC_CRC->ctrl &= ~MXC_F_CRC_CTRL_EN;
-    /* 0x5C is the mask for status register */
-    MXC_DMA->ch[evbCrcInfo.dmaChannel].status |= 0x5C;
+    MaxClearDMAStatus(evbCrcInfo.dmaChannel);
 }
 
 void EvbCrcClearInterrupt(void)
 {
     MXC_CRC->ctrl &= ~MXC_F_CRC_CTRL_EN;
-    /* 0x5C is the mask for status register */
-    MXC_DMA->ch[evbCrcInfo.dmaChannel].status |= 0x5C;
+    MaxClearDMAStatus(evbCrcInfo.dmaChannel);
 }
 
 static int32_t ConfigCrcDma(mxc_crc_reva_req_t *pReq)
@@ -234,82 +293,108 @@ static int32_t ConfigCrcDma(mxc_crc_reva_req_t *pReq)
     return status;
 }
 
-static void CrcDmaCallBack(int ch, int error)
+static void CrcDmaCallBack(int32_t channel, uint8_t error)
 {
     int32_t waitCount = 0;
     int32_t timeOutCount = APP_CFG_CRC_TIMEOUT_COUNT;
+    evbCrcInfo.dmaError |= error;
     while (((MXC_CRC->ctrl >> MXC_F_CRC_CTRL_BUSY_POS) & 1) && (waitCount < timeOutCount))
     {
         // Wait for the crc computation to complete
         waitCount++;
     }
-    if ((error == E_NO_ERROR) && (ch == evbCrcInfo.dmaChannel) && (waitCount < timeOutCount))
+    if ((error == 0) && (channel == evbCrcInfo.dmaChannel) && (waitCount < timeOutCount))
     {
         evbCrcInfo.crc = MXC_CRC->val;
     }
     MXC_CRC->ctrl &= ~MXC_F_CRC_CTRL_EN;
+    evbCrcInfo.isBusy = 0;
     evbCrcInfo.isComplete = true;
-    if (evbCrcInfo.pfCallback != NULL)
+    /* Queued jobs have their own callbacks */
+    if ((EvbCrcJobIrqCallback(evbCrcInfo.dmaError) == 0) && (evbCrcInfo.pfCallback != NULL))
     {
         evbCrcInfo.pfCallback();
     }
 }
 
-static int32_t FormatSeed(uint8_t crcType, uint8_t isBigEndian, uint32_t seed)
+static uint32_t FormatSeed(uint32_t seed)
 {
+    uint32_t regSeed;
+    uint32_t numBits = evbCrcInfo.numBits;
 
-    int32_t status = 0;
-
-    // Format the initial value.
-    if ((crcType == ADI_CRC_TYPE_CRC8) && (isBigEndian == true))
+    // The LSB first register holds the reflected value in the low bits, the MSB first
+    // register holds the value in the high bits
+    if (evbCrcInfo.reflectIn == 1)
     {
-        evbCrcInfo.seed = (uint32_t)(seed << 24);
+        regSeed = ReflectBits(seed, numBits);
     }
-    else if ((crcType == ADI_CRC_TYPE_CRC16) && (isBigEndian == true))
+    else
     {
-        evbCrcInfo.seed = (uint32_t)(seed << 16);
+        regSeed = seed << (32 - numBits);
     }
-    else if ((crcType == ADI_CRC_TYPE_CRC32) && (isBigEndian == true))
+
+    return regSeed;
+}
+
+static uint32_t FormatPolynomial(uint32_t polynomial)
+{
+    uint32_t regPoly;
+    uint32_t numBits = evbCrcInfo.numBits;
+
+    if (evbCrcInfo.reflectIn == 1)
     {
-        // No change to initial value
-        evbCrcInfo.seed = (uint32_t)(seed);
+        regPoly = ReflectBits(polynomial, numBits);
     }
     else
     {
-        // Other case needs to considered in future.
-        status = -1;
+        regPoly = polynomial << (32 - numBits);
     }
 
-    return status;
+    return regPoly;
 }
 
-static int32_t FormatResult(uint8_t crcType, uint8_t isBigEndian, volatile uint32_t *pData)
+static int32_t FormatResult(volatile uint32_t *pData)
 {
     int32_t status = 0;
+    uint32_t numBits = evbCrcInfo.numBits;
+    uint32_t mask = 0xFFFFFFFFu >> (32 - numBits);
+    uint32_t result = *pData;
 
-    // Format the CRC result.
-    if ((crcType == ADI_CRC_TYPE_CRC8) && (isBigEndian == true))
+    if (evbCrcInfo.reflectIn == 1)
     {
-        *pData = (uint32_t)(*pData >> 24);
-    }
-    else if ((crcType == ADI_CRC_TYPE_CRC16) && (isBigEndian == true))
-    {
-        *pData = (uint32_t)(*pData >> 16);
-    }
-    else if ((crcType == ADI_CRC_TYPE_CRC32) && (isBigEndian == true))
-    {
-        // No change to initial value
-        *pData = (uint32_t)*pData;
+        // LSB first register already holds the reflected CRC
+        result &= mask;
+        if (evbCrcInfo.reflectOut == 0)
+        {
+            result = ReflectBits(result, numBits);
+        }
     }
     else
     {
-        // Other case needs to considered in future.
-        status = -1;
+        result = result >> (32 - numBits);
+        if (evbCrcInfo.reflectOut == 1)
+        {
+            result = ReflectBits(result, numBits);
+        }
     }
+    *pData = (result ^ evbCrcInfo.finalXor) & mask;
 
     return status;
 }
 
+static uint32_t ReflectBits(uint32_t value, uint32_t numBits)
+{
+    uint32_t reflected = 0;
+    uint32_t i;
+
+    for (i = 0; i < numBits; i++)
+    {
+        reflected = (reflected << 1) | ((value >> i) & 1u);
+    }
+
+    return reflected;
+}
+
 /**
  * @}
  */
@@ -12,17 +12,130 @@
 /*=============  I N C L U D E S   =============*/
 #include "max3267x_dma_config.h"
 #include "mxc_device.h"
+#include "nvic_table.h"
 #include <stdint.h>
+#include <string.h>
 /*=============  D A T A  =============*/
+/** Usage info of all channels, indexed by channel */
+static MAX_DMA_CHANNEL_INFO dmaChannelInfo[MXC_DMA_CHANNELS];
+/** Channel of each DMA interrupt, indexed by IRQn - DMA0_IRQn. Filled when a channel is
+ * acquired, only the IRQs of acquired channels are routed to the handler */
+static uint8_t dmaIrqChannel[MXC_IRQ_EXT_COUNT - DMA0_IRQn];
+/** IRQn of each channel, the DMA IRQ numbers are not contiguous on all devices */
+static const IRQn_Type dmaChannelIrqn[MXC_DMA_CHANNELS] = {
+    DMA0_IRQn, DMA1_IRQn, DMA2_IRQn, DMA3_IRQn, DMA4_IRQn, DMA5_IRQn, DMA6_IRQn, DMA7_IRQn};
 
 /*=============  D E F I N I T I O N S  =============*/
+/** Common handler of all DMA channel interrupts */
+static void DmaIrqHandler(void);
+/** Num of channels not acquired */
+static uint32_t GetNumFreeChannels(void);
 
 /*=============  C O D E  =============*/
 
+int32_t MaxAcquireDMAChannel(uint32_t priority, uint32_t irqPriority, MAX_DMA_CALLBACK pfCallback)
+{
+    int32_t channel = -1;
+    IRQn_Type irqn;
+
+    /* Lower priority clients leave the reserved channels to the higher priority ones */
+    if ((priority <= MAX_DMA_RESERVED_PRIORITY) ||
+        (GetNumFreeChannels() > MAX_DMA_NUM_RESERVED_CHANNELS))
+    {
+        channel = MXC_DMA_AcquireChannel();
+    }
+    if ((channel >= 0) && (channel < MXC_DMA_CHANNELS))
+    {
+        irqn = MaxGetDMAIRQn(channel);
+        memset(&dmaChannelInfo[channel], 0, sizeof(MAX_DMA_CHANNEL_INFO));
+        dmaChannelInfo[channel].pfCallback = pfCallback;
+        dmaChannelInfo[channel].priority = (uint8_t)priority;
+        dmaChannelInfo[channel].isAcquired = 1;
+        dmaIrqChannel[irqn - DMA0_IRQn] = (uint8_t)channel;
+        MXC_DMA->ch[channel].ctrl = MaxGetDMAPriority(channel);
+        MaxClearDMAStatus(channel);
+        MXC_DMA->inten |= (1u << channel);
+        NVIC_SetVector(irqn, (uint32_t)DmaIrqHandler);
+        NVIC_SetPriority(irqn, irqPriority);
+        NVIC_EnableIRQ(irqn);
+    }
+    else
+    {
+        channel = -1;
+    }
+
+    return channel;
+}
+
+void MaxReleaseDMAChannel(int32_t channel)
+{
+    if ((channel >= 0) && (channel < MXC_DMA_CHANNELS))
+    {
+        NVIC_DisableIRQ(MaxGetDMAIRQn(channel));
+        MXC_DMA->inten &= ~(1u << channel);
+        MXC_DMA->ch[channel].ctrl = 0;
+        MaxClearDMAStatus(channel);
+        dmaChannelInfo[channel].isAcquired = 0;
+        dmaChannelInfo[channel].pfCallback = NULL;
+        MXC_DMA_ReleaseChannel(channel);
+    }
+}
+
+uint8_t MaxClearDMAStatus(int32_t channel)
+{
+    uint8_t error = 0;
+    if ((MXC_DMA->ch[channel].status & MAX_DMA_STATUS_ERROR_MASK) != 0)
+    {
+        error = 1;
+    }
+    MXC_DMA->ch[channel].status = MAX_DMA_STATUS_FLAGS_MASK;
+
+    return error;
+}
+
+int32_t MaxGetDMAChannelInfo(int32_t channel, MAX_DMA_CHANNEL_INFO *pInfo)
+{
+    int32_t status = -1;
+    if ((channel >= 0) && (channel < MXC_DMA_CHANNELS) && (pInfo != NULL))
+    {
+        *pInfo = dmaChannelInfo[channel];
+        status = 0;
+    }
+
+    return status;
+}
+
+uint32_t MaxGetDMAPriority(int32_t channel)
+{
+    return ((uint32_t)dmaChannelInfo[channel].priority << MXC_F_DMA_CTRL_PRI_POS) &
+           MXC_F_DMA_CTRL_PRI;
+}
+
+void DmaIrqHandler(void)
+{
+    int32_t channel;
+    uint8_t error;
+    /* Exception number of the active interrupt, external interrupts start at 16 */
+    int32_t irqn = (int32_t)(__get_IPSR() & 0x1FFu) - 16;
+
+    if ((irqn >= (int32_t)DMA0_IRQn) && (irqn < (int32_t)MXC_IRQ_EXT_COUNT))
+    {
+        channel = (int32_t)dmaIrqChannel[irqn - (int32_t)DMA0_IRQn];
+        /* Flags are cleared before the callback so that it can restart the channel */
+        error = MaxClearDMAStatus(channel);
+        dmaChannelInfo[channel].numEvents++;
+        dmaChannelInfo[channel].numErrors += error;
+        if (dmaChannelInfo[channel].pfCallback != NULL)
+        {
+            dmaChannelInfo[channel].pfCallback(channel, error);
+        }
+    }
+}
+
 void MaxEnableDMAChannel(MAX_DMA_DESC *pDesc)
 {
     MXC_DMA->ch[pDesc->channel].ctrl &= ~(MXC_F_DMA_CTRL_EN | MXC_F_DMA_CTRL_CTZ_IE);
-    MXC_DMA->ch[pDesc->channel].ctrl = pDesc->ctrl;
+    MXC_DMA->ch[pDesc->channel].ctrl = pDesc->ctrl | MaxGetDMAPriority(pDesc->channel);
     /* We are good assigning both as src is ignored for Rx channel
          and dst is ignored for Tx channel */
     MXC_DMA->ch[pDesc->channel].src = (unsigned int)(pDesc->pMem);
@@ -33,40 +146,30 @@ void MaxEnableDMAChannel(MAX_DMA_DESC *pDesc)
 
 IRQn_Type MaxGetDMAIRQn(int channel)
 {
-    IRQn_Type irqN;
-    switch (channel)
+    IRQn_Type irqN = MXC_IRQ_EXT_COUNT;
+    if ((channel >= 0) && (channel < MXC_DMA_CHANNELS))
     {
-    case 0:
-        irqN = DMA0_IRQn;
-        break;
-    case 1:
-        irqN = DMA1_IRQn;
-        break;
-    case 2:
-        irqN = DMA2_IRQn;
-        break;
-    case 3:
-        irqN = DMA3_IRQn;
-        break;
-    case 4:
-        irqN = DMA4_IRQn;
-        break;
-    case 5:
-        irqN = DMA5_IRQn;
-        break;
-    case 6:
-        irqN = DMA6_IRQn;
-        break;
-    case 7:
-        irqN = DMA7_IRQn;
-        break;
-    default:
-        irqN = MXC_IRQ_EXT_COUNT;
-        break;
+        irqN = dmaChannelIrqn[channel];
     }
     return irqN;
 }
 
+uint32_t GetNumFreeChannels(void)
+{
+    uint32_t numFree = 0;
+    int32_t channel;
+
+    for (channel = 0; channel < MXC_DMA_CHANNELS; channel++)
+    {
+        if (dmaChannelInfo[channel].isAcquired == 0)
+        {
+            numFree++;
+        }
+    }
+
+    return numFree;
+}
+
 mxc_dma_reqsel_t MaxGetSpiDMAReqSelRx(mxc_spi_regs_t *pSpi)
 {
     int32_t spiNum;
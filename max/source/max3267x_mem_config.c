@@ -0,0 +1,168 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     max3267x_mem_config.c
+ * @brief    Memory to memory DMA copy and fill for MAX32670
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+
+#include "adi_evb.h"
+#include "app_cfg.h"
+#include "dma.h"
+#include "max32670.h"
+#include "max3267x_dma_config.h"
+#include <stdint.h>
+#include <string.h>
+
+#if APP_CFG_ENABLE_MEM_DMA == 1
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Largest count of a single DMA transfer */
+#define MAX_MEM_DMA_MAX_COUNT 0xFFFFFFu
+/** Burst size of the memory transfers in bytes */
+#define MAX_MEM_DMA_BURST_SIZE 32u
+
+/** Evb mem info */
+typedef struct
+{
+    /** callback */
+    ADI_EVB_MEM_CALLBACK pfCallback;
+    /** dma channel reserved for memory transfers */
+    int32_t dmaChannel;
+    /** fill word for memset, source of the fixed address transfer */
+    uint32_t fillWord;
+    /** 0 when complete, 1 while in progress, -1 on error */
+    volatile int32_t state;
+} EVB_MEM_INFO;
+
+/*=============  D A T A  =============*/
+
+/** Evb mem info */
+static EVB_MEM_INFO evbMemInfo = {.dmaChannel = -1};
+
+/*============= F U N C T I O N S =============*/
+
+/** Starts a memory transfer */
+static int32_t StartMemDma(const void *pSrc, void *pDst, uint32_t numBytes, uint32_t srcInc,
+                           ADI_EVB_MEM_CALLBACK pfCallback);
+/** Dma callback */
+static void MemDmaCallBack(int32_t channel, uint8_t error);
+
+int32_t EvbInitMem(void)
+{
+    int32_t status = 0;
+    int32_t channel;
+
+    channel = MaxAcquireDMAChannel(BOARD_CFG_MEM_DMA_PRIORITY, APP_CFG_MEM_DMA_INT_PRIORITY,
+                                   MemDmaCallBack);
+    if (channel < 0)
+    {
+        status = ADI_EVB_STATUS_DMA_CHANNEL_ACQUIRE_ERROR;
+    }
+    else
+    {
+        evbMemInfo.dmaChannel = channel;
+        evbMemInfo.state = 0;
+    }
+
+    return status;
+}
+
+int32_t EvbMemcpyAsync(void *hEvb, void *pDst, const void *pSrc, uint32_t numBytes,
+                       ADI_EVB_MEM_CALLBACK pfCallback)
+{
+    int32_t status = -1;
+    if ((hEvb != NULL) && (pDst != NULL) && (pSrc != NULL))
+    {
+        status = StartMemDma(pSrc, pDst, numBytes, MXC_F_DMA_CTRL_SRCINC, pfCallback);
+    }
+
+    return status;
+}
+
+int32_t EvbMemsetAsync(void *hEvb, void *pDst, uint8_t value, uint32_t numBytes,
+                       ADI_EVB_MEM_CALLBACK pfCallback)
+{
+    int32_t status = -1;
+    if ((hEvb != NULL) && (pDst != NULL) && (evbMemInfo.state != 1))
+    {
+        evbMemInfo.fillWord = (uint32_t)value * 0x01010101u;
+        status = StartMemDma(&evbMemInfo.fillWord, pDst, numBytes, 0, pfCallback);
+    }
+
+    return status;
+}
+
+int32_t EvbMemGetStatus(void *hEvb)
+{
+    int32_t status = -1;
+    if (hEvb != NULL)
+    {
+        status = evbMemInfo.state;
+    }
+
+    return status;
+}
+
+int32_t StartMemDma(const void *pSrc, void *pDst, uint32_t numBytes, uint32_t srcInc,
+                    ADI_EVB_MEM_CALLBACK pfCallback)
+{
+    int32_t status = -1;
+    int32_t channel = evbMemInfo.dmaChannel;
+    uint32_t width = 0;
+    uint32_t priority;
+    uint32_t ctrl;
+
+    if ((channel >= 0) && (evbMemInfo.state != 1) && (numBytes > 0) &&
+        (numBytes <= MAX_MEM_DMA_MAX_COUNT))
+    {
+        /* Word accesses when both ends and the count allow, byte accesses otherwise */
+        if ((((uint32_t)pDst | numBytes | (srcInc != 0 ? (uint32_t)pSrc : 0u)) & 0x3u) == 0)
+        {
+            width = 2u;
+        }
+        evbMemInfo.pfCallback = pfCallback;
+        evbMemInfo.state = 1;
+        priority = MaxGetDMAPriority(channel);
+        MXC_DMA->ch[channel].ctrl = priority;
+        MaxClearDMAStatus(channel);
+        MXC_DMA->ch[channel].src = (uint32_t)pSrc;
+        MXC_DMA->ch[channel].dst = (uint32_t)pDst;
+        MXC_DMA->ch[channel].cnt = numBytes;
+        ctrl = priority | (uint32_t)MXC_DMA_REQUEST_MEMTOMEM | srcInc | MXC_F_DMA_CTRL_DSTINC;
+        ctrl |= (width << MXC_F_DMA_CTRL_SRCWD_POS) | (width << MXC_F_DMA_CTRL_DSTWD_POS);
+        ctrl |= (MAX_MEM_DMA_BURST_SIZE - 1u) << MXC_F_DMA_CTRL_BURST_SIZE_POS;
+        MXC_DMA->ch[channel].ctrl = ctrl | MXC_F_DMA_CTRL_CTZ_IE | MXC_F_DMA_CTRL_EN;
+        status = 0;
+    }
+
+    return status;
+}
+
+void MemDmaCallBack(int32_t channel, uint8_t error)
+{
+    int32_t status = 0;
+    ADI_EVB_MEM_CALLBACK pfCallback = evbMemInfo.pfCallback;
+
+    (void)channel;
+    if (error != 0)
+    {
+        status = -1;
+    }
+    evbMemInfo.state = status;
+    if (pfCallback != NULL)
+    {
+        pfCallback(status);
+    }
+}
+
+#endif /* APP_CFG_ENABLE_MEM_DMA */
+
+/**
+ * @}
+ */
@@ -17,10 +17,16 @@
 #include <stdio.h>
 
 /*=============  D E F I N I T I O N S  =============*/
+/** Largest DMA packet in bytes, keeps a packet within the 32 byte fifo with the tx threshold */
+#define MAX_SPI_MAX_PACKET_BYTES 16u
+
 /** Initialise Spi */
 static void InitSpi(void *pSpi, uint32_t master);
 /** Start Spi Dma*/
-static void StartSpiDMA(void *pSpi, MAX_DMA_DESC *pRx, MAX_DMA_DESC *pTx, uint32_t targetSelect);
+static void StartSpiDMA(void *pSpi, MAX_DMA_DESC *pRx, MAX_DMA_DESC *pTx, uint32_t targetSelect,
+                        uint32_t numChars);
+/** Number of characters in a transfer */
+static uint32_t GetNumChars(MAX_SPI_INSTANCE *pSpiInfo, uint32_t numBytes);
 
 /*=============  C O D E  =============*/
 int32_t MaxInitSpi(MAX_SPI_INSTANCE *pSpiInfo)
@@ -31,7 +37,6 @@ int32_t MaxInitSpi(MAX_SPI_INSTANCE *pSpiInfo)
 
     status = MXC_SPI_Init(pSpiInfo->pSpi, pSpiInfo->master, 0, pSpiInfo->numSlaves, 0,
                           pSpiInfo->spiSpeed);
-    MXC_SPI_SetDataSize(pSpiInfo->pSpi, 8);
     if (status == 0)
     {
         status = MXC_SPI_SetWidth(pSpiInfo->pSpi, SPI_WIDTH_STANDARD);
@@ -43,11 +48,11 @@ int32_t MaxInitSpi(MAX_SPI_INSTANCE *pSpiInfo)
     if (status == 0)
     {
         MXC_SPI_SetTXThreshold(pSpiInfo->pSpi, 4);
-        MXC_SPI_SetRXThreshold(pSpiInfo->pSpi, 0);
+        // Sets the rx threshold and dma width for the packet size
+        status = MaxSetSpiDataSize(pSpiInfo, pSpiInfo->dataSize, pSpiInfo->dmaBurst);
     }
 
     InitSpi(pSpiInfo->pSpi, pSpiInfo->master);
-    MXC_DMA->inten |= ((1 << pSpiInfo->txDmaDesc.channel) | (1 << pSpiInfo->rxDmaDesc.channel));
     return status;
 }
 
@@ -59,7 +64,6 @@ int32_t MaxSlaveInitSpi(MAX_SPI_INSTANCE *pSpiInfo)
 
     status = MXC_SPI_Init(pSpiInfo->pSpi, pSpiInfo->master, 0, pSpiInfo->numSlaves, 0,
                           pSpiInfo->spiSpeed);
-    // MXC_SPI_SetDataSize(pSpiInfo->pSpi, 8);
     if (status == 0)
     {
         status = MXC_SPI_SetWidth(pSpiInfo->pSpi, SPI_WIDTH_STANDARD);
@@ -71,94 +75,110 @@ int32_t MaxSlaveInitSpi(MAX_SPI_INSTANCE *pSpiInfo)
     if (status == 0)
     {
         MXC_SPI_SetTXThreshold(pSpiInfo->pSpi, 4);
-        MXC_SPI_SetRXThreshold(pSpiInfo->pSpi, 0);
+        // Sets the rx threshold and dma width for the packet size
+        status = MaxSetSpiDataSize(pSpiInfo, pSpiInfo->dataSize, pSpiInfo->dmaBurst);
     }
 
     InitSpi(pSpiInfo->pSpi, pSpiInfo->master);
-    MXC_DMA->inten |= ((1 << pSpiInfo->txDmaDesc.channel) | (1 << pSpiInfo->rxDmaDesc.channel));
     return status;
 }
 
 int32_t MaxStartSpiTxDMA(MAX_SPI_INSTANCE *pSpiInfo, uint8_t *pData, uint32_t numBytes)
 {
-    int32_t status = 0;
-
+    int32_t status;
     MAX_DMA_DESC *pRx = &pSpiInfo->rxDmaDesc;
     MAX_DMA_DESC *pTx = &pSpiInfo->txDmaDesc;
 
-    pRx->pMem = (uint8_t *)&pSpiInfo->dummyCmd;
-    pRx->ctrl = (uint32_t)pRx->source | (MXC_DMA_WIDTH_BYTE << MXC_F_DMA_CTRL_SRCWD_POS);
-    pRx->numBytes = numBytes;
+    status = MaxCheckSpiLength(pSpiInfo, numBytes);
+    if (status == 0)
+    {
+        pRx->pMem = (uint8_t *)&pSpiInfo->dummyCmd;
+        pRx->ctrl = (uint32_t)pRx->source | pSpiInfo->dmaCtrl | MaxGetDMAPriority(pRx->channel);
+        pRx->numBytes = numBytes;
 
-    pTx->pMem = pData;
-    pTx->ctrl = MXC_F_DMA_CTRL_SRCINC | (uint32_t)pTx->source |
-                (MXC_DMA_WIDTH_BYTE << MXC_F_DMA_CTRL_SRCWD_POS);
-    pTx->numBytes = numBytes;
+        pTx->pMem = pData;
+        pTx->ctrl = MXC_F_DMA_CTRL_SRCINC | (uint32_t)pTx->source | pSpiInfo->dmaCtrl |
+                    MaxGetDMAPriority(pTx->channel);
+        pTx->numBytes = numBytes;
 
-    StartSpiDMA(pSpiInfo->pSpi, pRx, pTx, pSpiInfo->slaveIndex);
+        StartSpiDMA(pSpiInfo->pSpi, pRx, pTx, pSpiInfo->slaveIndex,
+                    GetNumChars(pSpiInfo, numBytes));
+    }
 
     return status;
 }
 
 int32_t MaxSlaveStartSpiTxDMA(MAX_SPI_INSTANCE *pSpiInfo, uint8_t *pData, uint32_t numBytes)
 {
-    int32_t status = 0;
-
+    int32_t status;
     MAX_DMA_DESC *pRx = &pSpiInfo->rxDmaDesc;
     MAX_DMA_DESC *pTx = &pSpiInfo->txDmaDesc;
 
-    pRx->pMem = (uint8_t *)&pSpiInfo->dummyCmd;
-    pRx->ctrl = (uint32_t)pRx->source | (MXC_DMA_WIDTH_BYTE << MXC_F_DMA_CTRL_SRCWD_POS);
-    pRx->numBytes = numBytes;
+    status = MaxCheckSpiLength(pSpiInfo, numBytes);
+    if (status == 0)
+    {
+        pRx->pMem = (uint8_t *)&pSpiInfo->dummyCmd;
+        pRx->ctrl = (uint32_t)pRx->source | pSpiInfo->dmaCtrl | MaxGetDMAPriority(pRx->channel);
+        pRx->numBytes = numBytes;
 
-    pTx->pMem = pData;
-    pTx->ctrl = MXC_F_DMA_CTRL_SRCINC | (uint32_t)pTx->source |
-                (MXC_DMA_WIDTH_BYTE << MXC_F_DMA_CTRL_SRCWD_POS);
-    pTx->numBytes = numBytes;
+        pTx->pMem = pData;
+        pTx->ctrl = MXC_F_DMA_CTRL_SRCINC | (uint32_t)pTx->source | pSpiInfo->dmaCtrl |
+                    MaxGetDMAPriority(pTx->channel);
+        pTx->numBytes = numBytes;
 
-    StartSpiDMA(pSpiInfo->pSpi, pRx, pTx, pSpiInfo->slaveIndex);
+        StartSpiDMA(pSpiInfo->pSpi, pRx, pTx, pSpiInfo->slaveIndex,
+                    GetNumChars(pSpiInfo, numBytes));
+    }
 
     return status;
 }
 
 int32_t MaxStartSpiRxDMA(MAX_SPI_INSTANCE *pSpiInfo, uint8_t *pData, uint32_t numBytes)
 {
-    int32_t status = 0;
-
+    int32_t status;
     MAX_DMA_DESC *pRx = &pSpiInfo->rxDmaDesc;
     MAX_DMA_DESC *pTx = &pSpiInfo->txDmaDesc;
 
-    pRx->pMem = pData;
-    pRx->ctrl = MXC_F_DMA_CTRL_DSTINC | (uint32_t)pRx->source |
-                (MXC_DMA_WIDTH_BYTE << MXC_F_DMA_CTRL_SRCWD_POS);
-    pRx->numBytes = numBytes;
+    status = MaxCheckSpiLength(pSpiInfo, numBytes);
+    if (status == 0)
+    {
+        pRx->pMem = pData;
+        pRx->ctrl = MXC_F_DMA_CTRL_DSTINC | (uint32_t)pRx->source | pSpiInfo->dmaCtrl |
+                    MaxGetDMAPriority(pRx->channel);
+        pRx->numBytes = numBytes;
 
-    pTx->pMem = (uint8_t *)&pSpiInfo->dummyCmd;
-    pTx->ctrl = pTx->source | (MXC_DMA_WIDTH_BYTE << MXC_F_DMA_CTRL_SRCWD_POS);
-    pTx->numBytes = numBytes;
+        pTx->pMem = (uint8_t *)&pSpiInfo->dummyCmd;
+        pTx->ctrl = pTx->source | pSpiInfo->dmaCtrl | MaxGetDMAPriority(pTx->channel);
+        pTx->numBytes = numBytes;
 
-    StartSpiDMA(pSpiInfo->pSpi, pRx, pTx, pSpiInfo->slaveIndex);
+        StartSpiDMA(pSpiInfo->pSpi, pRx, pTx, pSpiInfo->slaveIndex,
+                    GetNumChars(pSpiInfo, numBytes));
+    }
 
     return status;
 }
 
 int32_t MaxSlaveStartSpiRxDMA(MAX_SPI_INSTANCE *pSpiInfo, uint8_t *pData, uint32_t numBytes)
 {
-    int32_t status = 0;
-
+    int32_t status;
     MAX_DMA_DESC *pRx = &pSpiInfo->rxDmaDesc;
     MAX_DMA_DESC *pTx = &pSpiInfo->txDmaDesc;
 
-    pRx->pMem = pData;
-    pRx->ctrl = MXC_F_DMA_CTRL_DSTINC | (uint32_t)pRx->source |
-                (MXC_DMA_WIDTH_BYTE << MXC_F_DMA_CTRL_SRCWD_POS);
-    pRx->numBytes = numBytes;
+    status = MaxCheckSpiLength(pSpiInfo, numBytes);
+    if (status == 0)
+    {
+        pRx->pMem = pData;
+        pRx->ctrl = MXC_F_DMA_CTRL_DSTINC | (uint32_t)pRx->source | pSpiInfo->dmaCtrl |
+                    MaxGetDMAPriority(pRx->channel);
+        pRx->numBytes = numBytes;
 
-    pTx->pMem = (uint8_t *)&pSpiInfo->dummyCmd;
-    pTx->ctrl = pTx->source | (MXC_DMA_WIDTH_BYTE << MXC_F_DMA_CTRL_SRCWD_POS);
-    pTx->numBytes = numBytes;
+        pTx->pMem = (uint8_t *)&pSpiInfo->dummyCmd;
+        pTx->ctrl = pTx->source | pSpiInfo->dmaCtrl | MaxGetDMAPriority(pTx->channel);
+        pTx->numBytes = numBytes;
 
-    StartSpiDMA(pSpiInfo->pSpi, pRx, pTx, pSpiInfo->slaveIndex);
+        StartSpiDMA(pSpiInfo->pSpi, pRx, pTx, pSpiInfo->slaveIndex,
+                    GetNumChars(pSpiInfo, numBytes));
+    }
 
     return status;
 }
@@ -166,22 +186,112 @@ int32_t MaxSlaveStartSpiRxDMA(MAX_SPI_INSTANCE *pSpiInfo, uint8_t *pData, uint32
 int32_t MaxStartSpiTxRxDMA(MAX_SPI_INSTANCE *pSpiInfo, uint8_t *pTxData, uint8_t *pRxData,
                            uint32_t numBytes)
 {
-    int32_t status = 0;
-
+    int32_t status;
     MAX_DMA_DESC *pRx = &pSpiInfo->rxDmaDesc;
     MAX_DMA_DESC *pTx = &pSpiInfo->txDmaDesc;
 
-    pRx->pMem = pRxData;
-    pRx->ctrl = MXC_F_DMA_CTRL_DSTINC | (uint32_t)pRx->source |
-                (MXC_DMA_WIDTH_BYTE << MXC_F_DMA_CTRL_SRCWD_POS);
-    pRx->numBytes = numBytes;
+    status = MaxCheckSpiLength(pSpiInfo, numBytes);
+    if (status == 0)
+    {
+        pRx->pMem = pRxData;
+        pRx->ctrl = MXC_F_DMA_CTRL_DSTINC | (uint32_t)pRx->source | pSpiInfo->dmaCtrl |
+                    MaxGetDMAPriority(pRx->channel);
+        pRx->numBytes = numBytes;
+
+        pTx->pMem = pTxData;
+        pTx->ctrl = MXC_F_DMA_CTRL_SRCINC | (uint32_t)pTx->source | pSpiInfo->dmaCtrl |
+                    MaxGetDMAPriority(pTx->channel);
+        pTx->numBytes = numBytes;
+
+        StartSpiDMA(pSpiInfo->pSpi, pRx, pTx, pSpiInfo->slaveIndex,
+                    GetNumChars(pSpiInfo, numBytes));
+    }
+
+    return status;
+}
 
-    pTx->pMem = pTxData;
-    pTx->ctrl = MXC_F_DMA_CTRL_SRCINC | (uint32_t)pTx->source |
-                (MXC_DMA_WIDTH_BYTE << MXC_F_DMA_CTRL_SRCWD_POS);
-    pTx->numBytes = numBytes;
+int32_t MaxPrepareSpiTxRxDMA(MAX_SPI_INSTANCE *pSpiInfo, MAX_SPI_XFER *pXfer, uint8_t *pTxData,
+                             uint8_t *pRxData, uint32_t numBytes)
+{
+    int32_t status = 0;
+    mxc_spi_regs_t *spiInstance = pSpiInfo->pSpi;
+    uint32_t numChars = GetNumChars(pSpiInfo, numBytes);
 
-    StartSpiDMA(pSpiInfo->pSpi, pRx, pTx, pSpiInfo->slaveIndex);
+    if ((numChars == 0u) || (numChars > MXC_F_SPI_CTRL1_TX_NUM_CHAR) ||
+        (MaxCheckSpiLength(pSpiInfo, numBytes) != 0))
+    {
+        status = -1;
+    }
+    else
+    {
+        pXfer->rxDmaDesc.channel = pSpiInfo->rxDmaDesc.channel;
+        pXfer->rxDmaDesc.source = pSpiInfo->rxDmaDesc.source;
+        pXfer->rxDmaDesc.pMem = pRxData;
+        pXfer->rxDmaDesc.numBytes = numBytes;
+        pXfer->rxDmaDesc.ctrl = MXC_F_DMA_CTRL_DSTINC | (uint32_t)pSpiInfo->rxDmaDesc.source |
+                                pSpiInfo->dmaCtrl | MXC_F_DMA_CTRL_EN | MXC_F_DMA_CTRL_CTZ_IE;
+        // Keeps the arbitration priority set when the channel was acquired
+        pXfer->rxDmaDesc.ctrl |= MaxGetDMAPriority(pSpiInfo->rxDmaDesc.channel);
+
+        pXfer->txDmaDesc.channel = pSpiInfo->txDmaDesc.channel;
+        pXfer->txDmaDesc.source = pSpiInfo->txDmaDesc.source;
+        pXfer->txDmaDesc.pMem = pTxData;
+        pXfer->txDmaDesc.numBytes = numBytes;
+        pXfer->txDmaDesc.ctrl = MXC_F_DMA_CTRL_SRCINC | (uint32_t)pSpiInfo->txDmaDesc.source |
+                                pSpiInfo->dmaCtrl | MXC_F_DMA_CTRL_EN | MXC_F_DMA_CTRL_CTZ_IE;
+        pXfer->txDmaDesc.ctrl |= MaxGetDMAPriority(pSpiInfo->txDmaDesc.channel);
+
+        pXfer->spiCtrl0 = spiInstance->ctrl0 & ~(MXC_F_SPI_CTRL0_START | MXC_F_SPI_CTRL0_SS_ACTIVE |
+                                                 MXC_F_SPI_CTRL0_SS_CTRL);
+        pXfer->spiCtrl0 |= (uint32_t)(1 << pSpiInfo->slaveIndex) << MXC_F_SPI_CTRL0_SS_ACTIVE_POS;
+        pXfer->spiCtrl1 = (numChars & MXC_F_SPI_CTRL1_TX_NUM_CHAR)
+                          << MXC_F_SPI_CTRL1_TX_NUM_CHAR_POS;
+        pXfer->spiDma = spiInstance->dma & ~(MXC_F_SPI_DMA_DMA_TX_EN | MXC_F_SPI_DMA_DMA_RX_EN |
+                                             MXC_F_SPI_DMA_TX_FLUSH | MXC_F_SPI_DMA_RX_FLUSH);
+        pXfer->configId = pSpiInfo->configId;
+    }
+
+    return status;
+}
+
+int32_t MaxStartSpiXfer(MAX_SPI_INSTANCE *pSpiInfo, MAX_SPI_XFER *pXfer)
+{
+    int32_t status = 0;
+    mxc_spi_regs_t *spiInstance = pSpiInfo->pSpi;
+    mxc_dma_ch_regs_t *pRxCh = &MXC_DMA->ch[pXfer->rxDmaDesc.channel];
+    mxc_dma_ch_regs_t *pTxCh = &MXC_DMA->ch[pXfer->txDmaDesc.channel];
+
+    // A slot prepared before a configuration change or a transaction in progress is not started
+    if ((pXfer->configId != pSpiInfo->configId) || ((pRxCh->ctrl & MXC_F_DMA_CTRL_EN) != 0u) ||
+        ((pTxCh->ctrl & MXC_F_DMA_CTRL_EN) != 0u) ||
+        ((spiInstance->stat & MXC_F_SPI_STAT_BUSY) != 0u))
+    {
+        status = -1;
+    }
+    else
+    {
+        // Flags of the previous transaction would raise the interrupts as soon as they are enabled
+        MaxClearDMAStatus(pXfer->rxDmaDesc.channel);
+        MaxClearDMAStatus(pXfer->txDmaDesc.channel);
+        spiInstance->intfl = spiInstance->intfl;
+
+        spiInstance->ctrl0 = pXfer->spiCtrl0;
+        spiInstance->ctrl1 = pXfer->spiCtrl1;
+        // flush tx and rx fifo and clear pending DMA requests in a single write
+        spiInstance->dma = pXfer->spiDma | MXC_F_SPI_DMA_TX_FLUSH | MXC_F_SPI_DMA_RX_FLUSH;
+
+        // Channels are disabled by hardware once the count reaches zero
+        pRxCh->dst = (uint32_t)pXfer->rxDmaDesc.pMem;
+        pRxCh->cnt = pXfer->rxDmaDesc.numBytes;
+        pRxCh->ctrl = pXfer->rxDmaDesc.ctrl;
+        pTxCh->src = (uint32_t)pXfer->txDmaDesc.pMem;
+        pTxCh->cnt = pXfer->txDmaDesc.numBytes;
+        pTxCh->ctrl = pXfer->txDmaDesc.ctrl;
+
+        spiInstance->dma = pXfer->spiDma | MXC_F_SPI_DMA_DMA_TX_EN | MXC_F_SPI_DMA_DMA_RX_EN;
+        // start the spi Transaction
+        spiInstance->ctrl0 = pXfer->spiCtrl0 | MXC_F_SPI_CTRL0_START;
+    }
 
     return status;
 }
@@ -193,22 +303,111 @@ int32_t MaxSetSpiFrequency(MAX_SPI_INSTANCE *pSpiInfo, uint32_t spiFrequency)
     pSpiInfo->pSpi->ctrl0 &= ~(MXC_F_SPI_CTRL0_EN);
     status = MXC_SPI_SetFrequency(pSpiInfo->pSpi, spiFrequency);
     pSpiInfo->pSpi->ctrl0 |= MXC_F_SPI_CTRL0_EN;
+    pSpiInfo->configId++;
+
+    return status;
+}
+
+int32_t MaxCheckSpiLength(MAX_SPI_INSTANCE *pSpiInfo, uint32_t numBytes)
+{
+    int32_t status = 0;
+    uint32_t packetBytes = pSpiInfo->dmaBurst;
+
+    if (pSpiInfo->dataSize > 8u)
+    {
+        packetBytes = pSpiInfo->dmaBurst * 2u;
+    }
+    /* The rx dma waits for whole packets, a partial last packet would never be read */
+    if ((numBytes == 0u) || ((numBytes % packetBytes) != 0u))
+    {
+        status = -1;
+    }
+
+    return status;
+}
+
+int32_t MaxSetSpiDataSize(MAX_SPI_INSTANCE *pSpiInfo, uint32_t dataSize, uint32_t burstLength)
+{
+    int32_t status = 0;
+    uint32_t enable = pSpiInfo->pSpi->ctrl0 & MXC_F_SPI_CTRL0_EN;
+    uint32_t packetBytes = burstLength;
+    uint32_t width = MXC_DMA_WIDTH_BYTE;
+
+    if (dataSize > 8u)
+    {
+        packetBytes = burstLength * 2u;
+    }
+    if ((dataSize == 0u) || (dataSize > 16u) || (burstLength == 0u) ||
+        (packetBytes > MAX_SPI_MAX_PACKET_BYTES))
+    {
+        status = -1;
+    }
+    else
+    {
+        if ((packetBytes & 3u) == 0u)
+        {
+            width = MXC_DMA_WIDTH_WORD;
+        }
+        else if ((packetBytes & 1u) == 0u)
+        {
+            width = MXC_DMA_WIDTH_HALFWORD;
+        }
+        pSpiInfo->pSpi->ctrl0 &= ~(MXC_F_SPI_CTRL0_EN);
+        status = MXC_SPI_SetDataSize(pSpiInfo->pSpi, (int)dataSize);
+        if (status == 0)
+        {
+            // Rx dma request is raised once a whole packet is in the fifo
+            MXC_SPI_SetRXThreshold(pSpiInfo->pSpi, packetBytes - 1u);
+            pSpiInfo->dataSize = dataSize;
+            pSpiInfo->dmaBurst = burstLength;
+            pSpiInfo->configId++;
+            pSpiInfo->dmaCtrl = (width << MXC_F_DMA_CTRL_SRCWD_POS) |
+                                (width << MXC_F_DMA_CTRL_DSTWD_POS) |
+                                ((packetBytes - 1u) << MXC_F_DMA_CTRL_BURST_SIZE_POS);
+        }
+        pSpiInfo->pSpi->ctrl0 |= enable;
+    }
 
     return status;
 }
 
+void MaxSetSpiSlaveSelectHold(MAX_SPI_INSTANCE *pSpiInfo, uint8_t hold)
+{
+    if (hold == 1)
+    {
+        pSpiInfo->pSpi->ctrl0 |= MXC_F_SPI_CTRL0_SS_CTRL;
+    }
+    else
+    {
+        pSpiInfo->pSpi->ctrl0 &= ~MXC_F_SPI_CTRL0_SS_CTRL;
+    }
+}
+
+void MaxAbortSpiDMA(MAX_SPI_INSTANCE *pSpiInfo)
+{
+    mxc_spi_regs_t *spiInstance = pSpiInfo->pSpi;
+
+    spiInstance->dma &= ~(MXC_F_SPI_DMA_DMA_TX_EN | MXC_F_SPI_DMA_DMA_RX_EN);
+    MXC_DMA->ch[pSpiInfo->txDmaDesc.channel].ctrl &= ~(MXC_F_DMA_CTRL_EN | MXC_F_DMA_CTRL_CTZ_IE);
+    MXC_DMA->ch[pSpiInfo->rxDmaDesc.channel].ctrl &= ~(MXC_F_DMA_CTRL_EN | MXC_F_DMA_CTRL_CTZ_IE);
+    MaxClearDMAStatus(pSpiInfo->txDmaDesc.channel);
+    MaxClearDMAStatus(pSpiInfo->rxDmaDesc.channel);
+    spiInstance->ctrl0 &= ~MXC_F_SPI_CTRL0_START;
+    // Drops the characters left over from the aborted transaction
+    spiInstance->dma |= (MXC_F_SPI_DMA_TX_FLUSH | MXC_F_SPI_DMA_RX_FLUSH);
+}
+
 void MaxClearSpiInterrupt(MAX_SPI_INSTANCE *pSpiInfo)
 {
     mxc_spi_regs_t *spiInstance = (mxc_spi_regs_t *)pSpiInfo->pSpi;
-    /* 0x5C is the mask for status register */
-    MXC_DMA->ch[pSpiInfo->txDmaDesc.channel].status |= 0x5C;
-    /* 0x5C is the mask for status register */
-    MXC_DMA->ch[pSpiInfo->rxDmaDesc.channel].status |= 0x5C;
+    MaxClearDMAStatus(pSpiInfo->txDmaDesc.channel);
+    MaxClearDMAStatus(pSpiInfo->rxDmaDesc.channel);
     // clear pending dma request
     spiInstance->dma &= ~(MXC_F_SPI_DMA_DMA_TX_EN | MXC_F_SPI_DMA_DMA_RX_EN);
 }
 
-void StartSpiDMA(void *pSpi, MAX_DMA_DESC *pRx, MAX_DMA_DESC *pTx, uint32_t targetSelect)
+void StartSpiDMA(void *pSpi, MAX_DMA_DESC *pRx, MAX_DMA_DESC *pTx, uint32_t targetSelect,
+                 uint32_t numChars)
 {
     mxc_spi_regs_t *spiInstance = (mxc_spi_regs_t *)pSpi;
 
@@ -219,7 +418,7 @@ void StartSpiDMA(void *pSpi, MAX_DMA_DESC *pRx, MAX_DMA_DESC *pTx, uint32_t targ
     // If the SPIn port is set to operate in 4-wire mode,
     // SPIn_CTRL1.rx_num_chars field is ignored and the SPIn_CTRL1.tx_num_chars
     // field is used for both the number of characters to receive and transmit.
-    spiInstance->ctrl1 = (pTx->numBytes & MXC_F_SPI_CTRL1_TX_NUM_CHAR)
+    spiInstance->ctrl1 = (numChars & MXC_F_SPI_CTRL1_TX_NUM_CHAR)
                          << MXC_F_SPI_CTRL1_TX_NUM_CHAR_POS;
     // flush tx and rx fifo
     spiInstance->dma |= (MXC_F_SPI_DMA_TX_FLUSH | MXC_F_SPI_DMA_RX_FLUSH);
@@ -234,6 +433,16 @@ void StartSpiDMA(void *pSpi, MAX_DMA_DESC *pRx, MAX_DMA_DESC *pTx, uint32_t targ
     spiInstance->ctrl0 |= MXC_F_SPI_CTRL0_START;
 }
 
+uint32_t GetNumChars(MAX_SPI_INSTANCE *pSpiInfo, uint32_t numBytes)
+{
+    uint32_t numChars = numBytes;
+    if (pSpiInfo->dataSize > 8u)
+    {
+        numChars = numBytes >> 1u;
+    }
+    return numChars;
+}
+
 void InitSpi(void *pSpi, uint32_t master)
 {
 
@@ -10,6 +10,7 @@
 /*============= I N C L U D E S =============*/
 
 #include "max3267x_timer_config.h"
+#include "adi_evb.h"
 #include "app_cfg.h"
 #include "mxc_device.h"
 #include "nvic_table.h"
@@ -23,17 +24,35 @@
 #define ADE_TIMER_CLOCK MXC_TMR_8M_CLK
 /** timer clock source*/
 #define ADE_TIMER_CLOCK_SOURCE MXC_TMR_CLK2
-/** count for convert timer count to us */
-#define TIMER_COUNT_US 7.3728f // 8 for 8Mhz and 50 for 50Mhz
+/** timer tick rate in Hz */
+#define TIMER_FREQUENCY        7372800u
 #else
 /** timer clock */
 #define ADE_TIMER_CLOCK        MXC_TMR_APB_CLK
 /** timer clock source*/
 #define ADE_TIMER_CLOCK_SOURCE MXC_TMR_CLK0
-/** count for convert timer count to us */
-#define TIMER_COUNT_US         50.0f // 8 for 8Mhz and 50 for 50Mhz
+/** timer tick rate in Hz */
+#define TIMER_FREQUENCY        50000000u
 #endif
 
+/** Ticks per counter period, the counter restarts from 1 after reaching the compare value */
+#define TIMER_PERIOD 0xFFFFFFFFull
+/** Counts per software timer tick of 1 ms */
+#define TICK_COUNTS  (TIMER_FREQUENCY / 1000u)
+
+/** Pulse counter of a CF input */
+typedef struct
+{
+    /** timer registers, NULL when not counting */
+    mxc_tmr_regs_t *pTmr;
+    /** callback every threshold pulses */
+    ADI_EVB_PULSE_CALLBACK pfCallback;
+    /** num of pulses between interrupts */
+    uint32_t threshold;
+    /** num of times the threshold was counted */
+    volatile uint32_t numThresholds;
+} PULSE_COUNTER;
+
 /**
  * @brief  Pulse 1 Timer interrupt handler.
  *
@@ -45,8 +64,39 @@ static void TimerHandler(void);
  */
 static inline unsigned int ReadTimerCountRegister(mxc_tmr_regs_t *pTmr);
 
+/**
+ * Counts a pending counter overflow, called with interrupts masked
+ */
+static void CountOverflow(mxc_tmr_regs_t *pTmr);
+
+/**
+ * @brief  Software timer tick interrupt handler.
+ */
+static void TickHandler(void);
+
+/**
+ * @brief  Pulse counter threshold interrupt handler.
+ */
+static void PulseHandler(uint32_t idx);
+
+/**
+ * @brief  CF1 pulse counter interrupt handler.
+ */
+static void PulseHandlerCf1(void);
+
+/**
+ * @brief  CF2 pulse counter interrupt handler.
+ */
+static void PulseHandlerCf2(void);
+
 /** timer registers */
 static mxc_tmr_regs_t *pSysTmr;
+/** counter overflows since the timer was started */
+static volatile uint32_t timerOverflows;
+/** tick timer registers */
+static mxc_tmr_regs_t *pTickTmr;
+/** pulse counters of the CF inputs */
+static PULSE_COUNTER pulseCounters[ADI_EVB_NUM_PULSE_INPUTS];
 /**  Define the timer width (16-bit or 32-bit) */
 #define TIMER_WIDTH 32 // Change to 16 for 16-bit timers
 
@@ -79,19 +129,94 @@ int32_t MaxTimerInit(mxc_tmr_regs_t *pTmr)
 
 uint32_t MaxGetTime(mxc_tmr_regs_t *pTmr)
 {
-    uint32_t timerCnt = ReadTimerCountRegister(pTmr);
-    return (uint32_t)(((float)timerCnt / TIMER_COUNT_US));
+    return (uint32_t)EvbTicksToUs(MaxGetTime64(pTmr));
+}
+
+int32_t MaxTickTimerInit(mxc_tmr_regs_t *pTmr)
+{
+    IRQn_Type irqn;
+    int32_t status;
+    mxc_tmr_cfg_t config;
+    MXC_TMR_Shutdown(pTmr);
+
+    /* Same clock as the system timer, the counter restarts every tick */
+    config.pres = TMR_PRES_1;
+    config.mode = TMR_MODE_CONTINUOUS;
+    config.clock = ADE_TIMER_CLOCK;
+    config.cmp_cnt = TICK_COUNTS;
+    config.pol = 0;
+    config.bitMode = TMR_BIT_MODE_32;
+
+    irqn = MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(pTmr));
+    pTickTmr = pTmr;
+
+    NVIC_SetVector(irqn, (uint32_t)TickHandler);
+    NVIC_EnableIRQ(irqn);
+    status = MXC_TMR_Init(pTmr, &config, false);
+    pTmr->ctrl1 |= (ADE_TIMER_CLOCK_SOURCE << MXC_F_TMR_REVB_CTRL1_CLKSEL_B_POS);
+    MXC_TMR_EnableInt(pTmr);
+
+    return status;
+}
+
+void MaxStartTickTimer(void)
+{
+    if (pTickTmr != NULL)
+    {
+        MXC_TMR_ClearFlags(pTickTmr);
+        pTickTmr->cnt = 0x01;
+        MXC_TMR_Start(pTickTmr);
+    }
+}
+
+void MaxStopTickTimer(void)
+{
+    if (pTickTmr != NULL)
+    {
+        MXC_TMR_Stop(pTickTmr);
+        MXC_TMR_ClearFlags(pTickTmr);
+    }
+}
+
+uint64_t MaxGetTime64(mxc_tmr_regs_t *pTmr)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t timerCnt;
+    uint64_t ticks;
+
+    __disable_irq();
+    timerCnt = ReadTimerCountRegister(pTmr);
+    /* A wrap not yet counted by the interrupt makes the count read above ambiguous */
+    if ((pTmr->intfl & MXC_F_TMR_INTFL_IRQ_A) != 0)
+    {
+        CountOverflow(pTmr);
+        timerCnt = ReadTimerCountRegister(pTmr);
+    }
+    /* The flag is set when the count reaches the compare value, one tick before it restarts */
+    if (timerCnt == TIMER_PERIOD)
+    {
+        timerCnt = 0;
+    }
+    ticks = ((uint64_t)timerOverflows * TIMER_PERIOD) + timerCnt - 1;
+    __set_PRIMASK(primask);
+
+    return ticks;
+}
+
+uint32_t MaxGetTimerFrequency(void)
+{
+    return TIMER_FREQUENCY;
 }
 
 uint32_t MaxGetMaximumTime()
 {
-    uint32_t timerCnt = (uint32_t)((1ULL << TIMER_WIDTH) - 1);
-    return (uint32_t)(((float)timerCnt / TIMER_COUNT_US));
+    return (uint32_t)((1ULL << TIMER_WIDTH) - 1);
 }
 
 void MaxStartTimer(mxc_tmr_regs_t *pTmr)
 {
     MXC_TMR_ClearFlags(pTmr);
+    timerOverflows = 0;
     pTmr->cnt = 0x01;
     MXC_TMR_Start(pTmr);
 }
@@ -101,9 +226,150 @@ void MaxStopTimer(mxc_tmr_regs_t *pTmr)
     MXC_TMR_Stop(pTmr);
 }
 
+int32_t MaxStartPulseCount(mxc_tmr_regs_t *pTmr, uint32_t idx, uint32_t threshold,
+                           ADI_EVB_PULSE_CALLBACK pfCallback)
+{
+    IRQn_Type irqn;
+    int32_t status = -1;
+    mxc_tmr_cfg_t config;
+    PULSE_COUNTER *pCounter;
+
+    if ((pTmr != NULL) && (idx < ADI_EVB_NUM_PULSE_INPUTS) && (threshold > 0))
+    {
+        pCounter = &pulseCounters[idx];
+        MaxStopPulseCount(idx);
+        MXC_TMR_Shutdown(pTmr);
+
+        /* Counter mode counts edges of the timer input, pol 1 selects the falling edge */
+        config.pres = TMR_PRES_1;
+        config.mode = TMR_MODE_COUNTER;
+        config.clock = ADE_TIMER_CLOCK;
+        config.cmp_cnt = threshold;
+        config.pol = 1;
+        config.bitMode = TMR_BIT_MODE_32;
+
+        pCounter->pfCallback = pfCallback;
+        pCounter->threshold = threshold;
+        pCounter->numThresholds = 0;
+        irqn = MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(pTmr));
+        NVIC_SetVector(irqn, (idx == ADI_EVB_PULSE_INPUT_CF1) ? (uint32_t)PulseHandlerCf1
+                                                              : (uint32_t)PulseHandlerCf2);
+        NVIC_SetPriority(irqn, APP_CFG_PORT0_GPIO_INT_PRIO);
+        NVIC_EnableIRQ(irqn);
+        /* The input pin is switched from GPIO to the timer */
+        status = MXC_TMR_Init(pTmr, &config, true);
+        if (status == 0)
+        {
+            MXC_TMR_ClearFlags(pTmr);
+            MXC_TMR_EnableInt(pTmr);
+            /* The count restarts from 1 after the compare, starting from 0 makes every
+             * period threshold pulses long */
+            pTmr->cnt = 0;
+            pCounter->pTmr = pTmr;
+            MXC_TMR_Start(pTmr);
+        }
+    }
+
+    return status;
+}
+
+void MaxStopPulseCount(uint32_t idx)
+{
+    mxc_tmr_regs_t *pTmr;
+
+    if (idx < ADI_EVB_NUM_PULSE_INPUTS)
+    {
+        pTmr = pulseCounters[idx].pTmr;
+        if (pTmr != NULL)
+        {
+            MXC_TMR_Stop(pTmr);
+            MXC_TMR_DisableInt(pTmr);
+            NVIC_DisableIRQ(MXC_TMR_GET_IRQ(MXC_TMR_GET_IDX(pTmr)));
+            pulseCounters[idx].pTmr = NULL;
+        }
+    }
+}
+
+uint32_t MaxGetPulseCount(uint32_t idx)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t numPulses = 0;
+    uint32_t isPending;
+    uint32_t cnt;
+    PULSE_COUNTER *pCounter;
+
+    if (idx < ADI_EVB_NUM_PULSE_INPUTS)
+    {
+        pCounter = &pulseCounters[idx];
+        __disable_irq();
+        if (pCounter->pTmr != NULL)
+        {
+            /* With interrupts masked the flag can only be set, equal reads around the count
+             * tell whether the count is before or after a threshold not yet handled */
+            do
+            {
+                isPending = pCounter->pTmr->intfl & MXC_F_TMR_INTFL_IRQ_A;
+                cnt = pCounter->pTmr->cnt;
+            } while (isPending != (pCounter->pTmr->intfl & MXC_F_TMR_INTFL_IRQ_A));
+            numPulses = ((pCounter->numThresholds + ((isPending != 0) ? 1u : 0u)) *
+                         pCounter->threshold) +
+                        (cnt % pCounter->threshold);
+        }
+        __set_PRIMASK(primask);
+    }
+
+    return numPulses;
+}
+
 static void TimerHandler(void)
 {
-    MXC_TMR_ClearFlags(pSysTmr);
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    CountOverflow(pSysTmr);
+    __set_PRIMASK(primask);
+}
+
+static void TickHandler(void)
+{
+    MXC_TMR_ClearFlags(pTickTmr);
+    EvbSwTimerTick();
+}
+
+static void PulseHandler(uint32_t idx)
+{
+    PULSE_COUNTER *pCounter = &pulseCounters[idx];
+    uint32_t numPulses;
+
+    if (pCounter->pTmr != NULL)
+    {
+        MXC_TMR_ClearFlags(pCounter->pTmr);
+        pCounter->numThresholds++;
+        if (pCounter->pfCallback != NULL)
+        {
+            numPulses = pCounter->numThresholds * pCounter->threshold;
+            pCounter->pfCallback(idx, numPulses);
+        }
+    }
+}
+
+static void PulseHandlerCf1(void)
+{
+    PulseHandler(ADI_EVB_PULSE_INPUT_CF1);
+}
+
+static void PulseHandlerCf2(void)
+{
+    PulseHandler(ADI_EVB_PULSE_INPUT_CF2);
+}
+
+static void CountOverflow(mxc_tmr_regs_t *pTmr)
+{
+    if ((pTmr->intfl & MXC_F_TMR_INTFL_IRQ_A) != 0)
+    {
+        MXC_TMR_ClearFlags(pTmr);
+        timerOverflows++;
+    }
 }
 
 static inline unsigned int ReadTimerCountRegister(mxc_tmr_regs_t *pTmr)
@@ -41,12 +41,8 @@ int32_t MaxInitUart(MAX_UART_INSTANCE *pUartInfo)
 {
     int32_t status = 0;
 
+    // Dma interrupts are enabled when the channel is acquired
     status = MXC_UART_Init(pUartInfo->pUart, pUartInfo->baudrate, MXC_UART_APB_CLK);
-    if (status == 0)
-    {
-        MXC_DMA->inten |=
-            ((1 << pUartInfo->txDmaDesc.channel) | (1 << pUartInfo->rxDmaDesc.channel));
-    }
 
     return status;
 }
@@ -56,6 +56,8 @@ extern "C" {
 #define BOARD_CFG_CF2_PIN (0)
 /**  Pin - CF3 */
 #define BOARD_CFG_CF3_PIN (0)
+/**  Port - CF2 and CF3, on channels of the CF1 timer. Pins set to 0 are not routed */
+#define BOARD_CFG_CF23_PORT GPIOA
 /**  Pin - ADEMA127_SPI_CS */
 #define BOARD_CFG_SS_PIN GPIO_PIN_4
 /**  Pin - AMP_PD */
@@ -83,6 +85,27 @@ extern "C" {
 #define BOARD_CFG_ADC_SPI_CLK_POL SPI_POLARITY_HIGH
 /** ADEMA127 SPI clk phase*/
 #define BOARD_CFG_ADC_SPI_CLK_PHA SPI_PHASE_2EDGE
+/** ADEMA127 SPI frame size */
+#define BOARD_CFG_ADC_SPI_DATA_SIZE SPI_DATASIZE_8BIT
+/** ADEMA127 SPI frames moved per DMA request */
+#define BOARD_CFG_ADC_SPI_FIFO_THRESHOLD SPI_FIFO_THRESHOLD_01DATA
+/** ADEMA127 SPI clock tuning, num of slower steps added to the fastest error free setting */
+#define BOARD_CFG_ADC_SPI_TUNE_MARGIN 1
+/** ADEMA127 SPI clock tuning, num of reads per step */
+#define BOARD_CFG_ADC_SPI_TUNE_NUM_READS 1000
+/** ADEMA127 SPI clock tuning, num of reads to check a cached setting */
+#define BOARD_CFG_ADC_SPI_TUNE_VERIFY_READS 100
+/** ADEMA127 start-up time in ms from the release of its reset to the first SPI access */
+#define BOARD_CFG_ADC_STARTUP_DELAY_MS 100
+/** FRAM address of the cached ADEMA127 SPI clock setting. The last 16 bytes of the FRAM, from
+ *  this address to 0x3FFFF, are reserved for it and must not be used by the application */
+#define BOARD_CFG_FRAM_SPI_TUNE_ADDR 0x3FFF0
+/** FRAM SPI Speed*/
+#define BOARD_CFG_FRAM_SPI_PRESCALER SPI_BAUDRATEPRESCALER_8
+/** FRAM SPI clk polarity*/
+#define BOARD_CFG_FRAM_SPI_CLK_POL SPI_POLARITY_HIGH
+/** FRAM SPI clk phase*/
+#define BOARD_CFG_FRAM_SPI_CLK_PHA SPI_PHASE_2EDGE
 /** Slave index */
 #define BOARD_CFG_ADC_SS_INDEX 0
 /** Slave index */
@@ -130,6 +153,32 @@ extern "C" {
 #define CF1_PIN_ALT_FUNC GPIO_AF1_TIM2
 /** CF IRQ Number */
 #define CF1_TIM_IRQn TIM2_IRQn
+/** CF IRQ Handler */
+#define CF1_TIM_IRQHandler TIM2_IRQHandler
+/**  CF2 Timer Channel */
+#define BOARD_CFG_CF2_TIM_CHAN TIM_CHANNEL_2
+/**  CF3 Timer Channel */
+#define BOARD_CFG_CF3_TIM_CHAN TIM_CHANNEL_3
+/** Index of CF1 in ADI_EVB_CF_PERIOD.startCount */
+#define BOARD_CFG_CF1_PERIOD_IDX 0
+/** Index of CF2 in ADI_EVB_CF_PERIOD.startCount */
+#define BOARD_CFG_CF2_PERIOD_IDX 1
+/** Index of CF3 in ADI_EVB_CF_PERIOD.startCount */
+#define BOARD_CFG_CF3_PERIOD_IDX 2
+/** DMA request of the CF timer update */
+#define BOARD_CFG_CF_DMA_REQUEST GPDMA1_REQUEST_TIM2_UP
+/** Pin - DREADY capture, wired to DREADY, TIM5_CH2 */
+#define BOARD_CFG_DREADY_CAPTURE_PIN GPIO_PIN_1
+/** Port - DREADY capture */
+#define BOARD_CFG_DREADY_CAPTURE_PORT GPIOA
+/** DREADY capture Pin Alternate Function */
+#define BOARD_CFG_DREADY_CAPTURE_ALT_FUNC GPIO_AF2_TIM5
+/** DMA request of the DREADY capture */
+#define BOARD_CFG_DREADY_CAPTURE_DMA_REQUEST GPDMA1_REQUEST_TIM5_CH2
+/** System timer IRQ Number */
+#define SYSTEM_TIM_IRQn TIM5_IRQn
+/** System timer IRQ Handler */
+#define SYSTEM_TIM_IRQHandler TIM5_IRQHandler
 /**  Timer */
 #define BOARD_CFG_LP_TIMER LPTIM2
 #else
@@ -149,8 +198,55 @@ extern "C" {
 #define CF1_PIN_ALT_FUNC           GPIO_AF2_TIM5
 /** CF IRQ Number */
 #define CF1_TIM_IRQn               TIM5_IRQn
+/** CF IRQ Handler */
+#define CF1_TIM_IRQHandler         TIM5_IRQHandler
+/**  CF2 Timer Channel */
+#define BOARD_CFG_CF2_TIM_CHAN     TIM_CHANNEL_3
+/**  CF3 Timer Channel */
+#define BOARD_CFG_CF3_TIM_CHAN     TIM_CHANNEL_2
+/** Index of CF1 in ADI_EVB_CF_PERIOD.startCount */
+#define BOARD_CFG_CF1_PERIOD_IDX   3
+/** Index of CF2 in ADI_EVB_CF_PERIOD.startCount */
+#define BOARD_CFG_CF2_PERIOD_IDX   2
+/** Index of CF3 in ADI_EVB_CF_PERIOD.startCount */
+#define BOARD_CFG_CF3_PERIOD_IDX   1
+/** DMA request of the CF timer update */
+#define BOARD_CFG_CF_DMA_REQUEST   GPDMA1_REQUEST_TIM5_UP
+/** Pin - DREADY capture, wired to DREADY, TIM2_CH2 */
+#define BOARD_CFG_DREADY_CAPTURE_PIN         GPIO_PIN_1
+/** Port - DREADY capture */
+#define BOARD_CFG_DREADY_CAPTURE_PORT        GPIOA
+/** DREADY capture Pin Alternate Function */
+#define BOARD_CFG_DREADY_CAPTURE_ALT_FUNC    GPIO_AF1_TIM2
+/** DMA request of the DREADY capture */
+#define BOARD_CFG_DREADY_CAPTURE_DMA_REQUEST GPDMA1_REQUEST_TIM2_CH2
+/** System timer IRQ Number */
+#define SYSTEM_TIM_IRQn            TIM2_IRQn
+/** System timer IRQ Handler */
+#define SYSTEM_TIM_IRQHandler      TIM2_IRQHandler
 #endif
 
+/** System timer overflow priority, the handler only counts the wrap */
+#define BOARD_CFG_SYSTEM_TIMER_INTR_PRIORITY 0
+
+/** System timer channel capturing DREADY, channel 1 is the tick compare */
+#define BOARD_CFG_DREADY_CAPTURE_CHAN          TIM_CHANNEL_2
+/** Capture flag of the DREADY channel */
+#define BOARD_CFG_DREADY_CAPTURE_FLAG          TIM_FLAG_CC2
+/** DMA request enable of the DREADY channel */
+#define BOARD_CFG_DREADY_CAPTURE_DMA           TIM_DMA_CC2
+/** DREADY capture DMA priority, the ring is restarted in the interrupt */
+#define BOARD_CFG_DREADY_CAPTURE_INTR_PRIORITY 0
+
+/** Wake timer of the low power idle, runs from the LSI in STOP */
+#define BOARD_CFG_WAKE_TIMER                LPTIM1
+/** Wake timer IRQ Number */
+#define WAKE_TIM_IRQn                       LPTIM1_IRQn
+/** Wake timer IRQ Handler */
+#define WAKE_TIM_IRQHandler                 LPTIM1_IRQHandler
+/** Wake timer priority, the wake is taken with interrupts masked */
+#define BOARD_CFG_WAKE_TIMER_INTR_PRIORITY  15
+
 /** I2C Instance */
 #define BOARD_CFG_I2C_INSTANCE I2C2
 
@@ -70,6 +70,21 @@ int32_t EvbInit(void **phEvb, ADI_EVB_CONFIG *pConfig)
         status = EvbInitGpio(&pEvb->hGpio, &pConfig->gpioConfig);
     }
 #endif
+#if APP_CFG_ENABLE_ADC_SPI_AUTOTUNE == 1
+    if ((status == 0) && (pConfig->spiConfig.pfAdeSpiLinkTest != NULL))
+    {
+#if APP_CFG_ENABLE_GPIO == 1
+        // The ADCs are taken out of reset and have started up before the link test reads from them
+        EvbAdcReset();
+        EvbDelayMs(BOARD_CFG_ADC_STARTUP_DELAY_MS);
+#endif
+        if (EvbAdeSpiAutoTune(pEvb, pConfig->spiConfig.pfAdeSpiLinkTest) != 0)
+        {
+            // A failed tune is not fatal, the ADE SPI runs at the board default clock
+            status = EvbAdeSpiSetClockConfig(pEvb, BOARD_CFG_ADC_SPI_PRESCALER);
+        }
+    }
+#endif
 #if APP_CFG_ENABLE_HOST_UART == 1
     if (status == 0)
     {
@@ -82,6 +97,12 @@ int32_t EvbInit(void **phEvb, ADI_EVB_CONFIG *pConfig)
         status = EvbInitCrc(&pEvb->hCrc, &pConfig->crcConfig);
     }
 #endif
+#if APP_CFG_ENABLE_MEM_DMA == 1
+    if (status == 0)
+    {
+        status = EvbInitMem();
+    }
+#endif
 #if APP_CFG_ENABLE_SYSTEM_TIMER == 1
     if (status == 0)
     {
@@ -135,6 +156,22 @@ static void MX_GPDMA1_Init(void)
     HAL_NVIC_SetPriority(GPDMA1_Channel7_IRQn, APP_CFG_ADC_SPI_INTR_PRIORITY, 0);
     HAL_NVIC_EnableIRQ(GPDMA1_Channel7_IRQn);
 #endif
+#if APP_CFG_ENABLE_MEM_DMA == 1
+    HAL_NVIC_SetPriority(GPDMA1_Channel0_IRQn, APP_CFG_MEM_DMA_INTR_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(GPDMA1_Channel0_IRQn);
+#endif
+#if APP_CFG_ENABLE_HW_CRC == 1
+    HAL_NVIC_SetPriority(GPDMA1_Channel1_IRQn, APP_CFG_CRC_DMA_INTR_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(GPDMA1_Channel1_IRQn);
+#endif
+#if APP_CFG_ENABLE_CF_SERVICE == 1
+    HAL_NVIC_SetPriority(GPDMA1_Channel2_IRQn, APP_CFG_CF_TIMER_INTR_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(GPDMA1_Channel2_IRQn);
+#endif
+#if APP_CFG_ENABLE_DREADY_CAPTURE == 1
+    HAL_NVIC_SetPriority(GPDMA1_Channel3_IRQn, BOARD_CFG_DREADY_CAPTURE_INTR_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(GPDMA1_Channel3_IRQn);
+#endif
 }
 
 static void MX_GPDMA2_Init(void)
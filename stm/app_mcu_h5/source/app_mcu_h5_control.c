@@ -85,8 +85,17 @@ int32_t EvbInitReset(void)
     status = InitLed();
     if (status == ADI_EVB_STATUS_SUCCESS)
     {
+#if APP_CFG_ENABLE_ASYNC_BOOT_LED == 1
+        // Played from the software timers, the system timer must be initialised first
+        status = EvbLedFlashAsync(0, 10, 25);
+        if (status == ADI_EVB_STATUS_SUCCESS)
+        {
+            status = EvbLedFlashAsync(1, 10, 25);
+        }
+#else
         EvbLedFlash(0, 10, 25);
         EvbLedFlash(1, 10, 25);
+#endif
     }
 
     return status;
@@ -96,7 +105,6 @@ int32_t EvbResetAde(void)
 {
     int32_t status = ADI_EVB_STATUS_SUCCESS;
     status = ToggleResetB(1, PULSE_MSEC, WAIT_MSEC);
-    EvbDelayMs(WAIT_MSEC);
     return status;
 }
 
@@ -134,6 +142,37 @@ int32_t EvbSetStandby(uint8_t mode)
     return status;
 }
 
+uint32_t EvbEnterCritical(void)
+{
+    uint32_t state = __get_PRIMASK();
+    __disable_irq();
+    return state;
+}
+
+void EvbExitCritical(uint32_t state)
+{
+    __set_PRIMASK(state);
+}
+
+int32_t EvbInitCycleCounter(void)
+{
+    int32_t status = -1;
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    // Cores without the cycle counter report it in the control register
+    if ((DWT->CTRL & DWT_CTRL_NOCYCCNT_Msk) == 0)
+    {
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        status = 0;
+    }
+    return status;
+}
+
+uint32_t EvbGetCycleCount(void)
+{
+    return DWT->CYCCNT;
+}
+
 int32_t EvbLedOn(uint32_t idx)
 {
     int32_t status = ADI_EVB_STATUS_SUCCESS;
@@ -182,6 +221,21 @@ int32_t EvbLedFlash(uint32_t idx, uint32_t numFlashes, uint32_t flashMs)
     return status;
 }
 
+int32_t EvbSetResetPin(uint32_t idx, uint8_t level)
+{
+    int32_t status = ADI_EVB_STATUS_SUCCESS;
+    if (idx < numReset)
+    {
+        HAL_GPIO_WritePin(resetPins[idx].gpioPort, (uint16_t)resetPins[idx].gpioConfig.Pin,
+                          (level == 0) ? GPIO_PIN_RESET : GPIO_PIN_SET);
+    }
+    else
+    {
+        status = ADI_EVB_STATUS_INVALID_INDEX;
+    }
+    return status;
+}
+
 int32_t InitReset(void)
 {
     int32_t status = ADI_EVB_STATUS_SUCCESS;
@@ -123,6 +123,20 @@ int32_t EvbEnableDreadyIrq(uint8_t enable)
     return status;
 }
 
+int32_t EvbGpioWriteMask(uint32_t port, uint32_t setMask, uint32_t clearMask)
+{
+    int32_t status = -1;
+    GPIO_TypeDef *pPort = (GPIO_TypeDef *)port;
+    if ((pPort != NULL) && (((setMask | clearMask) & 0xFFFF0000u) == 0) &&
+        ((setMask & clearMask) == 0))
+    {
+        // BSRR sets the pins of the low half and resets those of the high half in one write
+        pPort->BSRR = setMask | (clearMask << 16);
+        status = 0;
+    }
+    return status;
+}
+
 void EvbAdcReset(void)
 {
     if (BOARD_CFG_ADC_RESET_PIN)
@@ -135,10 +149,17 @@ void EvbAdcReset(void)
 
 void EXTI2_IRQHandler(void)
 {
+    uint32_t unhandled;
     /* EXTI line interrupt detected */
     if (__HAL_GPIO_EXTI_GET_FALLING_IT(BOARD_CFG_ADC_DREADY_PIN) != 0U)
     {
         __HAL_GPIO_EXTI_CLEAR_FALLING_IT(BOARD_CFG_ADC_DREADY_PIN);
-        gpioInfo.pfGpioCallback((uint32_t)BOARD_CFG_ADC_DREADY_PORT, BOARD_CFG_ADC_DREADY_PIN);
+        // DREADY has the line to itself, its callback is called without a table walk
+        unhandled = EvbGpioDispatchPin((uint32_t)BOARD_CFG_ADC_DREADY_PORT,
+                                       BOARD_CFG_ADC_DREADY_PIN);
+        if ((unhandled != 0) && (gpioInfo.pfGpioCallback != NULL))
+        {
+            gpioInfo.pfGpioCallback((uint32_t)BOARD_CFG_ADC_DREADY_PORT, unhandled);
+        }
     }
 }
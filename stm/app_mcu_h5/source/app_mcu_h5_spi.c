@@ -20,6 +20,21 @@
 
 /*=============  D E F I N I T I O N S  =============*/
 
+/** FRAM read opcode */
+#define FRAM_OPCODE_READ 0x03u
+/** FRAM write opcode */
+#define FRAM_OPCODE_WRITE 0x02u
+/** FRAM write enable opcode */
+#define FRAM_OPCODE_WREN 0x06u
+/** Num of bytes for opcode and 3 byte address */
+#define FRAM_CMD_SIZE 4u
+/** Wait count for the blocking FRAM transfers of the tuning record */
+#define FRAM_TUNE_TIMEOUT 0x100000u
+/** Marks a valid ADE SPI tuning record */
+#define ADE_SPI_TUNE_MAGIC 0x53504954u
+/** Num of words in the tuning record, magic, clock config and its complement */
+#define ADE_SPI_TUNE_NUM_WORDS 3u
+
 /** Evb spi info */
 typedef struct
 {
@@ -29,6 +44,8 @@ typedef struct
     ADI_EVB_CALLBACK pfFramSpiRxCallback;
     /** callback */
     ADI_EVB_CALLBACK pfFramSpiTxCallback;
+    /** set while the tuning record is accessed, the FRAM callbacks are not called */
+    volatile uint8_t isTuneXfer;
 
 } EVB_SPI_INFO;
 
@@ -48,6 +65,8 @@ int32_t EvbFramSlaveSelectConfig(void);
 static int32_t InitFramSpi(ADI_EVB_SPI_CONFIG *pConfig);
 static void FramSpiTxRxCallBack(SPI_HandleTypeDef *hspi);
 static void FramSpiTxCallBack(SPI_HandleTypeDef *hspi);
+static int32_t ReadTuneRecord(void *hEvb, uint32_t *pClkConfig);
+static int32_t WriteTuneRecord(void *hEvb, uint32_t clkConfig);
 
 /*=============  D A T A  =============*/
 
@@ -61,7 +80,10 @@ int32_t EvbInitSpi(void **phSpi, ADI_EVB_SPI_CONFIG *pConfig)
     int32_t status = 0;
 
     status = EvbInitAdeSpi(phSpi, pConfig);
-    status = InitFramSpi(pConfig);
+    if (status == 0)
+    {
+        status = InitFramSpi(pConfig);
+    }
     if (status == 0)
     {
         /* Just a keeping a API provision to support multiple SPIs later*/
@@ -133,6 +155,128 @@ int32_t EvbNvmWrite(void *hEvb, uint8_t *pData, uint32_t numBytes, uint32_t time
     return status;
 }
 
+int32_t EvbFramSpiSetFrequency(void *hEvb, uint32_t spiFrequency)
+{
+    int32_t status = -1;
+    STM_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.framSpiInfo;
+    if (hEvb != NULL)
+    {
+        status = StmSetSpiFrequency(pSpiInfo, spiFrequency);
+    }
+
+    return status;
+}
+
+int32_t EvbFramSpiGetClockConfig(void *hEvb, uint32_t spiFrequency, uint32_t *pClkConfig)
+{
+    int32_t status = -1;
+    STM_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.framSpiInfo;
+    if ((hEvb != NULL) && (pClkConfig != NULL))
+    {
+        status = StmGetSpiPrescaler(pSpiInfo, spiFrequency, pClkConfig);
+    }
+
+    return status;
+}
+
+int32_t EvbFramSpiSetClockConfig(void *hEvb, uint32_t clkConfig)
+{
+    int32_t status = -1;
+    STM_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.framSpiInfo;
+    if (hEvb != NULL)
+    {
+        status = StmSetSpiPrescaler(pSpiInfo, clkConfig);
+    }
+
+    return status;
+}
+
+int32_t EvbAdeSpiAutoTune(void *hEvb, ADI_EVB_SPI_LINK_TEST pfLinkTest)
+{
+    int32_t status = -1;
+    uint32_t clkConfig;
+    if ((hEvb != NULL) && (pfLinkTest != NULL))
+    {
+        status = ReadTuneRecord(hEvb, &clkConfig);
+        if (status == 0)
+        {
+            status = EvbAdeSpiSetClockConfig(hEvb, clkConfig);
+        }
+        if (status == 0)
+        {
+            status = pfLinkTest(hEvb, BOARD_CFG_ADC_SPI_TUNE_VERIFY_READS);
+        }
+        if (status != 0)
+        {
+            // No valid record or the cached clock no longer works, tune again
+            status = EvbAdeSpiTuneFrequency(hEvb, pfLinkTest, BOARD_CFG_ADC_SPI_TUNE_NUM_READS,
+                                            &clkConfig);
+            if (status == 0)
+            {
+                status = WriteTuneRecord(hEvb, clkConfig);
+            }
+        }
+    }
+
+    return status;
+}
+
+int32_t ReadTuneRecord(void *hEvb, uint32_t *pClkConfig)
+{
+    int32_t status;
+    uint8_t txData[FRAM_CMD_SIZE + (ADE_SPI_TUNE_NUM_WORDS * 4u)] = {0};
+    uint8_t rxData[FRAM_CMD_SIZE + (ADE_SPI_TUNE_NUM_WORDS * 4u)];
+    uint32_t record[ADE_SPI_TUNE_NUM_WORDS];
+
+    txData[0] = FRAM_OPCODE_READ;
+    txData[1] = (uint8_t)(BOARD_CFG_FRAM_SPI_TUNE_ADDR >> 16);
+    txData[2] = (uint8_t)(BOARD_CFG_FRAM_SPI_TUNE_ADDR >> 8);
+    txData[3] = (uint8_t)BOARD_CFG_FRAM_SPI_TUNE_ADDR;
+    evbSpiInfo.isTuneXfer = 1;
+    status = EvbNvmRead(hEvb, txData, rxData, sizeof(txData), FRAM_TUNE_TIMEOUT);
+    evbSpiInfo.isTuneXfer = 0;
+    if (status == 0)
+    {
+        memcpy(record, &rxData[FRAM_CMD_SIZE], sizeof(record));
+        if ((record[0] == ADE_SPI_TUNE_MAGIC) && (record[1] == ~record[2]))
+        {
+            *pClkConfig = record[1];
+        }
+        else
+        {
+            status = -1;
+        }
+    }
+
+    return status;
+}
+
+int32_t WriteTuneRecord(void *hEvb, uint32_t clkConfig)
+{
+    int32_t status;
+    uint8_t txData[FRAM_CMD_SIZE + (ADE_SPI_TUNE_NUM_WORDS * 4u)];
+    uint32_t record[ADE_SPI_TUNE_NUM_WORDS];
+
+    record[0] = ADE_SPI_TUNE_MAGIC;
+    record[1] = clkConfig;
+    record[2] = ~clkConfig;
+    txData[0] = FRAM_OPCODE_WREN;
+    evbSpiInfo.isTuneXfer = 1;
+    status = EvbNvmWrite(hEvb, txData, 1u, FRAM_TUNE_TIMEOUT);
+    if (status == 0)
+    {
+        txData[0] = FRAM_OPCODE_WRITE;
+        txData[1] = (uint8_t)(BOARD_CFG_FRAM_SPI_TUNE_ADDR >> 16);
+        txData[2] = (uint8_t)(BOARD_CFG_FRAM_SPI_TUNE_ADDR >> 8);
+        txData[3] = (uint8_t)BOARD_CFG_FRAM_SPI_TUNE_ADDR;
+        memcpy(&txData[FRAM_CMD_SIZE], record, sizeof(record));
+        status = EvbNvmWrite(hEvb, txData, sizeof(txData), FRAM_TUNE_TIMEOUT);
+    }
+    evbSpiInfo.isTuneXfer = 0;
+
+    return status;
+}
+
 int32_t InitFramSpi(ADI_EVB_SPI_CONFIG *pConfig)
 {
     int32_t status = 0;
@@ -140,10 +284,13 @@ int32_t InitFramSpi(ADI_EVB_SPI_CONFIG *pConfig)
     evbSpiInfo.pfFramSpiRxCallback = pConfig->pfFramSpiRxCallback;
     evbSpiInfo.pfFramSpiTxCallback = pConfig->pfFramSpiTxCallback;
     pStmSpiInfo->pSpi = BOARD_CFG_FRAM_SPI;
-    pStmSpiInfo->prescaler = BOARD_CFG_ADC_SPI_PRESCALER;
+    pStmSpiInfo->prescaler = BOARD_CFG_FRAM_SPI_PRESCALER;
     pStmSpiInfo->master = SPI_MODE_MASTER;
-    pStmSpiInfo->clkPol = BOARD_CFG_ADC_SPI_CLK_POL;
-    pStmSpiInfo->clkPha = BOARD_CFG_ADC_SPI_CLK_PHA;
+    pStmSpiInfo->clkPol = BOARD_CFG_FRAM_SPI_CLK_POL;
+    pStmSpiInfo->clkPha = BOARD_CFG_FRAM_SPI_CLK_PHA;
+    pStmSpiInfo->dataSize = SPI_DATASIZE_8BIT;
+    pStmSpiInfo->fifoThreshold = SPI_FIFO_THRESHOLD_01DATA;
+    pStmSpiInfo->crcCalculation = SPI_CRCCALCULATION_DISABLE;
     pStmSpiInfo->phSpi = &hFramSpi;
     pStmSpiInfo->master = SPI_MODE_MASTER;
     pStmSpiInfo->suspendState = 1;
@@ -184,7 +331,7 @@ void FramSpiTxRxCallBack(SPI_HandleTypeDef *hspi)
         {
             pSpiInfo->suspendState = 0;
         }
-        if (evbSpiInfo.pfFramSpiRxCallback != NULL)
+        if ((evbSpiInfo.pfFramSpiRxCallback != NULL) && (evbSpiInfo.isTuneXfer == 0))
         {
             evbSpiInfo.pfFramSpiRxCallback();
         }
@@ -201,7 +348,7 @@ void FramSpiTxCallBack(SPI_HandleTypeDef *hspi)
         {
             pSpiInfo->suspendState = 0;
         }
-        if (evbSpiInfo.pfFramSpiTxCallback != NULL)
+        if ((evbSpiInfo.pfFramSpiTxCallback != NULL) && (evbSpiInfo.isTuneXfer == 0))
         {
 
             evbSpiInfo.pfFramSpiTxCallback();
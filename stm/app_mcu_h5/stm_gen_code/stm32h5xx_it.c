@@ -82,6 +82,10 @@ extern DMA_HandleTypeDef hFramDMASPITx;
 extern DMA_HandleTypeDef hFramDMASPIRx;
 extern DMA_HandleTypeDef hDMAUARTTx;
 extern DMA_HandleTypeDef hDMAI2CTx;
+extern DMA_HandleTypeDef hMemDMA;
+extern DMA_HandleTypeDef hCrcDMA;
+extern DMA_HandleTypeDef hCfDMA;
+extern DMA_HandleTypeDef hDreadyDMA;
 /* USER CODE BEGIN EV */
 
 /* USER CODE END EV */
@@ -377,18 +381,76 @@ void GPDMA1_Channel5_IRQHandler(void)
 }
 #endif
 
+#if APP_CFG_ENABLE_MEM_DMA == 1
+/**
+ * @brief This function handles GPDMA1 Channel 0 global interrupt.
+ */
+void GPDMA1_Channel0_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&hMemDMA);
+}
+#endif
+
+#if APP_CFG_ENABLE_HW_CRC == 1
+/**
+ * @brief This function handles GPDMA1 Channel 1 global interrupt.
+ */
+void GPDMA1_Channel1_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&hCrcDMA);
+}
+#endif
+
 #if APP_CFG_ENABLE_CF_SERVICE == 1
 /**
  * @brief IRQ Handler for CF1 timer
  *
  */
-void TIM5_IRQHandler(void)
+void CF1_TIM_IRQHandler(void)
 {
     if (StmCf1Handler())
     {
         Cf1Callback();
     }
 }
+
+/**
+ * @brief This function handles GPDMA1 Channel 2 global interrupt.
+ */
+void GPDMA1_Channel2_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&hCfDMA);
+}
+#endif
+
+#if APP_CFG_ENABLE_SYSTEM_TIMER == 1
+/**
+ * @brief IRQ Handler for the system timer overflow
+ *
+ */
+void SYSTEM_TIM_IRQHandler(void)
+{
+    StmSystemTimerHandler();
+}
+
+/**
+ * @brief IRQ Handler for the low power idle wake timer
+ *
+ */
+void WAKE_TIM_IRQHandler(void)
+{
+    StmWakeTimerHandler();
+}
+#endif
+
+#if APP_CFG_ENABLE_DREADY_CAPTURE == 1
+/**
+ * @brief This function handles GPDMA1 Channel 3 global interrupt.
+ */
+void GPDMA1_Channel3_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&hDreadyDMA);
+}
 #endif
 /* USER CODE BEGIN 1 */
 
@@ -17,6 +17,7 @@ extern "C" {
 #endif
 
 /*============= I N C L U D E S =============*/
+#include "adi_evb_timer.h"
 #include "stm32h5xx_hal.h"
 #include <stdint.h>
 
@@ -30,12 +31,82 @@ uint32_t StmTimerInit(TIM_TypeDef *pTmr);
  * @return      status
  */
 uint32_t StmLpTimerInit(LPTIM_TypeDef *pLpTmr);
+/**
+ * @brief       Wake timer init, for the low power idle
+ * @return      status
+ */
+uint32_t StmWakeTimerInit(LPTIM_TypeDef *pLpTmr);
+
+/**
+ * @brief  Enters SLEEP or STOP with interrupts masked. The tick is suspended and the wake
+ * timer set when a sleep time is given, the system timer is advanced by the time in STOP.
+ * @param[in]  isStop - 1 for STOP, 0 for SLEEP
+ * @param[in]  sleepUs - time to the wake timer deadline, 0 for none
+ * @return  1 if woken by the wake timer, 0 if woken by another interrupt, negative on error
+ */
+int32_t StmEnterLowPower(uint8_t isStop, uint32_t sleepUs);
+
+/**
+ * @brief  Clears the wake timer flag, called from the wake timer interrupt
+ */
+void StmWakeTimerHandler(void);
 /**
  * @brief  Get timer value (in ticks)
  * @return  status
  */
 uint32_t StmGetTime(TIM_TypeDef *pTmr);
 
+/**
+ * @brief  Get timer value in ticks, extended with the counted overflows
+ * @return  ticks since the timer was started
+ */
+uint64_t StmGetTime64(TIM_TypeDef *pTmr);
+
+/**
+ * @brief  Get the tick rate of the timer
+ * @return  frequency in Hz
+ */
+uint32_t StmGetTimerFrequency(void);
+
+/**
+ * @brief  Counts a system timer overflow and runs the software timer tick,
+ * called from the timer interrupt
+ */
+void StmSystemTimerHandler(void);
+
+/**
+ * @brief  Starts the 1 ms tick on compare channel 1 of the system timer
+ */
+void StmStartTickTimer(void);
+
+/**
+ * @brief  Stops the 1 ms tick
+ */
+void StmStopTickTimer(void);
+
+/**
+ * @brief  Starts the DMA of the DREADY captures of the system timer to a ring
+ * @return  0 on success
+ */
+int32_t StmStartDreadyCapture(uint32_t *pRing, uint32_t numEntries);
+
+/**
+ * @brief  Stops the DREADY capture
+ */
+void StmStopDreadyCapture(void);
+
+/**
+ * @brief  Get the num of DREADY edges captured since the start
+ * @return  num of captures
+ */
+uint32_t StmGetDreadyCaptureCount(void);
+
+/**
+ * @brief  Converts a captured counter value to ticks since the timer was started
+ * @return  ticks
+ */
+uint64_t StmCaptureToTime64(uint32_t count);
+
 /**
  * @brief  start timer
  */
@@ -83,6 +154,18 @@ void StmStartCf1Timer(uint32_t startCount, uint32_t endCount);
  */
 void StmStopCf1Timer(void);
 
+/**
+ * @brief Start the CF outputs from a buffer of periods streamed by DMA burst
+ * @return  0 on success
+ */
+int32_t StmStartCfBurst(ADI_EVB_CF_PERIOD *pPeriods, uint32_t numPeriods,
+                        ADI_EVB_CF_BURST_CALLBACK pfCallback);
+
+/**
+ * @brief Stop the CF outputs started with StmStartCfBurst
+ */
+void StmStopCfBurst(void);
+
 /**
  * @brief IRQ Handler for CF1 timer
  *
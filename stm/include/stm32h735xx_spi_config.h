@@ -32,6 +32,16 @@ typedef struct
     uint32_t master;
     /** spi speed: (SysClk / prescaler) Hz */
     uint32_t prescaler;
+    /** spi kernel clock in Hz, read once after initialisation */
+    uint32_t kernelClk;
+    /** frame size in SPI_DATASIZE_xBIT format */
+    uint32_t dataSize;
+    /** frames per packet in SPI_FIFO_THRESHOLD_xxDATA format */
+    uint32_t fifoThreshold;
+    /** bytes occupied by a frame in memory */
+    uint32_t frameBytes;
+    /** hardware crc, SPI_CRCCALCULATION_ENABLE or SPI_CRCCALCULATION_DISABLE */
+    uint32_t crcCalculation;
     /** clk polarity */
     uint32_t clkPol;
     /** clk phase*/
@@ -93,6 +103,51 @@ int32_t StmStartSpiTxRxDMA(STM_SPI_INSTANCE *pSpiInfo, uint8_t *pTxData, uint8_t
  */
 int32_t StmSetSpiFrequency(STM_SPI_INSTANCE *pSpiInfo, uint32_t spiFrequency);
 
+/**
+ * @brief       Computes the baudrate prescaler for a spi frequency
+ * @param[in]   pSpiInfo  -  Pointer to spi instance struct
+ * @param[in]   spiFrequency -  spi frequency in Hz
+ * @param[out]  pPrescaler -  prescaler in SPI_CFG1_MBR format
+ * The prescaler is computed from the kernel clock of the instance, so it can be
+ * computed once and applied with #StmSetSpiPrescaler whenever required.
+ * @return      status
+ */
+int32_t StmGetSpiPrescaler(STM_SPI_INSTANCE *pSpiInfo, uint32_t spiFrequency,
+                           uint32_t *pPrescaler);
+
+/**
+ * @brief       Sets the baudrate prescaler of the spi
+ * @param[in]   pSpiInfo  -  Pointer to spi instance struct
+ * @param[in]   prescaler -  prescaler in SPI_CFG1_MBR format
+ * Only CFG1.MBR is written, the peripheral is not reinitialised. Fails if a
+ * transfer is in progress.
+ * @return      status
+ */
+int32_t StmSetSpiPrescaler(STM_SPI_INSTANCE *pSpiInfo, uint32_t prescaler);
+
+/**
+ * @brief       Sets the frame size and packet size of the spi
+ * @param[in]   pSpiInfo  -  Pointer to spi instance struct
+ * @param[in]   dataSize -  frame size in SPI_DATASIZE_xBIT format
+ * @param[in]   fifoThreshold -  frames per packet, only SPI_FIFO_THRESHOLD_01DATA is supported
+ * The DMA data width follows the frame size. Frames wider than 16 bits occupy 4 bytes in
+ * memory. The DMA streams move single beats, so any other fifoThreshold is rejected. Fails
+ * if a transfer is in progress.
+ * @return      status
+ */
+int32_t StmSetSpiDataSize(STM_SPI_INSTANCE *pSpiInfo, uint32_t dataSize, uint32_t fifoThreshold);
+
+/**
+ * @brief       Spreads the received frames over rows of a structure-of-arrays buffer
+ * @param[in]   pSpiInfo -  pointer to spi instance
+ * @param[in]   rxStride -  distance in bytes between the destinations of consecutive frames
+ * of a transfer, 0 for contiguous reception
+ * Frame j of a transfer lands at pRxData + j * rxStride. The stride must be a multiple of
+ * the frame size. Fails if a transfer is in progress.
+ * @return      status
+ */
+int32_t StmSetSpiRxStride(STM_SPI_INSTANCE *pSpiInfo, uint32_t rxStride);
+
 /**
  * @brief       Slave select pin configuration
  * @param[in]   pSpiInfo  Pointer to spi instance struct
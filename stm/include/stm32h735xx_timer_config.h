@@ -17,6 +17,7 @@ extern "C" {
 #endif
 
 /*============= I N C L U D E S =============*/
+#include "adi_evb_timer.h"
 #include "stm32h7xx_hal.h"
 #include <stdint.h>
 
@@ -32,6 +33,57 @@ uint32_t StmTimerInit(TIM_TypeDef *pTmr);
  */
 uint32_t StmGetTime(TIM_TypeDef *pTmr);
 
+/**
+ * @brief  Get timer value in ticks, extended with the counted overflows
+ * @return  ticks since the timer was started
+ */
+uint64_t StmGetTime64(TIM_TypeDef *pTmr);
+
+/**
+ * @brief  Get the tick rate of the timer
+ * @return  frequency in Hz
+ */
+uint32_t StmGetTimerFrequency(void);
+
+/**
+ * @brief  Counts a system timer overflow and runs the software timer tick,
+ * called from the timer interrupt
+ */
+void StmSystemTimerHandler(void);
+
+/**
+ * @brief  Starts the 1 ms tick on compare channel 1 of the system timer
+ */
+void StmStartTickTimer(void);
+
+/**
+ * @brief  Stops the 1 ms tick
+ */
+void StmStopTickTimer(void);
+
+/**
+ * @brief  Starts the DMA of the DREADY captures of the system timer to a ring
+ * @return  0 on success
+ */
+int32_t StmStartDreadyCapture(uint32_t *pRing, uint32_t numEntries);
+
+/**
+ * @brief  Stops the DREADY capture
+ */
+void StmStopDreadyCapture(void);
+
+/**
+ * @brief  Get the num of DREADY edges captured since the start
+ * @return  num of captures
+ */
+uint32_t StmGetDreadyCaptureCount(void);
+
+/**
+ * @brief  Converts a captured counter value to ticks since the timer was started
+ * @return  ticks
+ */
+uint64_t StmCaptureToTime64(uint32_t count);
+
 /**
  * @brief  start timer
  */
@@ -69,6 +121,18 @@ void StmStartCf1Timer(uint32_t startCount, uint32_t endCount);
  */
 void StmStopCf1Timer(void);
 
+/**
+ * @brief Start the CF outputs from a buffer of periods streamed by DMA burst
+ * @return  0 on success
+ */
+int32_t StmStartCfBurst(ADI_EVB_CF_PERIOD *pPeriods, uint32_t numPeriods,
+                        ADI_EVB_CF_BURST_CALLBACK pfCallback);
+
+/**
+ * @brief Stop the CF outputs started with StmStartCfBurst
+ */
+void StmStopCfBurst(void);
+
 /**
  * @brief IRQ Handler for CF1 timer
  *
@@ -87,6 +151,14 @@ void StmSetLptimOutput(void);
  */
 uint32_t StmLpTimerInit(LPTIM_TypeDef *pLpTmr);
 
+/**
+ * @brief  Enters SLEEP with interrupts masked, the tick keeps running
+ * @param[in]  isStop - 1 for STOP, not supported
+ * @param[in]  sleepUs - time to the next deadline, unused
+ * @return  0 after a wake, negative if the mode is not supported
+ */
+int32_t StmEnterLowPower(uint8_t isStop, uint32_t sleepUs);
+
 /**
  * @brief  start timer
  */
@@ -9,6 +9,7 @@
  */
 /*============= I N C L U D E S =============*/
 
+#include "adi_evb.h"
 #include "app_cfg.h"
 #include "board_cfg.h"
 #include "stm32h563xx_timer_config.h"
@@ -18,14 +19,76 @@
 #include <stdint.h>
 
 /*=============  D E F I N I T I O N S  =============*/
+/** System timer tick rate in Hz */
+#define TIMER_FREQUENCY 25000000u
+/** Ticks per counter period, ARR + 1 */
+#define TIMER_PERIOD    0xFFFFFFFFull
+/** Counts per software timer tick of 1 ms */
+#define TICK_COUNTS     (TIMER_FREQUENCY / 1000u)
+/** Longest wake timer period, 16 bit counter */
+#define WAKE_MAX_COUNTS 0xFFFFu
+/** Most periods in one DMA transfer, the transfer length in bytes is limited to 16 bits */
+#define CF_MAX_BURST_PERIODS (0xFFFFu / (ADI_EVB_CF_BURST_WORDS * sizeof(uint32_t)))
+/** Most entries of the DREADY capture ring, the transfer length is limited to 16 bits */
+#define CAPTURE_MAX_ENTRIES (0xFFFFu / sizeof(uint32_t))
+
 /** Handler for Timer */
 static TIM_HandleTypeDef hTim;
+/** System timer overflows since the timer was started */
+static volatile uint32_t timerOverflows;
+/** Counts a pending overflow, called with interrupts masked */
+static void CountOverflow(void);
+/** Advances the tick compare and the software timers */
+static void HandleTick(void);
+/** Adds counts to a counter value, modulo the counter period */
+static uint32_t AddCounts(uint32_t count, uint32_t numCounts);
+/** Counts elapsed since a counter value, modulo the counter period */
+static uint32_t CountsSince(uint32_t count);
 /** Handler for Timer */
 static LPTIM_HandleTypeDef hLpTim2;
+/** Handler for the wake timer */
+static LPTIM_HandleTypeDef hWakeTim;
+/** Reads the wake timer counter, which runs from an asynchronous clock */
+static uint32_t ReadWakeCounter(void);
+/** Advances the system timer by counts of the wake timer, for the time spent in STOP */
+static void AdvanceTimer(uint32_t wakeCounts);
 /** Handler for PWM Timer */
 static TIM_HandleTypeDef hPwmTim;
 /** GPIO Initialization for CF Timer */
 static void StmCf1GpioInit(TIM_HandleTypeDef *pCf1Tim);
+/** DMA streaming CF periods into the CF timer */
+DMA_HandleTypeDef hCfDMA;
+/** Callback for the next buffer of CF periods */
+static ADI_EVB_CF_BURST_CALLBACK pfCfBurstCallback;
+/** Timer channels of CF1, CF2 and CF3 */
+static const uint32_t cfChannels[] = {BOARD_CFG_CF1_TIM_CHAN, BOARD_CFG_CF2_TIM_CHAN,
+                                      BOARD_CFG_CF3_TIM_CHAN};
+/** Num of CF outputs */
+static const uint32_t numCf = (sizeof(cfChannels) / sizeof(cfChannels[0]));
+/** DMA Initialization for CF Timer */
+static int32_t InitCfDma(void);
+/** Starts streaming a buffer of CF periods */
+static int32_t StartCfDma(ADI_EVB_CF_PERIOD *pPeriods, uint32_t numPeriods);
+/** Writes a CF period to the timer registers */
+static void LoadCfPeriod(ADI_EVB_CF_PERIOD *pPeriod);
+/** Enables or disables the preload of the CF timer registers */
+static void SetCfPreload(uint32_t enable);
+/** Called when the DMA has loaded the last period of a buffer */
+static void CfBurstCallBack(TIM_HandleTypeDef *pTim);
+/** DMA copying the DREADY captures to the ring */
+DMA_HandleTypeDef hDreadyDMA;
+/** Ring of DREADY captures */
+static uint32_t *pCaptureRing;
+/** Num of entries in the capture ring, 0 when the capture is stopped */
+static volatile uint32_t numCaptureEntries;
+/** Num of times the capture ring was filled */
+static volatile uint32_t numCaptureWraps;
+/** Capture channel, GPIO and DMA Initialization for the DREADY capture */
+static int32_t InitDreadyCapture(void);
+/** Address of the capture register of the DREADY channel */
+static uint32_t CaptureRegAddress(void);
+/** Called when the DMA has filled the capture ring */
+static void CaptureDmaCallBack(DMA_HandleTypeDef *pDma);
 
 /*=============  C O D E  =============*/
 uint32_t StmTimerInit(TIM_TypeDef *pTmr)
@@ -40,6 +103,17 @@ uint32_t StmTimerInit(TIM_TypeDef *pTmr)
     hTim.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
 
     halStatus = HAL_TIM_Base_Init(&hTim);
+    // Overflows are counted in the interrupt so that the 64 bit time never misses a wrap
+    __HAL_TIM_CLEAR_FLAG(&hTim, TIM_FLAG_UPDATE);
+    __HAL_TIM_ENABLE_IT(&hTim, TIM_IT_UPDATE);
+    HAL_NVIC_SetPriority(SYSTEM_TIM_IRQn, BOARD_CFG_SYSTEM_TIMER_INTR_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(SYSTEM_TIM_IRQn);
+#if APP_CFG_ENABLE_DREADY_CAPTURE == 1
+    if ((halStatus == HAL_OK) && (InitDreadyCapture() != 0))
+    {
+        halStatus = HAL_ERROR;
+    }
+#endif
     return (uint32_t)halStatus;
 }
 
@@ -62,6 +136,28 @@ uint32_t StmLpTimerInit(LPTIM_TypeDef *pLpTmr)
     return (uint32_t)halStatus;
 }
 
+uint32_t StmWakeTimerInit(LPTIM_TypeDef *pLpTmr)
+{
+    HAL_StatusTypeDef halStatus;
+
+    __HAL_RCC_LPTIM1_CONFIG(RCC_LPTIM1CLKSOURCE_LSI);
+    __HAL_RCC_LSI_ENABLE();
+    __HAL_RCC_LPTIM1_CLK_ENABLE();
+
+    hWakeTim.Instance = pLpTmr;
+    hWakeTim.Init.Clock.Source = LPTIM_CLOCKSOURCE_APBCLOCK_LPOSC;
+    hWakeTim.Init.Clock.Prescaler = LPTIM_PRESCALER_DIV1;
+    hWakeTim.Init.Trigger.Source = LPTIM_TRIGSOURCE_SOFTWARE;
+    hWakeTim.Init.Period = WAKE_MAX_COUNTS;
+    hWakeTim.Init.UpdateMode = LPTIM_UPDATE_IMMEDIATE;
+    hWakeTim.Init.CounterSource = LPTIM_COUNTERSOURCE_INTERNAL;
+    halStatus = HAL_LPTIM_Init(&hWakeTim);
+    HAL_NVIC_SetPriority(WAKE_TIM_IRQn, BOARD_CFG_WAKE_TIMER_INTR_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(WAKE_TIM_IRQn);
+
+    return (uint32_t)halStatus;
+}
+
 uint32_t StmGetTime(TIM_TypeDef *pTmr)
 {
     uint32_t timerCnt = 0;
@@ -72,10 +168,343 @@ uint32_t StmGetTime(TIM_TypeDef *pTmr)
     return timerCnt;
 }
 
+uint64_t StmGetTime64(TIM_TypeDef *pTmr)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t timerCnt = 0;
+    uint64_t ticks = 0;
+    if (pTmr != NULL)
+    {
+        __disable_irq();
+        timerCnt = __HAL_TIM_GET_COUNTER(&hTim);
+        // A wrap not yet counted makes the count read above ambiguous
+        if (__HAL_TIM_GET_FLAG(&hTim, TIM_FLAG_UPDATE))
+        {
+            CountOverflow();
+            timerCnt = __HAL_TIM_GET_COUNTER(&hTim);
+        }
+        ticks = ((uint64_t)timerOverflows * TIMER_PERIOD) + timerCnt;
+        __set_PRIMASK(primask);
+    }
+    return ticks;
+}
+
+uint32_t StmGetTimerFrequency(void)
+{
+    return TIMER_FREQUENCY;
+}
+
+void StmSystemTimerHandler(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    CountOverflow();
+    __set_PRIMASK(primask);
+    if ((__HAL_TIM_GET_IT_SOURCE(&hTim, TIM_IT_CC1) != RESET) &&
+        __HAL_TIM_GET_FLAG(&hTim, TIM_FLAG_CC1))
+    {
+        HandleTick();
+    }
+}
+
+void StmStartTickTimer(void)
+{
+    uint32_t compare = AddCounts(__HAL_TIM_GET_COUNTER(&hTim), TICK_COUNTS);
+    // Channel 1 is left in its reset state, a frozen output compare without a pin
+    __HAL_TIM_SET_COMPARE(&hTim, TIM_CHANNEL_1, compare);
+    __HAL_TIM_CLEAR_FLAG(&hTim, TIM_FLAG_CC1);
+    __HAL_TIM_ENABLE_IT(&hTim, TIM_IT_CC1);
+}
+
+void StmStopTickTimer(void)
+{
+    __HAL_TIM_DISABLE_IT(&hTim, TIM_IT_CC1);
+    __HAL_TIM_CLEAR_FLAG(&hTim, TIM_FLAG_CC1);
+}
+
+int32_t StmEnterLowPower(uint8_t isStop, uint32_t sleepUs)
+{
+    int32_t wake = 0;
+    uint32_t wakeCounts = 0;
+    uint32_t elapsedCounts = 0;
+    uint32_t isTickEnabled = 0;
+
+    if ((sleepUs > 0) && (hWakeTim.Instance != NULL) && (hTim.Instance != NULL))
+    {
+        wakeCounts = (uint32_t)(((uint64_t)sleepUs * LSI_VALUE) / 1000000u);
+        wakeCounts = (wakeCounts < WAKE_MAX_COUNTS) ? wakeCounts : WAKE_MAX_COUNTS;
+    }
+    // Time in STOP is only known from the wake timer
+    if ((isStop == 1) && (wakeCounts < 2))
+    {
+        wake = -1;
+    }
+    else
+    {
+        if (wakeCounts >= 2)
+        {
+            // The tick compare is kept, so the ticks missed in the sleep are run on resume.
+            // The HAL tick is suspended too and does not count the time asleep.
+            isTickEnabled = __HAL_TIM_GET_IT_SOURCE(&hTim, TIM_IT_CC1);
+            __HAL_TIM_DISABLE_IT(&hTim, TIM_IT_CC1);
+            HAL_SuspendTick();
+            hWakeTim.Init.Period = wakeCounts - 1;
+            HAL_LPTIM_Counter_Start_IT(&hWakeTim);
+        }
+        if (isStop == 1)
+        {
+            HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+        }
+        else
+        {
+            HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+        }
+        if (wakeCounts >= 2)
+        {
+            if (__HAL_LPTIM_GET_FLAG(&hWakeTim, LPTIM_FLAG_ARRM))
+            {
+                wake = 1;
+                elapsedCounts = wakeCounts;
+            }
+            else
+            {
+                elapsedCounts = ReadWakeCounter();
+            }
+            HAL_LPTIM_Counter_Stop_IT(&hWakeTim);
+            __HAL_LPTIM_CLEAR_FLAG(&hWakeTim, LPTIM_FLAG_ARRM);
+            HAL_NVIC_ClearPendingIRQ(WAKE_TIM_IRQn);
+            if (isStop == 1)
+            {
+                AdvanceTimer(elapsedCounts);
+            }
+            HAL_ResumeTick();
+            if (isTickEnabled != 0)
+            {
+                // A counter moved past the compare by software does not raise the flag
+                if (CountsSince(__HAL_TIM_GET_COMPARE(&hTim, TIM_CHANNEL_1)) < (TIMER_PERIOD / 2))
+                {
+                    hTim.Instance->EGR = TIM_EGR_CC1G;
+                }
+                __HAL_TIM_ENABLE_IT(&hTim, TIM_IT_CC1);
+            }
+        }
+    }
+    return wake;
+}
+
+void StmWakeTimerHandler(void)
+{
+    __HAL_LPTIM_CLEAR_FLAG(&hWakeTim, LPTIM_FLAG_ARRM);
+}
+
+uint32_t ReadWakeCounter(void)
+{
+    uint32_t count;
+    uint32_t prevCount;
+
+    // Two equal reads are needed, the counter clock is not synchronous with the bus
+    count = HAL_LPTIM_ReadCounter(&hWakeTim);
+    do
+    {
+        prevCount = count;
+        count = HAL_LPTIM_ReadCounter(&hWakeTim);
+    } while (count != prevCount);
+    return count;
+}
+
+void AdvanceTimer(uint32_t wakeCounts)
+{
+    uint64_t count;
+
+    count = __HAL_TIM_GET_COUNTER(&hTim) +
+            (((uint64_t)wakeCounts * TIMER_FREQUENCY) / LSI_VALUE);
+    while (count >= TIMER_PERIOD)
+    {
+        count -= TIMER_PERIOD;
+        timerOverflows++;
+    }
+    __HAL_TIM_SET_COUNTER(&hTim, (uint32_t)count);
+}
+
+void HandleTick(void)
+{
+    uint32_t compare;
+
+    // Ticks missed by a late interrupt are run here, the wheel may also stop the tick
+    do
+    {
+        __HAL_TIM_CLEAR_FLAG(&hTim, TIM_FLAG_CC1);
+        compare = AddCounts(__HAL_TIM_GET_COMPARE(&hTim, TIM_CHANNEL_1), TICK_COUNTS);
+        __HAL_TIM_SET_COMPARE(&hTim, TIM_CHANNEL_1, compare);
+        EvbSwTimerTick();
+        compare = __HAL_TIM_GET_COMPARE(&hTim, TIM_CHANNEL_1);
+    } while ((__HAL_TIM_GET_IT_SOURCE(&hTim, TIM_IT_CC1) != RESET) &&
+             (CountsSince(compare) < (TIMER_PERIOD / 2)));
+}
+
+uint32_t AddCounts(uint32_t count, uint32_t numCounts)
+{
+    uint64_t sum = (uint64_t)count + numCounts;
+    if (sum >= TIMER_PERIOD)
+    {
+        sum -= TIMER_PERIOD;
+    }
+    return (uint32_t)sum;
+}
+
+uint32_t CountsSince(uint32_t count)
+{
+    uint32_t counter = __HAL_TIM_GET_COUNTER(&hTim);
+    return (counter >= count) ? (counter - count) : (uint32_t)(counter + TIMER_PERIOD - count);
+}
+
+int32_t StmStartDreadyCapture(uint32_t *pRing, uint32_t numEntries)
+{
+    int32_t status = -1;
+    HAL_StatusTypeDef halStatus;
+
+    if ((pRing != NULL) && (numEntries > 0) && (numEntries <= CAPTURE_MAX_ENTRIES) &&
+        (hDreadyDMA.Instance != NULL))
+    {
+        StmStopDreadyCapture();
+        pCaptureRing = pRing;
+        numCaptureWraps = 0;
+        halStatus = HAL_DMA_Start_IT(&hDreadyDMA, CaptureRegAddress(), (uint32_t)pRing,
+                                     numEntries * sizeof(uint32_t));
+        if (halStatus == HAL_OK)
+        {
+            numCaptureEntries = numEntries;
+            // Each capture requests one word, the counter runs on and is not disturbed
+            __HAL_TIM_CLEAR_FLAG(&hTim, BOARD_CFG_DREADY_CAPTURE_FLAG);
+            __HAL_TIM_ENABLE_DMA(&hTim, BOARD_CFG_DREADY_CAPTURE_DMA);
+            TIM_CCxChannelCmd(hTim.Instance, BOARD_CFG_DREADY_CAPTURE_CHAN, TIM_CCx_ENABLE);
+            status = 0;
+        }
+    }
+    return status;
+}
+
+void StmStopDreadyCapture(void)
+{
+    if (numCaptureEntries > 0)
+    {
+        // The HAL IC stop would also stop the system timer, so the channel is disabled here
+        TIM_CCxChannelCmd(hTim.Instance, BOARD_CFG_DREADY_CAPTURE_CHAN, TIM_CCx_DISABLE);
+        __HAL_TIM_DISABLE_DMA(&hTim, BOARD_CFG_DREADY_CAPTURE_DMA);
+        HAL_DMA_Abort(&hDreadyDMA);
+        numCaptureEntries = 0;
+    }
+}
+
+uint32_t StmGetDreadyCaptureCount(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t numEntries;
+    uint32_t remaining;
+    uint32_t count = 0;
+
+    __disable_irq();
+    numEntries = numCaptureEntries;
+    if (numEntries > 0)
+    {
+        // A full ring not yet restarted gives the same count as the restarted one
+        remaining = __HAL_DMA_GET_COUNTER(&hDreadyDMA) / sizeof(uint32_t);
+        count = (numCaptureWraps * numEntries) + (numEntries - remaining);
+    }
+    __set_PRIMASK(primask);
+    return count;
+}
+
+uint64_t StmCaptureToTime64(uint32_t count)
+{
+    uint64_t now = StmGetTime64(hTim.Instance);
+    uint32_t nowCount = (uint32_t)(now % TIMER_PERIOD);
+    uint32_t age;
+
+    age = (nowCount >= count) ? (nowCount - count) : (uint32_t)(nowCount + TIMER_PERIOD - count);
+    return (now >= age) ? (now - age) : 0;
+}
+
+int32_t InitDreadyCapture(void)
+{
+    int32_t status = -1;
+    TIM_IC_InitTypeDef config;
+    GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+    __HAL_RCC_GPIOA_CLK_ENABLE();
+    // DREADY is also wired to this pin, its EXTI interrupt is kept for the sample reads
+    GPIO_InitStruct.Pin = BOARD_CFG_DREADY_CAPTURE_PIN;
+    GPIO_InitStruct.Mode = GPIO_MODE_AF_PP;
+    GPIO_InitStruct.Pull = GPIO_NOPULL;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+    GPIO_InitStruct.Alternate = BOARD_CFG_DREADY_CAPTURE_ALT_FUNC;
+    HAL_GPIO_Init(BOARD_CFG_DREADY_CAPTURE_PORT, &GPIO_InitStruct);
+
+    config.ICPolarity = TIM_ICPOLARITY_FALLING;
+    config.ICSelection = TIM_ICSELECTION_DIRECTTI;
+    config.ICPrescaler = TIM_ICPSC_DIV1;
+    config.ICFilter = 0;
+
+    hDreadyDMA.Instance = GPDMA1_Channel3;
+    hDreadyDMA.Init.Request = BOARD_CFG_DREADY_CAPTURE_DMA_REQUEST;
+    hDreadyDMA.Init.BlkHWRequest = DMA_BREQ_SINGLE_BURST;
+    hDreadyDMA.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    hDreadyDMA.Init.SrcInc = DMA_SINC_FIXED;
+    hDreadyDMA.Init.DestInc = DMA_DINC_INCREMENTED;
+    hDreadyDMA.Init.SrcDataWidth = DMA_SRC_DATAWIDTH_WORD;
+    hDreadyDMA.Init.DestDataWidth = DMA_DEST_DATAWIDTH_WORD;
+    hDreadyDMA.Init.Priority = DMA_HIGH_PRIORITY;
+    hDreadyDMA.Init.SrcBurstLength = 1;
+    hDreadyDMA.Init.DestBurstLength = 1;
+    hDreadyDMA.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT1;
+    hDreadyDMA.Init.TransferEventMode = DMA_TCEM_BLOCK_TRANSFER;
+    hDreadyDMA.Init.Mode = DMA_NORMAL;
+
+    if ((HAL_TIM_IC_ConfigChannel(&hTim, &config, BOARD_CFG_DREADY_CAPTURE_CHAN) == HAL_OK) &&
+        (HAL_DMA_Init(&hDreadyDMA) == HAL_OK) &&
+        (HAL_DMA_RegisterCallback(&hDreadyDMA, HAL_DMA_XFER_CPLT_CB_ID, CaptureDmaCallBack) ==
+         HAL_OK))
+    {
+        status = 0;
+    }
+    return status;
+}
+
+uint32_t CaptureRegAddress(void)
+{
+    // CCR1 to CCR4 are consecutive, the channel macros step by 4
+    return (uint32_t)(&hTim.Instance->CCR1 + (BOARD_CFG_DREADY_CAPTURE_CHAN / 4u));
+}
+
+void CaptureDmaCallBack(DMA_HandleTypeDef *pDma)
+{
+    // An edge before the restart is not captured, the restart is much shorter than the
+    // DREADY period at the priority of this interrupt
+    if (numCaptureEntries > 0)
+    {
+        numCaptureWraps++;
+        HAL_DMA_Start_IT(pDma, CaptureRegAddress(), (uint32_t)pCaptureRing,
+                         numCaptureEntries * sizeof(uint32_t));
+    }
+}
+
+void CountOverflow(void)
+{
+    if (__HAL_TIM_GET_FLAG(&hTim, TIM_FLAG_UPDATE))
+    {
+        __HAL_TIM_CLEAR_FLAG(&hTim, TIM_FLAG_UPDATE);
+        timerOverflows++;
+    }
+}
+
 void StmStartTimer(TIM_TypeDef *pTmr)
 {
     if (pTmr != NULL)
     {
+        __HAL_TIM_SET_COUNTER(&hTim, 0);
+        __HAL_TIM_CLEAR_FLAG(&hTim, TIM_FLAG_UPDATE);
+        timerOverflows = 0;
         HAL_TIM_Base_Start(&hTim);
     }
 }
@@ -121,6 +550,7 @@ uint32_t StmCf1TimerInit(void)
 {
     HAL_StatusTypeDef halStatus;
     TIM_OC_InitTypeDef config;
+    uint32_t i;
     config.OCMode = TIM_OCMODE_PWM1;
     // CCRx value -> pwm
     config.Pulse = 0;
@@ -140,13 +570,24 @@ uint32_t StmCf1TimerInit(void)
     halStatus = HAL_TIM_PWM_Stop(&hPwmTim, BOARD_CFG_CF1_TIM_CHAN);
     halStatus = HAL_TIM_PWM_Init(&hPwmTim);
     StmCf1GpioInit(&hPwmTim);
-    halStatus = HAL_TIM_PWM_ConfigChannel(&hPwmTim, &config, BOARD_CFG_CF1_TIM_CHAN);
+    for (i = 0; i < numCf; i++)
+    {
+        if (HAL_TIM_PWM_ConfigChannel(&hPwmTim, &config, cfChannels[i]) != HAL_OK)
+        {
+            halStatus = HAL_ERROR;
+        }
+        __HAL_TIM_DISABLE_OCxPRELOAD(&hPwmTim, cfChannels[i]);
+    }
 
-    __HAL_TIM_DISABLE_OCxPRELOAD(&hPwmTim, BOARD_CFG_CF1_TIM_CHAN);
     HAL_NVIC_EnableIRQ(CF1_TIM_IRQn);
     HAL_NVIC_SetPriority(CF1_TIM_IRQn, APP_CFG_CF_TIMER_INTR_PRIORITY, 0);
     __HAL_TIM_ENABLE_IT(&hPwmTim, TIM_IT_UPDATE);
 
+    if ((halStatus == HAL_OK) && (InitCfDma() != 0))
+    {
+        halStatus = HAL_ERROR;
+    }
+
     return (uint32_t)halStatus;
 }
 
@@ -175,6 +616,152 @@ void StmStopCf1Timer(void)
     HAL_TIM_PWM_Stop(&hPwmTim, BOARD_CFG_CF1_TIM_CHAN);
 }
 
+int32_t StmStartCfBurst(ADI_EVB_CF_PERIOD *pPeriods, uint32_t numPeriods,
+                        ADI_EVB_CF_BURST_CALLBACK pfCallback)
+{
+    int32_t status = -1;
+    uint32_t i;
+
+    // A single period is loaded directly and starts no DMA, so there would be no completion
+    // to call the callback from
+    if ((pPeriods != NULL) && (numPeriods > 0) && (numPeriods <= CF_MAX_BURST_PERIODS) &&
+        ((numPeriods > 1) || (pfCallback == NULL)))
+    {
+        status = 0;
+        pfCfBurstCallback = pfCallback;
+        // The update interrupt is only needed for one period at a time updates
+        __HAL_TIM_DISABLE_IT(&hPwmTim, TIM_IT_UPDATE);
+        for (i = 0; i < numCf; i++)
+        {
+            HAL_TIM_PWM_Stop(&hPwmTim, cfChannels[i]);
+        }
+        SetCfPreload(1);
+        LoadCfPeriod(&pPeriods[0]);
+        hPwmTim.Instance->EGR = TIM_EGR_UG;
+        if (numPeriods > 1)
+        {
+            status = StartCfDma(&pPeriods[1], numPeriods - 1);
+            // An update with the DMA request enabled loads the second period in the preload
+            // registers, the first one stays active
+            hPwmTim.Instance->EGR = TIM_EGR_UG;
+        }
+        __HAL_TIM_CLEAR_FLAG(&hPwmTim, TIM_FLAG_UPDATE);
+        for (i = 0; (i < numCf) && (status == 0); i++)
+        {
+            status = (int32_t)HAL_TIM_PWM_Start(&hPwmTim, cfChannels[i]);
+        }
+    }
+    return status;
+}
+
+void StmStopCfBurst(void)
+{
+    uint32_t i;
+
+    HAL_TIM_DMABurst_WriteStop(&hPwmTim, TIM_DMA_UPDATE);
+    for (i = 0; i < numCf; i++)
+    {
+        HAL_TIM_PWM_Stop(&hPwmTim, cfChannels[i]);
+    }
+    SetCfPreload(0);
+    __HAL_TIM_CLEAR_FLAG(&hPwmTim, TIM_FLAG_UPDATE);
+    __HAL_TIM_ENABLE_IT(&hPwmTim, TIM_IT_UPDATE);
+}
+
+int32_t InitCfDma(void)
+{
+    int32_t status = -1;
+
+    // Each update requests one burst of single word transfers to the DMAR register
+    hCfDMA.Instance = GPDMA1_Channel2;
+    hCfDMA.Init.Request = BOARD_CFG_CF_DMA_REQUEST;
+    hCfDMA.Init.BlkHWRequest = DMA_BREQ_SINGLE_BURST;
+    hCfDMA.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    hCfDMA.Init.SrcInc = DMA_SINC_INCREMENTED;
+    hCfDMA.Init.DestInc = DMA_DINC_FIXED;
+    hCfDMA.Init.SrcDataWidth = DMA_SRC_DATAWIDTH_WORD;
+    hCfDMA.Init.DestDataWidth = DMA_DEST_DATAWIDTH_WORD;
+    hCfDMA.Init.Priority = DMA_HIGH_PRIORITY;
+    hCfDMA.Init.SrcBurstLength = 1;
+    hCfDMA.Init.DestBurstLength = 1;
+    hCfDMA.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT1;
+    hCfDMA.Init.TransferEventMode = DMA_TCEM_BLOCK_TRANSFER;
+    hCfDMA.Init.Mode = DMA_NORMAL;
+    if (HAL_DMA_Init(&hCfDMA) == HAL_OK)
+    {
+        __HAL_LINKDMA(&hPwmTim, hdma[TIM_DMA_ID_UPDATE], hCfDMA);
+        // Registered after the timer init, which resets the timer callbacks
+        if (HAL_TIM_RegisterCallback(&hPwmTim, HAL_TIM_PERIOD_ELAPSED_CB_ID, CfBurstCallBack) ==
+            HAL_OK)
+        {
+            status = 0;
+        }
+    }
+    return status;
+}
+
+int32_t StartCfDma(ADI_EVB_CF_PERIOD *pPeriods, uint32_t numPeriods)
+{
+    HAL_StatusTypeDef halStatus;
+
+    halStatus = HAL_TIM_DMABurst_MultiWriteStart(
+        &hPwmTim, TIM_DMABASE_ARR, TIM_DMA_UPDATE, (uint32_t *)pPeriods,
+        TIM_DMABURSTLENGTH_6TRANSFERS, numPeriods * ADI_EVB_CF_BURST_WORDS);
+    return (halStatus == HAL_OK) ? 0 : -1;
+}
+
+void LoadCfPeriod(ADI_EVB_CF_PERIOD *pPeriod)
+{
+    __HAL_TIM_SET_AUTORELOAD(&hPwmTim, pPeriod->endCount);
+    __HAL_TIM_SET_COMPARE(&hPwmTim, TIM_CHANNEL_1, pPeriod->startCount[0]);
+    __HAL_TIM_SET_COMPARE(&hPwmTim, TIM_CHANNEL_2, pPeriod->startCount[1]);
+    __HAL_TIM_SET_COMPARE(&hPwmTim, TIM_CHANNEL_3, pPeriod->startCount[2]);
+    __HAL_TIM_SET_COMPARE(&hPwmTim, TIM_CHANNEL_4, pPeriod->startCount[3]);
+}
+
+void SetCfPreload(uint32_t enable)
+{
+    uint32_t i;
+
+    // With preload, values written during a period take effect at its update event
+    for (i = 0; i < numCf; i++)
+    {
+        if (enable != 0)
+        {
+            __HAL_TIM_ENABLE_OCxPRELOAD(&hPwmTim, cfChannels[i]);
+        }
+        else
+        {
+            __HAL_TIM_DISABLE_OCxPRELOAD(&hPwmTim, cfChannels[i]);
+        }
+    }
+    if (enable != 0)
+    {
+        SET_BIT(hPwmTim.Instance->CR1, TIM_CR1_ARPE);
+    }
+    else
+    {
+        CLEAR_BIT(hPwmTim.Instance->CR1, TIM_CR1_ARPE);
+    }
+}
+
+void CfBurstCallBack(TIM_HandleTypeDef *pTim)
+{
+    ADI_EVB_CF_PERIOD *pNext = NULL;
+    uint32_t numPeriods = 0;
+
+    // The next request comes at the end of the period just loaded, a full period away
+    HAL_TIM_DMABurst_WriteStop(pTim, TIM_DMA_UPDATE);
+    if (pfCfBurstCallback != NULL)
+    {
+        pNext = pfCfBurstCallback(&numPeriods);
+    }
+    if ((pNext != NULL) && (numPeriods > 0) && (numPeriods <= CF_MAX_BURST_PERIODS))
+    {
+        StartCfDma(pNext, numPeriods);
+    }
+}
+
 uint32_t StmCf1Handler(void)
 {
     uint32_t intrFlag = 0;
@@ -203,6 +790,14 @@ void StmCf1GpioInit(TIM_HandleTypeDef *pCf1Tim)
         GPIO_InitStruct.Pin = BOARD_CFG_CF1_PIN;
         GPIO_InitStruct.Alternate = CF1_PIN_ALT_FUNC;
         HAL_GPIO_Init(BOARD_CFG_CF1_PORT, &GPIO_InitStruct);
+#if BOARD_CFG_CF2_PIN != 0
+        GPIO_InitStruct.Pin = BOARD_CFG_CF2_PIN;
+        HAL_GPIO_Init(BOARD_CFG_CF23_PORT, &GPIO_InitStruct);
+#endif
+#if BOARD_CFG_CF3_PIN != 0
+        GPIO_InitStruct.Pin = BOARD_CFG_CF3_PIN;
+        HAL_GPIO_Init(BOARD_CFG_CF23_PORT, &GPIO_InitStruct);
+#endif
     }
 }
 
@@ -20,6 +20,30 @@
 extern SPI_HandleTypeDef hSPI;
 extern SPI_HandleTypeDef hFramSpi;
 
+/**
+ * @brief Gets the kernel clock frequency of a spi instance
+ * @param[in] pSpi - pointer to spi registers
+ * @return kernel clock in Hz, 0 for an unknown instance
+ */
+static uint32_t GetSpiKernelClock(SPI_TypeDef *pSpi);
+
+/**
+ * @brief Sets the data width and burst length of a spi dma channel
+ * @param[in] hdma - pointer to dma handle
+ * @param[in] widthBytes - data width in bytes on both memory and peripheral side
+ * @param[in] burst - number of beats per burst
+ * @return status
+ */
+static int32_t SetSpiDmaWidth(DMA_HandleTypeDef *hdma, uint32_t widthBytes, uint32_t burst);
+
+/**
+ * @brief Makes the destination of a 2D spi rx dma channel skip by a stride after every frame
+ * @param[in] hdma - pointer to dma handle
+ * @param[in] frameBytes - bytes occupied by a frame in memory
+ * @param[in] rxStride - destination distance between frames, 0 for contiguous
+ */
+static void SetSpiDmaRxStride(DMA_HandleTypeDef *hdma, uint32_t frameBytes, uint32_t rxStride);
+
 /*=============  C O D E  =============*/
 int32_t StmInitSpi(STM_SPI_INSTANCE *pSpiInfo)
 {
@@ -29,21 +53,21 @@ int32_t StmInitSpi(STM_SPI_INSTANCE *pSpiInfo)
     hspi->Instance = pSpiInfo->pSpi;
     hspi->Init.Mode = pSpiInfo->master;
     hspi->Init.Direction = SPI_DIRECTION_2LINES;
-    hspi->Init.DataSize = SPI_DATASIZE_8BIT;
+    hspi->Init.DataSize = pSpiInfo->dataSize;
     hspi->Init.CLKPolarity = pSpiInfo->clkPol;
     hspi->Init.CLKPhase = pSpiInfo->clkPha;
     hspi->Init.NSS = SPI_NSS_SOFT;
     hspi->Init.BaudRatePrescaler = pSpiInfo->prescaler;
     hspi->Init.FirstBit = SPI_FIRSTBIT_MSB;
     hspi->Init.TIMode = SPI_TIMODE_DISABLE;
-    hspi->Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
+    hspi->Init.CRCCalculation = pSpiInfo->crcCalculation;
     hspi->Init.CRCPolynomial = 0x11021;
     hspi->Init.CRCLength = SPI_CRC_LENGTH_16BIT;
     hspi->Init.TxCRCInitializationPattern = SPI_CRC_INITIALIZATION_ALL_ONE_PATTERN;
     hspi->Init.RxCRCInitializationPattern = SPI_CRC_INITIALIZATION_ALL_ONE_PATTERN;
     hspi->Init.NSSPMode = SPI_NSS_PULSE_DISABLE;
     hspi->Init.NSSPolarity = SPI_NSS_POLARITY_LOW;
-    hspi->Init.FifoThreshold = SPI_FIFO_THRESHOLD_01DATA;
+    hspi->Init.FifoThreshold = pSpiInfo->fifoThreshold;
     hspi->Init.MasterSSIdleness = SPI_MASTER_SS_IDLENESS_00CYCLE;
     hspi->Init.MasterInterDataIdleness = SPI_MASTER_INTERDATA_IDLENESS_00CYCLE;
     hspi->Init.MasterReceiverAutoSusp = SPI_MASTER_RX_AUTOSUSP_DISABLE;
@@ -57,6 +81,13 @@ int32_t StmInitSpi(STM_SPI_INSTANCE *pSpiInfo)
     {
         status = -1;
     }
+    else
+    {
+        // Kernel clock source is selected in the MSP init, so read it after HAL_SPI_Init
+        pSpiInfo->kernelClk = GetSpiKernelClock(pSpiInfo->pSpi);
+        // DMA channels are linked in the MSP init with byte width, match them to the frame size
+        status = StmSetSpiDataSize(pSpiInfo, pSpiInfo->dataSize, pSpiInfo->fifoThreshold);
+    }
     return status;
 }
 
@@ -64,7 +95,8 @@ int32_t StmStartSpiTxDMA(STM_SPI_INSTANCE *pSpiInfo, uint8_t *pData, uint32_t nu
 {
     int32_t status = 0;
     HAL_GPIO_WritePin(pSpiInfo->ssPort, pSpiInfo->ssPin, GPIO_PIN_RESET);
-    status = HAL_SPI_Transmit_DMA(pSpiInfo->phSpi, pData, (uint16_t)numBytes);
+    status = HAL_SPI_Transmit_DMA(pSpiInfo->phSpi, pData,
+                                  (uint16_t)(numBytes / pSpiInfo->frameBytes));
 
     return status;
 }
@@ -74,7 +106,7 @@ int32_t StmStartSpiRxDMA(STM_SPI_INSTANCE *pSpiInfo, uint8_t *pData, uint32_t nu
     HAL_GPIO_WritePin(pSpiInfo->ssPort, pSpiInfo->ssPin, GPIO_PIN_RESET);
 
     status = HAL_SPI_TransmitReceive_DMA(pSpiInfo->phSpi, (uint8_t *)&pSpiInfo->dummyCmd, pData,
-                                         (uint16_t)numBytes);
+                                         (uint16_t)(numBytes / pSpiInfo->frameBytes));
 
     return status;
 }
@@ -84,7 +116,8 @@ int32_t StmStartSpiTxRxDMA(STM_SPI_INSTANCE *pSpiInfo, uint8_t *pTxData, uint8_t
 {
     int32_t status = 0;
     HAL_GPIO_WritePin(pSpiInfo->ssPort, pSpiInfo->ssPin, GPIO_PIN_RESET);
-    status = HAL_SPI_TransmitReceive_DMA(pSpiInfo->phSpi, pTxData, pRxData, (uint16_t)numBytes);
+    status = HAL_SPI_TransmitReceive_DMA(pSpiInfo->phSpi, pTxData, pRxData,
+                                         (uint16_t)(numBytes / pSpiInfo->frameBytes));
 
     return status;
 }
@@ -92,12 +125,22 @@ int32_t StmStartSpiTxRxDMA(STM_SPI_INSTANCE *pSpiInfo, uint8_t *pTxData, uint8_t
 int32_t StmSetSpiFrequency(STM_SPI_INSTANCE *pSpiInfo, uint32_t spiFrequency)
 {
     int32_t status = 0;
-    uint32_t pclk = 0;
-    uint32_t val = 0;
-    if (pSpiInfo->phSpi->Instance == pSpiInfo->pSpi)
+    uint32_t prescaler = 0;
+
+    status = StmGetSpiPrescaler(pSpiInfo, spiFrequency, &prescaler);
+    if (status == 0)
     {
-        pclk = HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_SPI1);
+        status = StmSetSpiPrescaler(pSpiInfo, prescaler);
     }
+    return status;
+}
+
+int32_t StmGetSpiPrescaler(STM_SPI_INSTANCE *pSpiInfo, uint32_t spiFrequency,
+                           uint32_t *pPrescaler)
+{
+    int32_t status = 0;
+    uint32_t pclk = pSpiInfo->kernelClk;
+    uint32_t val = 0;
 
     for (val = 0U; val < 8U; val++)
     {
@@ -106,20 +149,208 @@ int32_t StmSetSpiFrequency(STM_SPI_INSTANCE *pSpiInfo, uint32_t spiFrequency)
             break;
         }
     }
-    if ((val == 8U) || (spiFrequency < (pclk >> (val + 1U))))
+    if ((pclk == 0U) || (val == 8U))
     {
         // Requested Bus Speed can not be configured
         status = -1;
     }
-    if (status == 0)
+    else
     {
-        // Save prescaler value
-        pSpiInfo->phSpi->Init.BaudRatePrescaler = _VAL2FLD(SPI_CFG1_MBR, val);
-        status = HAL_SPI_Init(pSpiInfo->phSpi);
+        *pPrescaler = _VAL2FLD(SPI_CFG1_MBR, val);
     }
     return status;
 }
 
+int32_t StmSetSpiPrescaler(STM_SPI_INSTANCE *pSpiInfo, uint32_t prescaler)
+{
+    int32_t status = 0;
+    SPI_HandleTypeDef *hspi = pSpiInfo->phSpi;
+
+    // MBR can only be written while SPE is cleared. HAL clears SPE at the end of every transfer,
+    // so the register can be updated as long as the handle is not busy.
+    if ((hspi->State != HAL_SPI_STATE_READY) || ((pSpiInfo->pSpi->CR1 & SPI_CR1_SPE) != 0U))
+    {
+        status = -1;
+    }
+    else
+    {
+        MODIFY_REG(pSpiInfo->pSpi->CFG1, SPI_CFG1_MBR, prescaler & SPI_CFG1_MBR);
+        // Keep the handle in sync so that a later HAL_SPI_Init retains the prescaler
+        hspi->Init.BaudRatePrescaler = prescaler & SPI_CFG1_MBR;
+        pSpiInfo->prescaler = prescaler & SPI_CFG1_MBR;
+    }
+    return status;
+}
+
+int32_t StmSetSpiDataSize(STM_SPI_INSTANCE *pSpiInfo, uint32_t dataSize, uint32_t fifoThreshold)
+{
+    int32_t status = 0;
+    SPI_HandleTypeDef *hspi = pSpiInfo->phSpi;
+    uint32_t frameBytes = 1U;
+    uint32_t packetBytes;
+    uint32_t widthBytes = 1U;
+
+    if (dataSize > SPI_DATASIZE_16BIT)
+    {
+        frameBytes = 4U;
+    }
+    else if (dataSize > SPI_DATASIZE_8BIT)
+    {
+        frameBytes = 2U;
+    }
+    packetBytes = frameBytes * ((fifoThreshold >> SPI_CFG1_FTHLV_Pos) + 1U);
+    // Pack frames into the widest DMA beat that divides the packet
+    if ((packetBytes & 3U) == 0U)
+    {
+        widthBytes = 4U;
+    }
+    else if ((packetBytes & 1U) == 0U)
+    {
+        widthBytes = 2U;
+    }
+
+    // DSIZE and FTHLV can only be written while SPE is cleared
+    if ((hspi->State != HAL_SPI_STATE_READY) || ((pSpiInfo->pSpi->CR1 & SPI_CR1_SPE) != 0U))
+    {
+        status = -1;
+    }
+    else
+    {
+        MODIFY_REG(pSpiInfo->pSpi->CFG1, SPI_CFG1_DSIZE | SPI_CFG1_FTHLV,
+                   (dataSize & SPI_CFG1_DSIZE) | (fifoThreshold & SPI_CFG1_FTHLV));
+        hspi->Init.DataSize = dataSize & SPI_CFG1_DSIZE;
+        hspi->Init.FifoThreshold = fifoThreshold & SPI_CFG1_FTHLV;
+        pSpiInfo->dataSize = hspi->Init.DataSize;
+        pSpiInfo->fifoThreshold = hspi->Init.FifoThreshold;
+        pSpiInfo->frameBytes = frameBytes;
+        if ((hspi->hdmarx != NULL) && (pSpiInfo->rxStride != 0U))
+        {
+            // Each frame needs its own destination burst to be spread by the address offset
+            status = SetSpiDmaWidth(hspi->hdmarx, frameBytes, packetBytes / frameBytes);
+            SetSpiDmaRxStride(hspi->hdmarx, frameBytes, pSpiInfo->rxStride);
+        }
+        else if (hspi->hdmarx != NULL)
+        {
+            status = SetSpiDmaWidth(hspi->hdmarx, widthBytes, packetBytes / widthBytes);
+            SetSpiDmaRxStride(hspi->hdmarx, frameBytes, 0U);
+        }
+        if ((status == 0) && (hspi->hdmatx != NULL))
+        {
+            status = SetSpiDmaWidth(hspi->hdmatx, widthBytes, packetBytes / widthBytes);
+        }
+    }
+    return status;
+}
+
+int32_t StmSetSpiRxStride(STM_SPI_INSTANCE *pSpiInfo, uint32_t rxStride)
+{
+    int32_t status = -1;
+    SPI_HandleTypeDef *hspi = pSpiInfo->phSpi;
+    uint32_t frameBytes = pSpiInfo->frameBytes;
+    uint32_t prevStride = pSpiInfo->rxStride;
+
+    // Only the 2D addressing channels can offset the destination between bursts
+    if ((hspi->hdmarx != NULL) && IS_DMA_2D_ADDRESSING_INSTANCE(hspi->hdmarx->Instance))
+    {
+        if ((rxStride == 0U) ||
+            (((rxStride % frameBytes) == 0U) &&
+             ((rxStride - frameBytes) <= (DMA_CTR3_DAO >> DMA_CTR3_DAO_Pos))))
+        {
+            pSpiInfo->rxStride = rxStride;
+            status = StmSetSpiDataSize(pSpiInfo, pSpiInfo->dataSize, pSpiInfo->fifoThreshold);
+            if (status != 0)
+            {
+                pSpiInfo->rxStride = prevStride;
+            }
+        }
+    }
+    return status;
+}
+
+static int32_t SetSpiDmaWidth(DMA_HandleTypeDef *hdma, uint32_t widthBytes, uint32_t burst)
+{
+    uint32_t srcWidth = DMA_SRC_DATAWIDTH_BYTE;
+    uint32_t destWidth = DMA_DEST_DATAWIDTH_BYTE;
+
+    if (widthBytes == 4U)
+    {
+        srcWidth = DMA_SRC_DATAWIDTH_WORD;
+        destWidth = DMA_DEST_DATAWIDTH_WORD;
+    }
+    else if (widthBytes == 2U)
+    {
+        srcWidth = DMA_SRC_DATAWIDTH_HALFWORD;
+        destWidth = DMA_DEST_DATAWIDTH_HALFWORD;
+    }
+    // HAL_SPI_xxx_DMA validates the widths against the handle, keep it in sync
+    hdma->Init.SrcDataWidth = srcWidth;
+    hdma->Init.DestDataWidth = destWidth;
+    hdma->Init.SrcBurstLength = burst;
+    hdma->Init.DestBurstLength = burst;
+    // The channel is idle between transfers, so only CTR1 needs updating
+    MODIFY_REG(hdma->Instance->CTR1,
+               DMA_CTR1_SDW_LOG2 | DMA_CTR1_SBL_1 | DMA_CTR1_DDW_LOG2 | DMA_CTR1_DBL_1,
+               srcWidth | destWidth | ((burst - 1U) << DMA_CTR1_SBL_1_Pos) |
+                   ((burst - 1U) << DMA_CTR1_DBL_1_Pos));
+
+    return 0;
+}
+
+static void SetSpiDmaRxStride(DMA_HandleTypeDef *hdma, uint32_t frameBytes, uint32_t rxStride)
+{
+    if (IS_DMA_2D_ADDRESSING_INSTANCE(hdma->Instance))
+    {
+        if (rxStride == 0U)
+        {
+            CLEAR_REG(hdma->Instance->CTR3);
+        }
+        else
+        {
+            // Destination bursts of a single frame, each followed by a jump to the next row
+            hdma->Init.DestBurstLength = 1U;
+            MODIFY_REG(hdma->Instance->CTR1, DMA_CTR1_DBL_1, 0U);
+            WRITE_REG(hdma->Instance->CTR3, _VAL2FLD(DMA_CTR3_DAO, rxStride - frameBytes));
+        }
+    }
+}
+
+static uint32_t GetSpiKernelClock(SPI_TypeDef *pSpi)
+{
+    uint64_t periphClk = 0;
+    uint32_t kernelClk = 0;
+    // Each SPI has its own kernel clock selection on the H5
+    if (pSpi == SPI1)
+    {
+        periphClk = RCC_PERIPHCLK_SPI1;
+    }
+    else if (pSpi == SPI2)
+    {
+        periphClk = RCC_PERIPHCLK_SPI2;
+    }
+    else if (pSpi == SPI3)
+    {
+        periphClk = RCC_PERIPHCLK_SPI3;
+    }
+    else if (pSpi == SPI4)
+    {
+        periphClk = RCC_PERIPHCLK_SPI4;
+    }
+    else if (pSpi == SPI5)
+    {
+        periphClk = RCC_PERIPHCLK_SPI5;
+    }
+    else if (pSpi == SPI6)
+    {
+        periphClk = RCC_PERIPHCLK_SPI6;
+    }
+    // An unknown instance reports 0, which StmGetSpiPrescaler rejects
+    if (periphClk != 0)
+    {
+        kernelClk = HAL_RCCEx_GetPeriphCLKFreq(periphClk);
+    }
+    return kernelClk;
+}
+
 void StmSetChipSelect(void)
 {
     GPIO_InitTypeDef ssGpioConfig;
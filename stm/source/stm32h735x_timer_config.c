@@ -18,8 +18,25 @@
 #include <stdint.h>
 
 /*=============  D E F I N I T I O N S  =============*/
+/** System timer tick rate in Hz */
+#define TIMER_FREQUENCY 25000000u
+/** Ticks per counter period, ARR + 1 */
+#define TIMER_PERIOD    0xFFFFFFFFull
+/** Counts per software timer tick of 1 ms */
+#define TICK_COUNTS     (TIMER_FREQUENCY / 1000u)
+
 /** Handler for Timer */
 static TIM_HandleTypeDef hTim;
+/** System timer overflows since the timer was started */
+static volatile uint32_t timerOverflows;
+/** Counts a pending overflow, called with interrupts masked */
+static void CountOverflow(void);
+/** Advances the tick compare and the software timers */
+static void HandleTick(void);
+/** Adds counts to a counter value, modulo the counter period */
+static uint32_t AddCounts(uint32_t count, uint32_t numCounts);
+/** Counts elapsed since a counter value, modulo the counter period */
+static uint32_t CountsSince(uint32_t count);
 /** Handler for Timer */
 static LPTIM_HandleTypeDef hLpTim2;
 /** Handler for PWM Timer */
@@ -42,6 +59,14 @@ uint32_t StmTimerInit(TIM_TypeDef *pTmr)
     hTim.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
 
     halStatus = HAL_TIM_Base_Init(&hTim);
+    __HAL_TIM_CLEAR_FLAG(&hTim, TIM_FLAG_UPDATE);
+#ifdef SYSTEM_TIM_IRQn
+    // Boards routing the timer interrupt to StmSystemTimerHandler get overflow counting and
+    // software timers, otherwise StmGetTime64 counts the overflows when it is called
+    __HAL_TIM_ENABLE_IT(&hTim, TIM_IT_UPDATE);
+    HAL_NVIC_SetPriority(SYSTEM_TIM_IRQn, BOARD_CFG_SYSTEM_TIMER_INTR_PRIORITY, 0);
+    HAL_NVIC_EnableIRQ(SYSTEM_TIM_IRQn);
+#endif
     return (uint32_t)halStatus;
 }
 
@@ -55,10 +80,109 @@ uint32_t StmGetTime(TIM_TypeDef *pTmr)
     return timerCnt;
 }
 
+uint64_t StmGetTime64(TIM_TypeDef *pTmr)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t timerCnt = 0;
+    uint64_t ticks = 0;
+    if (pTmr != NULL)
+    {
+        __disable_irq();
+        timerCnt = __HAL_TIM_GET_COUNTER(&hTim);
+        // A wrap not yet counted makes the count read above ambiguous
+        if (__HAL_TIM_GET_FLAG(&hTim, TIM_FLAG_UPDATE))
+        {
+            CountOverflow();
+            timerCnt = __HAL_TIM_GET_COUNTER(&hTim);
+        }
+        ticks = ((uint64_t)timerOverflows * TIMER_PERIOD) + timerCnt;
+        __set_PRIMASK(primask);
+    }
+    return ticks;
+}
+
+uint32_t StmGetTimerFrequency(void)
+{
+    return TIMER_FREQUENCY;
+}
+
+void StmSystemTimerHandler(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    CountOverflow();
+    __set_PRIMASK(primask);
+    if ((__HAL_TIM_GET_IT_SOURCE(&hTim, TIM_IT_CC1) != RESET) &&
+        __HAL_TIM_GET_FLAG(&hTim, TIM_FLAG_CC1))
+    {
+        HandleTick();
+    }
+}
+
+void StmStartTickTimer(void)
+{
+    uint32_t compare = AddCounts(__HAL_TIM_GET_COUNTER(&hTim), TICK_COUNTS);
+    // Channel 1 is left in its reset state, a frozen output compare without a pin
+    __HAL_TIM_SET_COMPARE(&hTim, TIM_CHANNEL_1, compare);
+    __HAL_TIM_CLEAR_FLAG(&hTim, TIM_FLAG_CC1);
+    __HAL_TIM_ENABLE_IT(&hTim, TIM_IT_CC1);
+}
+
+void StmStopTickTimer(void)
+{
+    __HAL_TIM_DISABLE_IT(&hTim, TIM_IT_CC1);
+    __HAL_TIM_CLEAR_FLAG(&hTim, TIM_FLAG_CC1);
+}
+
+void HandleTick(void)
+{
+    uint32_t compare;
+
+    // Ticks missed by a late interrupt are run here, the wheel may also stop the tick
+    do
+    {
+        __HAL_TIM_CLEAR_FLAG(&hTim, TIM_FLAG_CC1);
+        compare = AddCounts(__HAL_TIM_GET_COMPARE(&hTim, TIM_CHANNEL_1), TICK_COUNTS);
+        __HAL_TIM_SET_COMPARE(&hTim, TIM_CHANNEL_1, compare);
+        EvbSwTimerTick();
+        compare = __HAL_TIM_GET_COMPARE(&hTim, TIM_CHANNEL_1);
+    } while ((__HAL_TIM_GET_IT_SOURCE(&hTim, TIM_IT_CC1) != RESET) &&
+             (CountsSince(compare) < (TIMER_PERIOD / 2)));
+}
+
+uint32_t AddCounts(uint32_t count, uint32_t numCounts)
+{
+    uint64_t sum = (uint64_t)count + numCounts;
+    if (sum >= TIMER_PERIOD)
+    {
+        sum -= TIMER_PERIOD;
+    }
+    return (uint32_t)sum;
+}
+
+uint32_t CountsSince(uint32_t count)
+{
+    uint32_t counter = __HAL_TIM_GET_COUNTER(&hTim);
+    return (counter >= count) ? (counter - count) : (uint32_t)(counter + TIMER_PERIOD - count);
+}
+
+void CountOverflow(void)
+{
+    if (__HAL_TIM_GET_FLAG(&hTim, TIM_FLAG_UPDATE))
+    {
+        __HAL_TIM_CLEAR_FLAG(&hTim, TIM_FLAG_UPDATE);
+        timerOverflows++;
+    }
+}
+
 void StmStartTimer(TIM_TypeDef *pTmr)
 {
     if (pTmr != NULL)
     {
+        __HAL_TIM_SET_COUNTER(&hTim, 0);
+        __HAL_TIM_CLEAR_FLAG(&hTim, TIM_FLAG_UPDATE);
+        timerOverflows = 0;
         HAL_TIM_Base_Start(&hTim);
     }
 }
@@ -216,6 +340,56 @@ void StmStartLPTimer(LPTIM_TypeDef *pLpTmr)
     }
 }
 
+int32_t StmStartCfBurst(ADI_EVB_CF_PERIOD *pPeriods, uint32_t numPeriods,
+                        ADI_EVB_CF_BURST_CALLBACK pfCallback)
+{
+    // No DMA channel is assigned to the CF timer on this board
+    (void)pPeriods;
+    (void)numPeriods;
+    (void)pfCallback;
+    return -1;
+}
+
+void StmStopCfBurst(void)
+{
+}
+
+int32_t StmStartDreadyCapture(uint32_t *pRing, uint32_t numEntries)
+{
+    // DREADY is not routed to a capture input of the system timer on this board
+    (void)pRing;
+    (void)numEntries;
+    return -1;
+}
+
+void StmStopDreadyCapture(void)
+{
+}
+
+uint32_t StmGetDreadyCaptureCount(void)
+{
+    return 0;
+}
+
+uint64_t StmCaptureToTime64(uint32_t count)
+{
+    (void)count;
+    return 0;
+}
+
+int32_t StmEnterLowPower(uint8_t isStop, uint32_t sleepUs)
+{
+    int32_t wake = -1;
+    // No wake timer on this board, the tick or the next interrupt ends the sleep
+    (void)sleepUs;
+    if (isStop == 0)
+    {
+        HAL_PWR_EnterSLEEPMode(PWR_MAINREGULATOR_ON, PWR_SLEEPENTRY_WFI);
+        wake = 0;
+    }
+    return wake;
+}
+
 void StmStopLPTimer(LPTIM_TypeDef *pLpTmr)
 {
     if (pLpTmr != NULL)
@@ -20,6 +20,21 @@
 extern SPI_HandleTypeDef hSPI;
 extern SPI_HandleTypeDef hFramSpi;
 
+/**
+ * @brief Gets the kernel clock frequency of a spi instance
+ * @param[in] pSpi - pointer to spi registers
+ * @return kernel clock in Hz
+ */
+static uint32_t GetSpiKernelClock(SPI_TypeDef *pSpi);
+
+/**
+ * @brief Sets the data width of a spi dma channel
+ * @param[in] hdma - pointer to dma handle
+ * @param[in] widthBytes - data width in bytes on both memory and peripheral side
+ * @return status
+ */
+static int32_t SetSpiDmaWidth(DMA_HandleTypeDef *hdma, uint32_t widthBytes);
+
 /*=============  C O D E  =============*/
 int32_t StmInitSpi(STM_SPI_INSTANCE *pSpiInfo)
 {
@@ -29,21 +44,21 @@ int32_t StmInitSpi(STM_SPI_INSTANCE *pSpiInfo)
     hspi->Instance = pSpiInfo->pSpi;
     hspi->Init.Mode = pSpiInfo->master;
     hspi->Init.Direction = SPI_DIRECTION_2LINES;
-    hspi->Init.DataSize = SPI_DATASIZE_8BIT;
+    hspi->Init.DataSize = pSpiInfo->dataSize;
     hspi->Init.CLKPolarity = pSpiInfo->clkPol;
     hspi->Init.CLKPhase = pSpiInfo->clkPha;
     hspi->Init.NSS = SPI_NSS_SOFT;
     hspi->Init.BaudRatePrescaler = pSpiInfo->prescaler;
     hspi->Init.FirstBit = SPI_FIRSTBIT_MSB;
     hspi->Init.TIMode = SPI_TIMODE_DISABLE;
-    hspi->Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
+    hspi->Init.CRCCalculation = pSpiInfo->crcCalculation;
     hspi->Init.CRCPolynomial = 0x11021;
     hspi->Init.CRCLength = SPI_CRC_LENGTH_16BIT;
     hspi->Init.TxCRCInitializationPattern = SPI_CRC_INITIALIZATION_ALL_ONE_PATTERN;
     hspi->Init.RxCRCInitializationPattern = SPI_CRC_INITIALIZATION_ALL_ONE_PATTERN;
     hspi->Init.NSSPMode = SPI_NSS_PULSE_DISABLE;
     hspi->Init.NSSPolarity = SPI_NSS_POLARITY_LOW;
-    hspi->Init.FifoThreshold = SPI_FIFO_THRESHOLD_01DATA;
+    hspi->Init.FifoThreshold = pSpiInfo->fifoThreshold;
     hspi->Init.MasterSSIdleness = SPI_MASTER_SS_IDLENESS_00CYCLE;
     hspi->Init.MasterInterDataIdleness = SPI_MASTER_INTERDATA_IDLENESS_00CYCLE;
     hspi->Init.MasterReceiverAutoSusp = SPI_MASTER_RX_AUTOSUSP_DISABLE;
@@ -55,6 +70,13 @@ int32_t StmInitSpi(STM_SPI_INSTANCE *pSpiInfo)
     {
         status = -1;
     }
+    else
+    {
+        // Kernel clock source is selected in the MSP init, so read it after HAL_SPI_Init
+        pSpiInfo->kernelClk = GetSpiKernelClock(pSpiInfo->pSpi);
+        // DMA channels are linked in the MSP init with byte width, match them to the frame size
+        status = StmSetSpiDataSize(pSpiInfo, pSpiInfo->dataSize, pSpiInfo->fifoThreshold);
+    }
     return status;
 }
 
@@ -62,7 +84,8 @@ int32_t StmStartSpiTxDMA(STM_SPI_INSTANCE *pSpiInfo, uint8_t *pData, uint32_t nu
 {
     int32_t status = 0;
     HAL_GPIO_WritePin(pSpiInfo->ssPort, pSpiInfo->ssPin, GPIO_PIN_RESET);
-    status = HAL_SPI_Transmit_DMA(pSpiInfo->phSpi, pData, (uint16_t)numBytes);
+    status = HAL_SPI_Transmit_DMA(pSpiInfo->phSpi, pData,
+                                  (uint16_t)(numBytes / pSpiInfo->frameBytes));
 
     return status;
 }
@@ -73,7 +96,7 @@ int32_t StmStartSpiRxDMA(STM_SPI_INSTANCE *pSpiInfo, uint8_t *pData, uint32_t nu
     HAL_GPIO_WritePin(pSpiInfo->ssPort, pSpiInfo->ssPin, GPIO_PIN_RESET);
 
     status = HAL_SPI_TransmitReceive_DMA(pSpiInfo->phSpi, (uint8_t *)&pSpiInfo->dummyCmd, pData,
-                                         (uint16_t)numBytes);
+                                         (uint16_t)(numBytes / pSpiInfo->frameBytes));
 
     return status;
 }
@@ -83,7 +106,8 @@ int32_t StmStartSpiTxRxDMA(STM_SPI_INSTANCE *pSpiInfo, uint8_t *pTxData, uint8_t
 {
     int32_t status = 0;
     HAL_GPIO_WritePin(pSpiInfo->ssPort, pSpiInfo->ssPin, GPIO_PIN_RESET);
-    status = HAL_SPI_TransmitReceive_DMA(pSpiInfo->phSpi, pTxData, pRxData, (uint16_t)numBytes);
+    status = HAL_SPI_TransmitReceive_DMA(pSpiInfo->phSpi, pTxData, pRxData,
+                                         (uint16_t)(numBytes / pSpiInfo->frameBytes));
 
     return status;
 }
@@ -91,12 +115,22 @@ int32_t StmStartSpiTxRxDMA(STM_SPI_INSTANCE *pSpiInfo, uint8_t *pTxData, uint8_t
 int32_t StmSetSpiFrequency(STM_SPI_INSTANCE *pSpiInfo, uint32_t spiFrequency)
 {
     int32_t status = 0;
-    uint32_t pclk = 0;
-    uint32_t val = 0;
-    if (pSpiInfo->phSpi->Instance == pSpiInfo->pSpi)
+    uint32_t prescaler = 0;
+
+    status = StmGetSpiPrescaler(pSpiInfo, spiFrequency, &prescaler);
+    if (status == 0)
     {
-        pclk = HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_SPI1);
+        status = StmSetSpiPrescaler(pSpiInfo, prescaler);
     }
+    return status;
+}
+
+int32_t StmGetSpiPrescaler(STM_SPI_INSTANCE *pSpiInfo, uint32_t spiFrequency,
+                           uint32_t *pPrescaler)
+{
+    int32_t status = 0;
+    uint32_t pclk = pSpiInfo->kernelClk;
+    uint32_t val = 0;
 
     for (val = 0U; val < 8U; val++)
     {
@@ -105,20 +139,143 @@ int32_t StmSetSpiFrequency(STM_SPI_INSTANCE *pSpiInfo, uint32_t spiFrequency)
             break;
         }
     }
-    if ((val == 8U) || (spiFrequency < (pclk >> (val + 1U))))
+    if ((pclk == 0U) || (val == 8U))
     {
         // Requested Bus Speed can not be configured
         status = -1;
     }
-    if (status == 1)
+    else
+    {
+        *pPrescaler = _VAL2FLD(SPI_CFG1_MBR, val);
+    }
+    return status;
+}
+
+int32_t StmSetSpiPrescaler(STM_SPI_INSTANCE *pSpiInfo, uint32_t prescaler)
+{
+    int32_t status = 0;
+    SPI_HandleTypeDef *hspi = pSpiInfo->phSpi;
+
+    // MBR can only be written while SPE is cleared. HAL clears SPE at the end of every transfer,
+    // so the register can be updated as long as the handle is not busy.
+    if ((hspi->State != HAL_SPI_STATE_READY) || ((pSpiInfo->pSpi->CR1 & SPI_CR1_SPE) != 0U))
+    {
+        status = -1;
+    }
+    else
+    {
+        MODIFY_REG(pSpiInfo->pSpi->CFG1, SPI_CFG1_MBR, prescaler & SPI_CFG1_MBR);
+        // Keep the handle in sync so that a later HAL_SPI_Init retains the prescaler
+        hspi->Init.BaudRatePrescaler = prescaler & SPI_CFG1_MBR;
+        pSpiInfo->prescaler = prescaler & SPI_CFG1_MBR;
+    }
+    return status;
+}
+
+int32_t StmSetSpiDataSize(STM_SPI_INSTANCE *pSpiInfo, uint32_t dataSize, uint32_t fifoThreshold)
+{
+    int32_t status = 0;
+    SPI_HandleTypeDef *hspi = pSpiInfo->phSpi;
+    uint32_t frameBytes = 1U;
+
+    if (dataSize > SPI_DATASIZE_16BIT)
+    {
+        frameBytes = 4U;
+    }
+    else if (dataSize > SPI_DATASIZE_8BIT)
+    {
+        frameBytes = 2U;
+    }
+
+    // DMA streams move single beats, so packets of more than one frame are not supported.
+    // DSIZE and FTHLV can only be written while SPE is cleared
+    if ((fifoThreshold != SPI_FIFO_THRESHOLD_01DATA) || (hspi->State != HAL_SPI_STATE_READY) ||
+        ((pSpiInfo->pSpi->CR1 & SPI_CR1_SPE) != 0U))
+    {
+        status = -1;
+    }
+    else
+    {
+        MODIFY_REG(pSpiInfo->pSpi->CFG1, SPI_CFG1_DSIZE | SPI_CFG1_FTHLV,
+                   (dataSize & SPI_CFG1_DSIZE) | (fifoThreshold & SPI_CFG1_FTHLV));
+        hspi->Init.DataSize = dataSize & SPI_CFG1_DSIZE;
+        hspi->Init.FifoThreshold = fifoThreshold & SPI_CFG1_FTHLV;
+        pSpiInfo->dataSize = hspi->Init.DataSize;
+        pSpiInfo->fifoThreshold = hspi->Init.FifoThreshold;
+        pSpiInfo->frameBytes = frameBytes;
+        if (hspi->hdmarx != NULL)
+        {
+            status = SetSpiDmaWidth(hspi->hdmarx, frameBytes);
+        }
+        if ((status == 0) && (hspi->hdmatx != NULL))
+        {
+            status = SetSpiDmaWidth(hspi->hdmatx, frameBytes);
+        }
+    }
+    return status;
+}
+
+int32_t StmSetSpiRxStride(STM_SPI_INSTANCE *pSpiInfo, uint32_t rxStride)
+{
+    int32_t status = -1;
+
+    (void)pSpiInfo;
+    // DMA streams have no destination address offset, only contiguous reception is supported
+    if (rxStride == 0U)
+    {
+        status = 0;
+    }
+    return status;
+}
+
+static int32_t SetSpiDmaWidth(DMA_HandleTypeDef *hdma, uint32_t widthBytes)
+{
+    int32_t status = 0;
+    uint32_t periphAlign = DMA_PDATAALIGN_BYTE;
+    uint32_t memAlign = DMA_MDATAALIGN_BYTE;
+
+    if (widthBytes == 4U)
+    {
+        periphAlign = DMA_PDATAALIGN_WORD;
+        memAlign = DMA_MDATAALIGN_WORD;
+    }
+    else if (widthBytes == 2U)
+    {
+        periphAlign = DMA_PDATAALIGN_HALFWORD;
+        memAlign = DMA_MDATAALIGN_HALFWORD;
+    }
+    if ((hdma->Init.PeriphDataAlignment != periphAlign) ||
+        (hdma->Init.MemDataAlignment != memAlign))
     {
-        // Save prescaler value
-        pSpiInfo->phSpi->Init.BaudRatePrescaler = _VAL2FLD(SPI_CFG1_MBR, val);
-        status = HAL_SPI_Init(pSpiInfo->phSpi);
+        hdma->Init.PeriphDataAlignment = periphAlign;
+        hdma->Init.MemDataAlignment = memAlign;
+        if (HAL_DMA_Init(hdma) != HAL_OK)
+        {
+            status = -1;
+        }
     }
+
     return status;
 }
 
+static uint32_t GetSpiKernelClock(SPI_TypeDef *pSpi)
+{
+    uint64_t periphClk;
+    if ((pSpi == SPI4) || (pSpi == SPI5))
+    {
+        periphClk = RCC_PERIPHCLK_SPI45;
+    }
+    else if (pSpi == SPI6)
+    {
+        periphClk = RCC_PERIPHCLK_SPI6;
+    }
+    else
+    {
+        periphClk = RCC_PERIPHCLK_SPI123;
+    }
+    return HAL_RCCEx_GetPeriphCLKFreq(periphClk);
+}
+
 void StmSetChipSelect(void)
 {
     /* Deinit GPIO as SS pin - Not required since we are using S/W based Chip Select.
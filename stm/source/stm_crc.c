@@ -22,6 +22,9 @@
 
 /*=============  D E F I N I T I O N S  =============*/
 
+/** Largest block a GPDMA channel moves in one go, BNDT is 16 bits */
+#define STM_CRC_DMA_MAX_BLOCK 0xFFFFU
+
 /*=============  D A T A  =============*/
 
 /** Evb crc info */
@@ -29,58 +32,303 @@ typedef struct
 {
     /** callback */
     ADI_EVB_CALLBACK pfCallback;
-    /** CRC value */
-    uint32_t crc;
+    /** mask of the CRC width */
+    uint32_t crcMask;
+    /** CRC width in bits */
+    uint32_t numBits;
+    /** Initial value of the CRC register */
+    uint32_t seed;
+    /** Value XORed with the CRC at the end */
+    uint32_t finalXor;
+    /** next byte to feed to the CRC unit */
+    uint8_t *pNext;
+    /** bytes left after the block in progress */
+    uint32_t numBytesLeft;
+    /** set while a chunk is being fed */
+    volatile uint8_t isBusy;
+    /** set when a dma error hit the current CRC */
+    volatile uint8_t dmaError;
 } EVB_CRC_INFO;
 
 /** creating crc instance*/
 static CRC_HandleTypeDef hCRC;
 
 static EVB_CRC_INFO evbCrcInfo;
+
+#ifndef STM32H735xx
+/** Dma channel feeding the CRC data register */
+DMA_HandleTypeDef hCrcDMA;
+
+/** Initialises the dma channel feeding the CRC unit */
+static int32_t InitCrcDma(void);
+/** Starts the next block of the chunk */
+static int32_t StartCrcBlock(void);
+/** Dma complete callback */
+static void CrcDmaCpltCallBack(DMA_HandleTypeDef *hdma);
+/** Dma error callback */
+static void CrcDmaErrorCallBack(DMA_HandleTypeDef *hdma);
+#endif
+/** Ends the chunk in progress */
+static void CompleteCrcChunk(uint8_t error);
+
 /*=============  C O D E  =============*/
 int32_t EvbInitCrc(void **phCrc, ADI_EVB_CRC_CONFIG *pConfig)
 {
     int32_t status = 0;
+    ADI_EVB_CRC_PARAMS params = {ADI_EVB_CRC_TYPE_CRC16, 0x1021U, 0xFFFFU, 0U, 0U, 0U};
     hCRC.Instance = CRC;
-    hCRC.Init.DefaultPolynomialUse = DEFAULT_POLYNOMIAL_DISABLE;
-    hCRC.Init.DefaultInitValueUse = DEFAULT_INIT_VALUE_ENABLE;
-    hCRC.Init.GeneratingPolynomial = 0x1021;
-    hCRC.Init.CRCLength = CRC_POLYLENGTH_16B;
-    hCRC.Init.InputDataInversionMode = CRC_INPUTDATA_INVERSION_NONE;
-    hCRC.Init.OutputDataInversionMode = CRC_OUTPUTDATA_INVERSION_DISABLE;
     hCRC.InputDataFormat = CRC_INPUTDATA_FORMAT_BYTES;
-    hCRC.Init.GeneratingPolynomial = 0x1021;
-    hCRC.Init.CRCLength = CRC_POLYLENGTH_16B;
     evbCrcInfo.pfCallback = pConfig->pfCallback;
     /* Just a keeping a API provision to support multiple SPIs later*/
     *phCrc = &evbCrcInfo;
-    if (HAL_CRC_Init(&hCRC) != HAL_OK)
+    status = EvbCrcConfigure(&evbCrcInfo, &params);
+#ifndef STM32H735xx
+    if (status == 0)
+    {
+        status = InitCrcDma();
+    }
+#endif
+    return status;
+}
+
+int32_t EvbCrcConfigure(void *hEvb, ADI_EVB_CRC_PARAMS *pParams)
+{
+    int32_t status = -1;
+    uint32_t crcLength = CRC_POLYLENGTH_32B;
+    uint32_t crcMask = 0xFFFFFFFFU;
+    uint32_t numBits = 32U;
+
+    if ((hEvb != NULL) && (pParams != NULL) && (evbCrcInfo.isBusy == 0U))
     {
-        status = -1;
+        status = 0;
+        if (pParams->crcType == ADI_EVB_CRC_TYPE_CRC8)
+        {
+            crcLength = CRC_POLYLENGTH_8B;
+            crcMask = 0xFFU;
+            numBits = 8U;
+        }
+        else if (pParams->crcType == ADI_EVB_CRC_TYPE_CRC16)
+        {
+            crcLength = CRC_POLYLENGTH_16B;
+            crcMask = 0xFFFFU;
+            numBits = 16U;
+        }
+        else if (pParams->crcType != ADI_EVB_CRC_TYPE_CRC32)
+        {
+            status = -1;
+        }
+    }
+    if (status == 0)
+    {
+        hCRC.Init.DefaultPolynomialUse = DEFAULT_POLYNOMIAL_DISABLE;
+        hCRC.Init.DefaultInitValueUse = DEFAULT_INIT_VALUE_DISABLE;
+        hCRC.Init.GeneratingPolynomial = pParams->polynomial & crcMask;
+        hCRC.Init.CRCLength = crcLength;
+        hCRC.Init.InitValue = pParams->seed & crcMask;
+        // Reflecting each input byte and the output register gives the reflected algorithms
+        hCRC.Init.InputDataInversionMode = CRC_INPUTDATA_INVERSION_NONE;
+        if (pParams->reflectIn == 1U)
+        {
+            hCRC.Init.InputDataInversionMode = CRC_INPUTDATA_INVERSION_BYTE;
+        }
+        hCRC.Init.OutputDataInversionMode = CRC_OUTPUTDATA_INVERSION_DISABLE;
+        if (pParams->reflectOut == 1U)
+        {
+            hCRC.Init.OutputDataInversionMode = CRC_OUTPUTDATA_INVERSION_ENABLE;
+        }
+        evbCrcInfo.crcMask = crcMask;
+        evbCrcInfo.numBits = numBits;
+        evbCrcInfo.seed = hCRC.Init.InitValue;
+        evbCrcInfo.finalXor = pParams->finalXor & crcMask;
+        if (HAL_CRC_Init(&hCRC) != HAL_OK)
+        {
+            status = -1;
+        }
     }
     return status;
 }
 
 int32_t EvbCrcCalculate(void *hEvb, uint8_t *pData, uint32_t numBytes)
 {
-    int32_t status = 0;
-    (void)hEvb; /* Dummy use of argument */
-    evbCrcInfo.crc = HAL_CRC_Calculate(&hCRC, (uint32_t *)pData, numBytes);
-    if (evbCrcInfo.pfCallback != NULL)
+    int32_t status;
+
+    status = EvbCrcStart(hEvb);
+    if (status == 0)
     {
-        evbCrcInfo.pfCallback();
+        status = EvbCrcAccumulate(hEvb, pData, numBytes);
+    }
+    return status;
+}
+
+int32_t EvbCrcStart(void *hEvb)
+{
+    int32_t status = -1;
+    if ((hEvb != NULL) && (evbCrcInfo.isBusy == 0U))
+    {
+        // Loads the seed into the CRC register, INIT may hold a restored state
+        WRITE_REG(hCRC.Instance->INIT, evbCrcInfo.seed);
+        __HAL_CRC_DR_RESET(&hCRC);
+        evbCrcInfo.dmaError = 0;
+        status = 0;
+    }
+    return status;
+}
+
+int32_t EvbCrcAccumulate(void *hEvb, uint8_t *pData, uint32_t numBytes)
+{
+    int32_t status = -1;
+    if ((hEvb != NULL) && (pData != NULL) && (numBytes > 0U) && (evbCrcInfo.isBusy == 0U))
+    {
+        evbCrcInfo.isBusy = 1;
+        evbCrcInfo.pNext = pData;
+        evbCrcInfo.numBytesLeft = numBytes;
+#ifdef STM32H735xx
+        // HAL treats the buffer as bytes with CRC_INPUTDATA_FORMAT_BYTES
+        (void)HAL_CRC_Accumulate(&hCRC, (uint32_t *)(void *)pData, numBytes);
+        evbCrcInfo.numBytesLeft = 0;
+        CompleteCrcChunk(0);
+        status = 0;
+#else
+        status = StartCrcBlock();
+        if (status != 0)
+        {
+            evbCrcInfo.isBusy = 0;
+        }
+#endif
+    }
+    return status;
+}
+
+int32_t EvbCrcFinalise(void *hEvb, uint32_t *pData)
+{
+    int32_t status = -1;
+    if ((hEvb != NULL) && (pData != NULL) && (evbCrcInfo.isBusy == 0U) &&
+        (evbCrcInfo.dmaError == 0U))
+    {
+        // The output reflection is applied on read, there is no final XOR in the peripheral
+        *pData = (hCRC.Instance->DR ^ evbCrcInfo.finalXor) & evbCrcInfo.crcMask;
+        status = 0;
+    }
+    return status;
+}
+
+int32_t EvbCrcSaveState(void *hEvb, uint32_t *pState)
+{
+    int32_t status = -1;
+    uint32_t crc;
+    if ((hEvb != NULL) && (pState != NULL) && (evbCrcInfo.isBusy == 0U))
+    {
+        crc = hCRC.Instance->DR;
+        // Undo the output reflection to get the register itself
+        if (hCRC.Init.OutputDataInversionMode == CRC_OUTPUTDATA_INVERSION_ENABLE)
+        {
+            crc = __RBIT(crc) >> (32U - evbCrcInfo.numBits);
+        }
+        *pState = crc & evbCrcInfo.crcMask;
+        status = 0;
+    }
+    return status;
+}
+
+int32_t EvbCrcRestoreState(void *hEvb, uint32_t state)
+{
+    int32_t status = -1;
+    if ((hEvb != NULL) && (evbCrcInfo.isBusy == 0U))
+    {
+        // The register can only be loaded from INIT, EvbCrcStart puts the seed back
+        WRITE_REG(hCRC.Instance->INIT, state);
+        __HAL_CRC_DR_RESET(&hCRC);
+        evbCrcInfo.dmaError = 0;
+        status = 0;
     }
     return status;
 }
 
 int32_t EvbCrcGetValue(void *hEvb, uint32_t *pData)
 {
-    int32_t status = 0;
-    (void)hEvb; /* Dummy use of argument */
-    *pData = evbCrcInfo.crc;
+    return EvbCrcFinalise(hEvb, pData);
+}
+
+void CompleteCrcChunk(uint8_t error)
+{
+    evbCrcInfo.dmaError |= error;
+    evbCrcInfo.isBusy = 0;
+    // Queued jobs have their own callbacks
+    if ((EvbCrcJobIrqCallback(error) == 0U) && (evbCrcInfo.pfCallback != NULL))
+    {
+        evbCrcInfo.pfCallback();
+    }
+}
+
+#ifndef STM32H735xx
+int32_t InitCrcDma(void)
+{
+    int32_t status = -1;
+
+    // Software request: the channel writes to the data register as fast as the CRC accepts
+    hCrcDMA.Instance = GPDMA1_Channel1;
+    hCrcDMA.Init.Request = DMA_REQUEST_SW;
+    hCrcDMA.Init.BlkHWRequest = DMA_BREQ_SINGLE_BURST;
+    hCrcDMA.Init.Direction = DMA_MEMORY_TO_MEMORY;
+    hCrcDMA.Init.SrcInc = DMA_SINC_INCREMENTED;
+    hCrcDMA.Init.DestInc = DMA_DINC_FIXED;
+    hCrcDMA.Init.SrcDataWidth = DMA_SRC_DATAWIDTH_BYTE;
+    hCrcDMA.Init.DestDataWidth = DMA_DEST_DATAWIDTH_BYTE;
+    hCrcDMA.Init.Priority = DMA_LOW_PRIORITY_LOW_WEIGHT;
+    hCrcDMA.Init.SrcBurstLength = 1;
+    hCrcDMA.Init.DestBurstLength = 1;
+    hCrcDMA.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT1;
+    hCrcDMA.Init.TransferEventMode = DMA_TCEM_BLOCK_TRANSFER;
+    hCrcDMA.Init.Mode = DMA_NORMAL;
+    if (HAL_DMA_Init(&hCrcDMA) == HAL_OK)
+    {
+        HAL_DMA_RegisterCallback(&hCrcDMA, HAL_DMA_XFER_CPLT_CB_ID, CrcDmaCpltCallBack);
+        HAL_DMA_RegisterCallback(&hCrcDMA, HAL_DMA_XFER_ERROR_CB_ID, CrcDmaErrorCallBack);
+        status = 0;
+    }
     return status;
 }
 
+int32_t StartCrcBlock(void)
+{
+    int32_t status = -1;
+    uint32_t numBytes = evbCrcInfo.numBytesLeft;
+
+    if (numBytes > STM_CRC_DMA_MAX_BLOCK)
+    {
+        numBytes = STM_CRC_DMA_MAX_BLOCK;
+    }
+    // Byte writes keep the data order of the buffer, see CRC_Handle_8 in the HAL
+    if (HAL_DMA_Start_IT(&hCrcDMA, (uint32_t)evbCrcInfo.pNext, (uint32_t)&hCRC.Instance->DR,
+                         numBytes) == HAL_OK)
+    {
+        evbCrcInfo.numBytesLeft -= numBytes;
+        evbCrcInfo.pNext += numBytes;
+        status = 0;
+    }
+    return status;
+}
+
+void CrcDmaCpltCallBack(DMA_HandleTypeDef *hdma)
+{
+    (void)hdma;
+    if (evbCrcInfo.numBytesLeft == 0U)
+    {
+        CompleteCrcChunk(0);
+    }
+    else if (StartCrcBlock() != 0)
+    {
+        CompleteCrcChunk(1);
+    }
+}
+
+void CrcDmaErrorCallBack(DMA_HandleTypeDef *hdma)
+{
+    (void)hdma;
+    CompleteCrcChunk(1);
+}
+#endif
+
 /**
  * @}
  */
@@ -0,0 +1,223 @@
+/******************************************************************************
+ Copyright (c) 2024 - 2025  Analog Devices Inc.
+******************************************************************************/
+
+/**
+ * @file     stm_mem.c
+ * @brief    Memory to memory copy and fill using a GPDMA channel
+ * @{
+ */
+
+/*=============  I N C L U D E S   =============*/
+
+#include "adi_evb.h"
+#include "app_cfg.h"
+#include "stm32h5xx_hal.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#if APP_CFG_ENABLE_MEM_DMA == 1
+
+/*=============  D E F I N I T I O N S  =============*/
+
+/** Largest block a GPDMA channel moves in one go, BNDT is 16 bits */
+#define STM_MEM_DMA_MAX_BLOCK 0xFFFCU
+
+/** Evb mem info */
+typedef struct
+{
+    /** callback */
+    ADI_EVB_MEM_CALLBACK pfCallback;
+    /** next source address */
+    uint32_t srcAddr;
+    /** next destination address */
+    uint32_t dstAddr;
+    /** bytes left after the block in progress */
+    uint32_t numBytesLeft;
+    /** 1 when the source address is incremented */
+    uint8_t srcInc;
+    /** fill word for memset, source of the fixed address transfer */
+    uint32_t fillWord;
+    /** 0 when complete, 1 while in progress, -1 on error */
+    volatile int32_t state;
+} EVB_MEM_INFO;
+
+/*=============  D A T A  =============*/
+
+/** Evb mem info */
+static EVB_MEM_INFO evbMemInfo;
+/** Memory to memory dma channel */
+DMA_HandleTypeDef hMemDMA;
+
+/*============= F U N C T I O N S =============*/
+
+/** Starts a memory transfer */
+static int32_t StartMemDma(const void *pSrc, void *pDst, uint32_t numBytes, uint8_t srcInc,
+                           ADI_EVB_MEM_CALLBACK pfCallback);
+/** Starts the next block of the transfer */
+static int32_t StartMemBlock(void);
+/** Completes the transfer and calls the user callback */
+static void CompleteMemDma(int32_t status);
+/** Dma complete callback */
+static void MemDmaCpltCallBack(DMA_HandleTypeDef *hdma);
+/** Dma error callback */
+static void MemDmaErrorCallBack(DMA_HandleTypeDef *hdma);
+
+int32_t EvbInitMem(void)
+{
+    int32_t status = -1;
+
+    hMemDMA.Instance = GPDMA1_Channel0;
+    hMemDMA.Init.Request = DMA_REQUEST_SW;
+    hMemDMA.Init.BlkHWRequest = DMA_BREQ_SINGLE_BURST;
+    hMemDMA.Init.Direction = DMA_MEMORY_TO_MEMORY;
+    hMemDMA.Init.SrcInc = DMA_SINC_INCREMENTED;
+    hMemDMA.Init.DestInc = DMA_DINC_INCREMENTED;
+    hMemDMA.Init.SrcDataWidth = DMA_SRC_DATAWIDTH_BYTE;
+    hMemDMA.Init.DestDataWidth = DMA_DEST_DATAWIDTH_BYTE;
+    hMemDMA.Init.Priority = DMA_LOW_PRIORITY_LOW_WEIGHT;
+    hMemDMA.Init.SrcBurstLength = 1;
+    hMemDMA.Init.DestBurstLength = 1;
+    hMemDMA.Init.TransferAllocatedPort = DMA_SRC_ALLOCATED_PORT0 | DMA_DEST_ALLOCATED_PORT1;
+    hMemDMA.Init.TransferEventMode = DMA_TCEM_BLOCK_TRANSFER;
+    hMemDMA.Init.Mode = DMA_NORMAL;
+    if (HAL_DMA_Init(&hMemDMA) == HAL_OK)
+    {
+        HAL_DMA_RegisterCallback(&hMemDMA, HAL_DMA_XFER_CPLT_CB_ID, MemDmaCpltCallBack);
+        HAL_DMA_RegisterCallback(&hMemDMA, HAL_DMA_XFER_ERROR_CB_ID, MemDmaErrorCallBack);
+        evbMemInfo.state = 0;
+        status = 0;
+    }
+
+    return status;
+}
+
+int32_t EvbMemcpyAsync(void *hEvb, void *pDst, const void *pSrc, uint32_t numBytes,
+                       ADI_EVB_MEM_CALLBACK pfCallback)
+{
+    int32_t status = -1;
+    if ((hEvb != NULL) && (pDst != NULL) && (pSrc != NULL))
+    {
+        status = StartMemDma(pSrc, pDst, numBytes, 1, pfCallback);
+    }
+
+    return status;
+}
+
+int32_t EvbMemsetAsync(void *hEvb, void *pDst, uint8_t value, uint32_t numBytes,
+                       ADI_EVB_MEM_CALLBACK pfCallback)
+{
+    int32_t status = -1;
+    if ((hEvb != NULL) && (pDst != NULL) && (evbMemInfo.state != 1))
+    {
+        evbMemInfo.fillWord = (uint32_t)value * 0x01010101U;
+        status = StartMemDma(&evbMemInfo.fillWord, pDst, numBytes, 0, pfCallback);
+    }
+
+    return status;
+}
+
+int32_t EvbMemGetStatus(void *hEvb)
+{
+    int32_t status = -1;
+    if (hEvb != NULL)
+    {
+        status = evbMemInfo.state;
+    }
+
+    return status;
+}
+
+int32_t StartMemDma(const void *pSrc, void *pDst, uint32_t numBytes, uint8_t srcInc,
+                    ADI_EVB_MEM_CALLBACK pfCallback)
+{
+    int32_t status = -1;
+    uint32_t width = DMA_SRC_DATAWIDTH_BYTE | DMA_DEST_DATAWIDTH_BYTE;
+    uint32_t addrBits = (uint32_t)pDst | numBytes;
+
+    if ((hMemDMA.Instance != NULL) && (evbMemInfo.state != 1) && (numBytes > 0))
+    {
+        if (srcInc == 1)
+        {
+            addrBits |= (uint32_t)pSrc;
+        }
+        /* Word accesses when both ends and the count allow, byte accesses otherwise */
+        if ((addrBits & 0x3U) == 0)
+        {
+            width = DMA_SRC_DATAWIDTH_WORD | DMA_DEST_DATAWIDTH_WORD;
+        }
+        evbMemInfo.pfCallback = pfCallback;
+        evbMemInfo.srcAddr = (uint32_t)pSrc;
+        evbMemInfo.dstAddr = (uint32_t)pDst;
+        evbMemInfo.numBytesLeft = numBytes;
+        evbMemInfo.srcInc = srcInc;
+        evbMemInfo.state = 1;
+        // The channel is idle between transfers, so only CTR1 needs updating
+        MODIFY_REG(hMemDMA.Instance->CTR1, DMA_CTR1_SDW_LOG2 | DMA_CTR1_DDW_LOG2 | DMA_CTR1_SINC,
+                   width | ((srcInc == 1) ? DMA_CTR1_SINC : 0U));
+        status = StartMemBlock();
+        if (status != 0)
+        {
+            evbMemInfo.state = -1;
+        }
+    }
+
+    return status;
+}
+
+int32_t StartMemBlock(void)
+{
+    int32_t status = -1;
+    uint32_t numBytes = evbMemInfo.numBytesLeft;
+
+    if (numBytes > STM_MEM_DMA_MAX_BLOCK)
+    {
+        numBytes = STM_MEM_DMA_MAX_BLOCK;
+    }
+    if (HAL_DMA_Start_IT(&hMemDMA, evbMemInfo.srcAddr, evbMemInfo.dstAddr, numBytes) == HAL_OK)
+    {
+        evbMemInfo.numBytesLeft -= numBytes;
+        evbMemInfo.dstAddr += numBytes;
+        if (evbMemInfo.srcInc == 1)
+        {
+            evbMemInfo.srcAddr += numBytes;
+        }
+        status = 0;
+    }
+
+    return status;
+}
+
+void CompleteMemDma(int32_t status)
+{
+    evbMemInfo.state = status;
+    if (evbMemInfo.pfCallback != NULL)
+    {
+        evbMemInfo.pfCallback(status);
+    }
+}
+
+void MemDmaCpltCallBack(DMA_HandleTypeDef *hdma)
+{
+    (void)hdma;
+    if (evbMemInfo.numBytesLeft == 0)
+    {
+        CompleteMemDma(0);
+    }
+    else if (StartMemBlock() != 0)
+    {
+        CompleteMemDma(-1);
+    }
+}
+
+void MemDmaErrorCallBack(DMA_HandleTypeDef *hdma)
+{
+    (void)hdma;
+    CompleteMemDma(-1);
+}
+
+#endif /* APP_CFG_ENABLE_MEM_DMA */
+
+/**
+ * @}
+ */
@@ -36,6 +36,14 @@ typedef struct
     ADI_EVB_CALLBACK pfAdeSpiRxCallback;
     /** callback */
     ADI_EVB_CALLBACK pfAdeSpiTxCallback;
+    /** status of the last completed transfer */
+    volatile int32_t xferStatus;
+    /** segments of the burst in progress, NULL when no burst is active */
+    ADI_EVB_SPI_SEGMENT *pSegments;
+    /** num of segments in the burst */
+    uint32_t numSegments;
+    /** index of the segment in progress */
+    volatile uint32_t segmentIndex;
 
 } EVB_SPI_INFO;
 
@@ -47,6 +55,9 @@ DMA_HandleTypeDef hAdcDMASPITx;
 /** creating dma spirx instance*/
 DMA_HandleTypeDef hAdcDMASPIRx;
 static void AdeSpiTxRxCallBack(SPI_HandleTypeDef *hspi);
+static void AdeSpiErrorCallBack(SPI_HandleTypeDef *hspi);
+/** Common completion of a transfer */
+static void CompleteAdeSpiXfer(int32_t xferStatus);
 
 /*============= F U N C T I O N S =============*/
 
@@ -103,6 +114,10 @@ int32_t EvbAdeSpiTransceive(void *hEvb, uint8_t *pTxData, uint8_t *pRxData, uint
             {
                 status = 1;
             }
+            else
+            {
+                status = evbSpiInfo.xferStatus;
+            }
         }
         else
         {
@@ -149,6 +164,146 @@ int32_t EvbAdeSpiSetFrequency(void *hEvb, uint32_t spiFrequency)
     return status;
 }
 
+int32_t EvbAdeSpiGetClockConfig(void *hEvb, uint32_t spiFrequency, uint32_t *pClkConfig)
+{
+    int32_t status = -1;
+    STM_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adcSpiInfo;
+    if ((hEvb != NULL) && (pClkConfig != NULL))
+    {
+        status = StmGetSpiPrescaler(pSpiInfo, spiFrequency, pClkConfig);
+    }
+
+    return status;
+}
+
+int32_t EvbAdeSpiSetClockConfig(void *hEvb, uint32_t clkConfig)
+{
+    int32_t status = -1;
+    STM_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adcSpiInfo;
+    if (hEvb != NULL)
+    {
+        status = StmSetSpiPrescaler(pSpiInfo, clkConfig);
+    }
+
+    return status;
+}
+
+int32_t EvbAdeSpiSetDataSize(void *hEvb, uint32_t dataSize, uint32_t burstLength)
+{
+    int32_t status = -1;
+    STM_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adcSpiInfo;
+    if ((hEvb != NULL) && ((dataSize == 8U) || (dataSize == 16U) || (dataSize == 24U) ||
+                           (dataSize == 32U)))
+    {
+        if ((burstLength >= 1U) && (burstLength <= 16U))
+        {
+            // SPI_DATASIZE_xBIT and SPI_FIFO_THRESHOLD_xxDATA encode x - 1
+            status = StmSetSpiDataSize(pSpiInfo, dataSize - 1U,
+                                       (burstLength - 1U) << SPI_CFG1_FTHLV_Pos);
+        }
+    }
+
+    return status;
+}
+
+int32_t EvbAdeSpiSetRxStride(void *hEvb, uint32_t rxStride)
+{
+    int32_t status = -1;
+    STM_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adcSpiInfo;
+    if (hEvb != NULL)
+    {
+        status = StmSetSpiRxStride(pSpiInfo, rxStride);
+    }
+
+    return status;
+}
+
+int32_t EvbAdeSpiSetRxCrc(void *hEvb, ADI_EVB_CRC_CONTEXT *pContext, uint8_t *pData,
+                          uint32_t numBytes, ADI_EVB_SPI_CRC_CALLBACK pfCallback)
+{
+    // Not chained on this target, use EvbCrcSubmit from the Rx callback
+    (void)hEvb;
+    (void)pContext;
+    (void)pData;
+    (void)numBytes;
+    (void)pfCallback;
+
+    return -1;
+}
+
+int32_t EvbAdeSpiTransceiveBurst(void *hEvb, ADI_EVB_SPI_SEGMENT *pSegments, uint32_t numSegments)
+{
+    int32_t status = -1;
+    STM_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adcSpiInfo;
+    if ((hEvb != NULL) && (pSegments != NULL) && (numSegments > 0U) &&
+        (evbSpiInfo.pSegments == NULL))
+    {
+        evbSpiInfo.pSegments = pSegments;
+        evbSpiInfo.numSegments = numSegments;
+        evbSpiInfo.segmentIndex = 0;
+        status = StmStartSpiTxRxDMA(pSpiInfo, pSegments[0].pTxData, pSegments[0].pRxData,
+                                    pSegments[0].numBytes);
+        if (status != 0)
+        {
+            evbSpiInfo.pSegments = NULL;
+        }
+    }
+
+    return status;
+}
+
+int32_t EvbAdeSpiTuneFrequency(void *hEvb, ADI_EVB_SPI_LINK_TEST pfLinkTest, uint32_t numReads,
+                               uint32_t *pClkConfig)
+{
+    int32_t status = -1;
+    STM_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adcSpiInfo;
+    uint32_t slowest = _FLD2VAL(SPI_CFG1_MBR, BOARD_CFG_ADC_SPI_PRESCALER);
+    uint32_t mbr;
+
+    if ((hEvb != NULL) && (pfLinkTest != NULL) && (pClkConfig != NULL))
+    {
+        status = 0;
+        // Fastest setting first, the board default is the slowest one tried
+        for (mbr = 0U; mbr < slowest; mbr++)
+        {
+            status = StmSetSpiPrescaler(pSpiInfo, _VAL2FLD(SPI_CFG1_MBR, mbr));
+            if ((status != 0) || (pfLinkTest(hEvb, numReads) == 0))
+            {
+                break;
+            }
+        }
+        if (status == 0)
+        {
+            mbr += BOARD_CFG_ADC_SPI_TUNE_MARGIN;
+            if (mbr > slowest)
+            {
+                mbr = slowest;
+            }
+            *pClkConfig = _VAL2FLD(SPI_CFG1_MBR, mbr);
+            status = StmSetSpiPrescaler(pSpiInfo, *pClkConfig);
+        }
+        // The applied setting is checked too, it is the untested board default when no
+        // faster setting passed
+        if ((status == 0) && (pfLinkTest(hEvb, numReads) != 0))
+        {
+            status = -1;
+        }
+    }
+
+    return status;
+}
+
+int32_t EvbAdeSpiGetXferStatus(void *hEvb)
+{
+    int32_t status = -1;
+    if (hEvb != NULL)
+    {
+        status = evbSpiInfo.xferStatus;
+    }
+
+    return status;
+}
+
 int32_t InitAdeSpi(ADI_EVB_SPI_CONFIG *pConfig)
 {
     int32_t status = 0;
@@ -161,11 +316,20 @@ int32_t InitAdeSpi(ADI_EVB_SPI_CONFIG *pConfig)
     pStmSpiInfo->phSpi = &hSPI;
     pStmSpiInfo->clkPol = BOARD_CFG_ADC_SPI_CLK_POL;
     pStmSpiInfo->clkPha = BOARD_CFG_ADC_SPI_CLK_PHA;
+    pStmSpiInfo->dataSize = BOARD_CFG_ADC_SPI_DATA_SIZE;
+    pStmSpiInfo->fifoThreshold = BOARD_CFG_ADC_SPI_FIFO_THRESHOLD;
+#if APP_CFG_ENABLE_ADC_SPI_CRC == 1
+    pStmSpiInfo->crcCalculation = SPI_CRCCALCULATION_ENABLE;
+#else
+    pStmSpiInfo->crcCalculation = SPI_CRCCALCULATION_DISABLE;
+#endif
     pStmSpiInfo->suspendState = 1;
     pStmSpiInfo->ssPin = BOARD_CFG_SS_PIN;
     pStmSpiInfo->ssPort = BOARD_CFG_SS_PORT;
     status = StmInitSpi(pStmSpiInfo);
     HAL_SPI_RegisterCallback(&hSPI, HAL_SPI_TX_RX_COMPLETE_CB_ID, AdeSpiTxRxCallBack);
+    // A crc mismatch completes the transfer through the error callback
+    HAL_SPI_RegisterCallback(&hSPI, HAL_SPI_ERROR_CB_ID, AdeSpiErrorCallBack);
     if (status == 0)
     {
         status = EvbAdeSlaveSelectConfig();
@@ -200,22 +364,71 @@ void AdeSpiTxRxCallBack(SPI_HandleTypeDef *hspi)
 {
     if (hspi != NULL)
     {
-        STM_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adcSpiInfo;
-        if (evbSpiInfo.pfAdeSpiTxCallback != NULL)
+        CompleteAdeSpiXfer(ADI_EVB_STATUS_SUCCESS);
+    }
+}
+
+void AdeSpiErrorCallBack(SPI_HandleTypeDef *hspi)
+{
+    if (hspi != NULL)
+    {
+        if ((hspi->ErrorCode & HAL_SPI_ERROR_CRC) != 0U)
         {
-            evbSpiInfo.pfAdeSpiTxCallback();
+            CompleteAdeSpiXfer(ADI_EVB_STATUS_CRC_ERROR);
         }
-        if (evbSpiInfo.pfAdeSpiRxCallback != NULL)
+        else
+        {
+            CompleteAdeSpiXfer(-1);
+        }
+    }
+}
+
+void CompleteAdeSpiXfer(int32_t xferStatus)
+{
+    STM_SPI_INSTANCE *pSpiInfo = &evbSpiInfo.adcSpiInfo;
+    ADI_EVB_SPI_SEGMENT *pSegment;
+    uint8_t isBurstPending = 0;
+
+    if (evbSpiInfo.pSegments != NULL)
+    {
+        evbSpiInfo.segmentIndex++;
+        if ((xferStatus == ADI_EVB_STATUS_SUCCESS) &&
+            (evbSpiInfo.segmentIndex < evbSpiInfo.numSegments))
         {
-            if (isSuspendCalled == 1)
+            // Chip select stays low, start the next segment of the burst
+            pSegment = &evbSpiInfo.pSegments[evbSpiInfo.segmentIndex];
+            if (StmStartSpiTxRxDMA(pSpiInfo, pSegment->pTxData, pSegment->pRxData,
+                                   pSegment->numBytes) == 0)
             {
-                pSpiInfo->suspendState = 0;
+                isBurstPending = 1;
             }
             else
             {
-                evbSpiInfo.pfAdeSpiRxCallback();
+                xferStatus = -1;
             }
         }
+        if (isBurstPending == 0)
+        {
+            evbSpiInfo.pSegments = NULL;
+        }
+    }
+
+    if (isBurstPending == 0)
+    {
+        evbSpiInfo.xferStatus = xferStatus;
+        if (evbSpiInfo.pfAdeSpiTxCallback != NULL)
+        {
+            evbSpiInfo.pfAdeSpiTxCallback();
+        }
+        // Blocking transfers are released even without a callback, e.g. during tuning at init
+        if (isSuspendCalled == 1)
+        {
+            pSpiInfo->suspendState = 0;
+        }
+        else if (evbSpiInfo.pfAdeSpiRxCallback != NULL)
+        {
+            evbSpiInfo.pfAdeSpiRxCallback();
+        }
         HAL_GPIO_WritePin((GPIO_TypeDef *)BOARD_CFG_SS_PORT, BOARD_CFG_SS_PIN, GPIO_PIN_SET);
     }
 }
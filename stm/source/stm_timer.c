@@ -44,10 +44,67 @@ void EvbStopCf1Timer(void)
     StmStopCf1Timer();
 }
 
+int32_t EvbStartCfBurst(ADI_EVB_CF_PERIOD *pPeriods, uint32_t numPeriods,
+                        ADI_EVB_CF_BURST_CALLBACK pfCallback)
+{
+    return StmStartCfBurst(pPeriods, numPeriods, pfCallback);
+}
+
+void EvbStopCfBurst(void)
+{
+    StmStopCfBurst();
+}
+
+int32_t EvbStartDreadyCapture(uint32_t *pRing, uint32_t numEntries)
+{
+    return StmStartDreadyCapture(pRing, numEntries);
+}
+
+void EvbStopDreadyCapture(void)
+{
+    StmStopDreadyCapture();
+}
+
+uint32_t EvbGetDreadyCaptureCount(void)
+{
+    return StmGetDreadyCaptureCount();
+}
+
+uint64_t EvbCaptureToTime64(uint32_t count)
+{
+    return StmCaptureToTime64(count);
+}
+
+int32_t EvbStartPulseCount(uint32_t idx, uint32_t threshold, ADI_EVB_PULSE_CALLBACK pfCallback)
+{
+    // The CF pins are timer outputs on this board, there is no pulse input to count
+    (void)idx;
+    (void)threshold;
+    (void)pfCallback;
+    return -1;
+}
+
+void EvbStopPulseCount(uint32_t idx)
+{
+    (void)idx;
+}
+
+uint32_t EvbGetPulseCount(uint32_t idx)
+{
+    (void)idx;
+    return 0;
+}
+
 uint32_t EvbTimerInit(void)
 {
     uint32_t status;
     status = StmTimerInit(BOARD_CFG_SYSTEM_TIMER);
+#ifdef BOARD_CFG_WAKE_TIMER
+    if (status == 0)
+    {
+        status = StmWakeTimerInit(BOARD_CFG_WAKE_TIMER);
+    }
+#endif
     return status;
 }
 
@@ -60,8 +117,39 @@ uint32_t EvbLowPowerTimerInit(void)
 
 uint32_t EvbGetTime(void)
 {
-    return StmGetTime(BOARD_CFG_SYSTEM_TIMER);
+    return (uint32_t)EvbTicksToUs(StmGetTime64(BOARD_CFG_SYSTEM_TIMER));
+}
+
+uint32_t EvbGetMaxTime(void)
+{
+    return 0xFFFFFFFFU;
+}
+
+uint64_t EvbGetTime64(void)
+{
+    return StmGetTime64(BOARD_CFG_SYSTEM_TIMER);
 }
+
+uint32_t EvbGetTimerFrequency(void)
+{
+    return StmGetTimerFrequency();
+}
+
+void EvbStartTickTimer(void)
+{
+    StmStartTickTimer();
+}
+
+void EvbStopTickTimer(void)
+{
+    StmStopTickTimer();
+}
+
+int32_t EvbEnterLowPower(ADI_EVB_POWER_MODE mode, uint32_t sleepUs)
+{
+    return StmEnterLowPower((mode == ADI_EVB_POWER_MODE_STOP) ? 1u : 0u, sleepUs);
+}
+
 void EvbStartTimer(void)
 {
     StmStartTimer(BOARD_CFG_SYSTEM_TIMER);